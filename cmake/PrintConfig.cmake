@@ -55,6 +55,12 @@ else()
     message(STATUS "    BUILD_BENCH              : off")
 endif()
 
+if(BUILD_TOOLS)
+    message(STATUS "    BUILD_TOOLS              : ON")
+else()
+    message(STATUS "    BUILD_TOOLS              : off")
+endif()
+
 if(ENABLE_TEGRA)
     message(STATUS "    ENABLE_TEGRA             : ON")
 else()
@@ -29,6 +29,8 @@
 #include "RemapMapValueType.hpp"
 #include "SIFTFlagType.hpp"
 #include "ThresholdType.hpp"
+#include "WorkspaceCache.hpp"
+#include "WorkspacePlan.hpp"
 
 #include <cvcuda/Version.h>
 #include <pybind11/pybind11.h>
@@ -90,6 +92,8 @@ PYBIND11_MODULE(cvcuda, m)
     ExportLabelType(m);
     ExportNormType(m);
     ExportPairwiseMatcherType(m);
+    ExportWorkspaceCache(m);
+    ExportWorkspacePlan(m);
 
     // CV-CUDA Operators
     ExportOpPairwiseMatcher(m);
@@ -78,13 +78,13 @@ public:
     inline void submit(cudaStream_t stream, const nvcv::Tensor &srcPts, const nvcv::Tensor &dstPts,
                        const nvcv::Tensor &models)
     {
-        m_op(stream, srcPts, dstPts, models);
+        SubmitWithoutGIL(m_submitMutex, [&] { m_op(stream, srcPts, dstPts, models); });
     }
 
     inline void submit(cudaStream_t stream, const nvcv::TensorBatch &srcPts, const nvcv::TensorBatch &dstPts,
                        const nvcv::TensorBatch &models)
     {
-        m_op(stream, srcPts, dstPts, models);
+        SubmitWithoutGIL(m_submitMutex, [&] { m_op(stream, srcPts, dstPts, models); });
     }
 
     // Required override to get the py object container.
@@ -134,6 +134,7 @@ public:
 private:
     Key                    m_key;
     cvcuda::FindHomography m_op;
+    std::mutex             m_submitMutex;
 };
 
 Tensor FindHomographyInto(Tensor &models, Tensor &srcPts, Tensor &dstPts, std::optional<Stream> pstream)
@@ -72,7 +72,7 @@ public:
     template<class... AA>
     void submit(AA &&...args)
     {
-        m_op(std::forward<AA>(args)...);
+        SubmitWithoutGIL(m_submitMutex, [&] { m_op(std::forward<AA>(args)...); });
     }
 
     py::object container() const override
@@ -114,6 +114,7 @@ public:
 private:
     Key             m_key;
     cvcuda::Inpaint m_op;
+    std::mutex      m_submitMutex;
 };
 
 Tensor InpaintInto(Tensor &output, Tensor &input, Tensor &masks, double inpaintRadius, std::optional<Stream> pstream)
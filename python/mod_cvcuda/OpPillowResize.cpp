@@ -78,13 +78,17 @@ public:
     inline void submit(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, nvcv::ImageFormat format,
                        NVCVInterpolationType interpolation)
     {
-        int          batch_size = getBatchSize(in);
-        nvcv::Size2D in_size    = imageSize(in);
-        nvcv::Size2D out_size   = imageSize(out);
-
-        auto req = m_op.getWorkspaceRequirements(batch_size, out_size, in_size, format);
-        auto ws  = WorkspaceCache::instance().get(req, stream);
-        m_op(stream, ws.get(), in, out, interpolation);
+        SubmitWithoutGIL(m_submitMutex,
+                         [&]
+                         {
+                             int          batch_size = getBatchSize(in);
+                             nvcv::Size2D in_size    = imageSize(in);
+                             nvcv::Size2D out_size   = imageSize(out);
+
+                             auto req = m_op.getWorkspaceRequirements(batch_size, out_size, in_size, format);
+                             auto ws  = WorkspaceCache::instance().get(req, stream);
+                             m_op(stream, ws.get(), in, out, interpolation);
+                         });
     }
 
     inline int getBatchSize(const nvcv::Tensor &tensor)
@@ -109,12 +113,17 @@ public:
                        const NVCVInterpolationType interpolation)
     {
         assert(in.numImages() == out.numImages());
-        auto in_sizes  = imageSizes(in);
-        auto out_sizes = imageSizes(out);
-        int  N         = in_sizes.size();
-        auto req       = m_op.getWorkspaceRequirements(N, in_sizes.data(), out_sizes.data(), in.uniqueFormat());
-        auto ws        = WorkspaceCache::instance().get(req, stream);
-        m_op(stream, ws.get(), in, out, interpolation);
+        SubmitWithoutGIL(m_submitMutex,
+                         [&]
+                         {
+                             auto in_sizes  = imageSizes(in);
+                             auto out_sizes = imageSizes(out);
+                             int  N         = in_sizes.size();
+                             auto req = m_op.getWorkspaceRequirements(N, in_sizes.data(), out_sizes.data(),
+                                                                      in.uniqueFormat());
+                             auto ws  = WorkspaceCache::instance().get(req, stream);
+                             m_op(stream, ws.get(), in, out, interpolation);
+                         });
     }
 
     static std::vector<nvcv::Size2D> imageSizes(const nvcv::ImageBatchVarShape &batch)
@@ -173,6 +182,7 @@ public:
 private:
     Key                  m_key;
     cvcuda::PillowResize m_op;
+    std::mutex           m_submitMutex;
 };
 
 Tensor PillowResizeInto(Tensor &output, Tensor &input, nvcv::ImageFormat format, NVCVInterpolationType interp,
@@ -96,6 +96,57 @@ ImageBatchVarShape ResizeVarShape(ImageBatchVarShape &input, const std::vector<s
     return ResizeVarShapeInto(output, input, interp, pstream);
 }
 
+std::vector<Tensor> ResizeManyInto(std::vector<Tensor> &outputs, std::vector<Tensor> &inputs,
+                                   NVCVInterpolationType interp, std::optional<Stream> pstream)
+{
+    if (outputs.size() != inputs.size())
+    {
+        throw std::runtime_error("Number of output tensors must be equal to the number of input tensors");
+    }
+
+    if (!pstream)
+    {
+        pstream = Stream::Current();
+    }
+
+    auto resize = CreateOperator<cvcuda::Resize>();
+
+    ResourceGuard guard(*pstream);
+    guard.add(LockMode::LOCK_READ, inputs);
+    guard.add(LockMode::LOCK_WRITE, outputs);
+    guard.add(LockMode::LOCK_NONE, {*resize});
+
+    cudaStream_t stream = pstream->cudaHandle();
+    resize->submitMany(
+        [&](cvcuda::Resize &op)
+        {
+            for (size_t i = 0; i < inputs.size(); ++i)
+            {
+                op(stream, inputs[i], outputs[i], interp);
+            }
+        });
+
+    return outputs;
+}
+
+std::vector<Tensor> ResizeMany(std::vector<Tensor> &inputs, const std::vector<Shape> &out_shapes,
+                               NVCVInterpolationType interp, std::optional<Stream> pstream)
+{
+    if (out_shapes.size() != inputs.size())
+    {
+        throw std::runtime_error("Number of output shapes must be equal to the number of input tensors");
+    }
+
+    std::vector<Tensor> outputs;
+    outputs.reserve(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        outputs.push_back(Tensor::Create(out_shapes[i], inputs[i].dtype(), inputs[i].shape().layout()));
+    }
+
+    return ResizeManyInto(outputs, inputs, interp, pstream);
+}
+
 } // namespace
 
 void ExportOpResize(py::module &m)
@@ -204,6 +255,52 @@ void ExportOpResize(py::module &m)
             Restrictions to several arguments may apply. Check the C
             API references of the CV-CUDA operator.
     )pbdoc");
+
+    m.def("resize_many", &ResizeMany, "srcs"_a, "shapes"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
+          "stream"_a = nullptr, R"pbdoc(
+
+	cvcuda.resize_many(srcs: List[nvcv.Tensor], shapes: List[Tuple], interp: Interp = < NVCV_INTERP_LINEAR >, stream: Optional[nvcv.cuda.Stream] = None) -> List[nvcv.Tensor]
+
+        Executes the Resize operation on each of the given tensors on the given cuda stream.
+
+        The operator, the stream and the resources are looked up once for the whole list, and
+        the calls are submitted together. This amortizes the per-call host overhead when many
+        small tensors are resized.
+
+        Args:
+            srcs (List[Tensor]): Input tensors, each containing one or more images.
+            shapes (List[Tuple]): Shapes of the output tensors, one for each input tensor.
+            interp(Interp): Interpolation type used for transform.
+            stream (Stream, optional): CUDA Stream on which to perform the operations.
+
+        Returns:
+            List[cvcuda.Tensor]: The output tensors.
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
+
+    m.def("resize_many_into", &ResizeManyInto, "dsts"_a, "srcs"_a, "interp"_a = NVCV_INTERP_LINEAR, py::kw_only(),
+          "stream"_a = nullptr, R"pbdoc(
+
+	cvcuda.resize_many_into(dsts: List[nvcv.Tensor], srcs: List[nvcv.Tensor], interp: Interp = < NVCV_INTERP_LINEAR >, stream: Optional[nvcv.cuda.Stream] = None) -> List[nvcv.Tensor]
+
+        Executes the Resize operation on each pair of the given tensors on the given cuda stream.
+
+        Args:
+            dsts (List[Tensor]): Output tensors, one for each input tensor.
+            srcs (List[Tensor]): Input tensors, each containing one or more images.
+            interp(Interp): Interpolation type used for transform.
+            stream (Stream, optional): CUDA Stream on which to perform the operations.
+
+        Returns:
+            List[cvcuda.Tensor]: The output tensors.
+
+        Caution:
+            Restrictions to several arguments may apply. Check the C
+            API references of the CV-CUDA operator.
+    )pbdoc");
 }
 
 } // namespace cvcudapy
@@ -82,7 +82,7 @@ public:
     template<class... AA>
     void submit(AA &&...args)
     {
-        m_op(std::forward<AA>(args)...);
+        SubmitWithoutGIL(m_submitMutex, [&] { m_op(std::forward<AA>(args)...); });
     }
 
     py::object container() const override
@@ -124,6 +124,7 @@ public:
 private:
     Key          m_key;
     cvcuda::SIFT m_op;
+    std::mutex   m_submitMutex;
 };
 
 // Auxiliary function to get tensor access for input tensor in
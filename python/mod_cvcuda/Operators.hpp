@@ -29,6 +29,8 @@
 
 #include <nvcv/python/Fwd.hpp>
 
+#include <mutex>
+
 namespace nvcvpy::util {
 }
 
@@ -100,6 +102,20 @@ void ExportOpPairwiseMatcher(py::module &m);
 void ExportOpStack(py::module &m);
 void ExportOpFindHomography(py::module &m);
 
+// Runs fn, which calls a native operator, with the GIL released, so that python threads feeding
+// other streams can do their host work in parallel. Operator instances are shared through the
+// cache, so the calls to one instance are serialized with its mutex, which is locked after the
+// GIL is released to avoid deadlocks.
+// Python objects must only be passed to the operator by reference, as native objects. They must
+// not be copied or destroyed while the GIL is released.
+template<class F>
+void SubmitWithoutGIL(std::mutex &opMutex, F &&fn)
+{
+    py::gil_scoped_release      release;
+    std::lock_guard<std::mutex> lk(opMutex);
+    fn();
+}
+
 // Helper class that serves as generic python-side operator class.
 // OP: native operator class
 // CTOR: ctor signature
@@ -146,7 +162,26 @@ public:
     template<class... AA>
     void submit(AA &&...args)
     {
-        m_op(std::forward<AA>(args)...);
+        SubmitWithoutGIL(m_submitMutex, [&] { m_op(std::forward<AA>(args)...); });
+    }
+
+    // Calls fn(op) with the native operator, so that several calls can be submitted
+    // with one GIL release and lock of the operator.
+    template<class F>
+    void submitMany(F &&fn)
+    {
+        SubmitWithoutGIL(m_submitMutex, [&] { fn(m_op); });
+    }
+
+    // Whether another thread is submitting work to this operator.
+    bool isBusy()
+    {
+        if (m_submitMutex.try_lock())
+        {
+            m_submitMutex.unlock();
+            return false;
+        }
+        return true;
     }
 
     py::object container() const override
@@ -162,17 +197,28 @@ public:
     // The static fetch function is used to fetch one object from a sub-set of objects from cache.
     // All objects passed in the cache argument already match the operator object, this second-level fetch
     // allows to choose one of them and further do cache operations on the matched items.
+    // It may return null, in which case a new operator object is created.
     static std::shared_ptr<nvcvpy::ICacheItem> fetch(std::vector<std::shared_ptr<nvcvpy::ICacheItem>> &cache)
     {
         assert(!cache.empty());
-        // This generic operator just returns the first one found in cache.
-        return cache[0];
+        // This generic operator returns the first one found in cache that isn't being used by
+        // another thread, or none if all of them are, so that threads don't wait for each other.
+        for (const std::shared_ptr<nvcvpy::ICacheItem> &item : cache)
+        {
+            auto *op = dynamic_cast<PyOperator *>(item.get());
+            if (op != nullptr && !op->isBusy())
+            {
+                return item;
+            }
+        }
+        return nullptr;
     }
 
 private:
     // Order is important
-    Key m_key;
-    OP  m_op;
+    Key        m_key;
+    OP         m_op;
+    std::mutex m_submitMutex;
 };
 
 // Creates an operator instance.
@@ -190,23 +236,23 @@ std::shared_ptr<PyOP> CreateOperatorEx(CTOR_ARGS &&...args)
     // Try to fetch it from cache
     std::vector<std::shared_ptr<nvcvpy::ICacheItem>> vcont = nvcvpy::Cache::fetch(key);
 
-    // None found?
-    if (vcont.empty())
+    std::shared_ptr<PyOP> op;
+    if (!vcont.empty())
+    {
+        op = std::dynamic_pointer_cast<PyOP>(PyOP::fetch(vcont));
+    }
+
+    // None found, or the ones found are in use by other threads?
+    if (!op)
     {
         // Creates a new one
-        auto op = std::shared_ptr<PyOP>(new PyOP(std::forward<CTOR_ARGS>(args)...));
+        op = std::shared_ptr<PyOP>(new PyOP(std::forward<CTOR_ARGS>(args)...));
 
         // Adds to the resource cache
         nvcvpy::Cache::add(*op);
-
-        return op;
-    }
-    else
-    {
-        auto op = std::dynamic_pointer_cast<PyOP>(PyOP::fetch(vcont));
-        assert(op);
-        return op;
     }
+
+    return op;
 }
 
 template<class OP, class... CTOR_ARGS>
@@ -17,8 +17,15 @@
 
 #include "WorkspaceCache.hpp"
 
+#include "WorkspacePlan.hpp"
+
+#include <stdexcept>
+#include <string>
+
 namespace cvcudapy {
 
+namespace py = ::pybind11;
+
 WorkspaceLease::WorkspaceLease(WorkspaceCache *owner, CachedWorkspaceMem<MemoryKind::Host> &&host,
                                CachedWorkspaceMem<MemoryKind::Pinned> &&pinned,
                                CachedWorkspaceMem<MemoryKind::Cuda>   &&cuda,
@@ -35,6 +42,12 @@ WorkspaceLease::WorkspaceLease(WorkspaceCache *owner, CachedWorkspaceMem<MemoryK
 {
 }
 
+WorkspaceLease::WorkspaceLease(const cvcuda::Workspace &view)
+    : m_owner(nullptr)
+    , m_view(view)
+{
+}
+
 WorkspaceLease::~WorkspaceLease()
 {
     if (m_host)
@@ -70,6 +83,15 @@ WorkspaceLease WorkspaceCache::get(cvcuda::WorkspaceRequirements req, std::optio
                           hostReleaseStream, pinnedReleaseStream, cudaReleaseStream);
 }
 
+WorkspaceLease WorkspaceCache::get(cvcuda::WorkspaceRequirements req, cudaStream_t stream)
+{
+    cvcuda::Workspace view;
+    if (PyWorkspacePlan::GetStage(req, stream, view))
+        return WorkspaceLease(view);
+
+    return get(req, std::nullopt, std::nullopt, std::nullopt, stream, stream, stream);
+}
+
 WorkspaceCache &WorkspaceCache::instance()
 {
     static WorkspaceCache instance;
@@ -84,4 +106,96 @@ void WorkspaceCache::clear()
     m_eventCache->purge();
 }
 
+namespace {
+
+template<MemoryKind kind>
+py::dict StatsToDict(const WorkspaceMemCache<kind> &cache)
+{
+    using namespace py::literals;
+
+    nvcv::util::PerStreamCacheStats stats  = cache.stats();
+    size_t                          budget = cache.byteBudget();
+
+    py::object pyBudget = py::none();
+    if (budget != nvcv::util::PerStreamCache<CachedWorkspaceMem<kind>>::kUnlimited)
+        pyBudget = py::cast(budget);
+
+    return py::dict("hits"_a = stats.hits, "misses"_a = stats.misses, "evictions"_a = stats.evictions,
+                    "evicted_bytes"_a = stats.evictedBytes, "items_cached"_a = stats.itemsCached,
+                    "bytes_cached"_a = stats.bytesCached, "peak_bytes_cached"_a = stats.peakBytesCached,
+                    "leased"_a = cache.leased(), "byte_budget"_a = pyBudget);
+}
+
+template<MemoryKind kind>
+void SetBudget(WorkspaceMemCache<kind> &cache, py::handle budget)
+{
+    if (budget.is_none())
+    {
+        cache.setByteBudget(nvcv::util::PerStreamCache<CachedWorkspaceMem<kind>>::kUnlimited);
+        return;
+    }
+
+    auto value = budget.cast<int64_t>();
+    if (value < 0)
+        throw std::invalid_argument("Workspace cache budget must not be negative");
+    cache.setByteBudget(value);
+}
+
+} // namespace
+
+void ExportWorkspaceCache(py::module &m)
+{
+    m.def(
+        "workspace_cache_stats",
+        []()
+        {
+            using namespace py::literals;
+
+            WorkspaceCache &cache = WorkspaceCache::instance();
+            return py::dict("host"_a = StatsToDict(cache.host()), "pinned"_a = StatsToDict(cache.pinned()),
+                            "cuda"_a = StatsToDict(cache.cuda()));
+        },
+        R"pbdoc(
+        Returns the statistics of the workspace cache used by the operators.
+
+        Returns:
+            dict: For each kind of memory ("host", "pinned" and "cuda"), a dict with the number of cache
+                  hits, misses and evictions, the number and total size of the idle memory blocks in the
+                  cache, the peak of that size, the number of blocks in use and the byte budget
+                  (None if unlimited).
+    )pbdoc");
+
+    m.def(
+        "set_workspace_cache_budget",
+        [](py::kwargs kwargs)
+        {
+            WorkspaceCache &cache = WorkspaceCache::instance();
+            for (auto [key, value] : kwargs)
+            {
+                std::string kind = py::str(key);
+                if (kind == "host")
+                    SetBudget(cache.host(), value);
+                else if (kind == "pinned")
+                    SetBudget(cache.pinned(), value);
+                else if (kind == "cuda")
+                    SetBudget(cache.cuda(), value);
+                else
+                    throw std::invalid_argument("Invalid workspace memory kind: " + kind);
+            }
+        },
+        R"pbdoc(
+        Limits the total size of the idle memory blocks kept by the workspace cache.
+
+        When the limit is exceeded, the idle blocks that are ready for reuse are released, least recently
+        used first.
+
+        Args:
+            host (int, optional): Budget, in bytes, for plain host memory; None means unlimited.
+            pinned (int, optional): Budget, in bytes, for pinned host memory; None means unlimited.
+            cuda (int, optional): Budget, in bytes, for device memory; None means unlimited.
+
+        The budgets of the kinds of memory that aren't passed are left unchanged.
+    )pbdoc");
+}
+
 } // namespace cvcudapy
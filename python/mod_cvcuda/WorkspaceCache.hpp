@@ -21,6 +21,7 @@
 #include <common/CheckError.hpp>
 #include <cvcuda/Workspace.hpp>
 #include <nvcv/alloc/Allocator.hpp>
+#include <pybind11/pybind11.h>
 #include <util/Event.hpp>
 #include <util/PerStreamCache.hpp>
 #include <util/SimpleCache.hpp>
@@ -161,6 +162,28 @@ public:
         m_memCache.purge();
     }
 
+    /** Sets the maximum total size of the idle memory blocks kept in the cache */
+    void setByteBudget(size_t budget)
+    {
+        m_memCache.setByteBudget(budget);
+    }
+
+    size_t byteBudget() const
+    {
+        return m_memCache.byteBudget();
+    }
+
+    nvcv::util::PerStreamCacheStats stats() const
+    {
+        return m_memCache.stats();
+    }
+
+    /** The number of memory blocks obtained from the cache and not returned yet */
+    int leased() const
+    {
+        return m_outstandingAllocs;
+    }
+
 private:
     void *allocateMem(size_t size, size_t alignment) const
     {
@@ -229,6 +252,8 @@ class WorkspaceLease
 public:
     cvcuda::Workspace get() const
     {
+        if (!m_owner)
+            return m_view;
         return {m_host, m_pinned, m_cuda};
     }
 
@@ -241,7 +266,11 @@ private:
                    std::optional<cudaStream_t> hostReleaseStream, std::optional<cudaStream_t> pinnedReleaseStream,
                    std::optional<cudaStream_t> cudaReleaseStream);
 
+    // A lease of memory owned by somebody else, e.g. a workspace plan
+    explicit WorkspaceLease(const cvcuda::Workspace &view);
+
     WorkspaceCache                        *m_owner;
+    cvcuda::Workspace                      m_view{};
     CachedWorkspaceMem<MemoryKind::Host>   m_host;
     CachedWorkspaceMem<MemoryKind::Pinned> m_pinned;
     CachedWorkspaceMem<MemoryKind::Cuda>   m_cuda;
@@ -280,11 +309,10 @@ public:
      * - device memory is acquired and released on the same stream
      *
      * NOTE: If these semantics are not honored by the user, the code should still be correct, just less efficient.
+     *
+     * If a `WorkspacePlan` is active in the calling thread, the workspace is a view of the plan's workspace.
      */
-    WorkspaceLease get(cvcuda::WorkspaceRequirements req, cudaStream_t stream)
-    {
-        return get(req, std::nullopt, std::nullopt, std::nullopt, stream, stream, stream);
-    }
+    WorkspaceLease get(cvcuda::WorkspaceRequirements req, cudaStream_t stream);
 
     auto &host()
     {
@@ -314,6 +342,8 @@ private:
     friend class WorkspaceLease;
 };
 
+void ExportWorkspaceCache(pybind11::module &m);
+
 } // namespace cvcudapy
 
 #endif // CVCUDA_PYTHON_WORKSPACE_CACHE_HPP
@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkspacePlan.hpp"
+
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+
+namespace cvcudapy {
+
+namespace {
+
+// The innermost plan active in the current thread
+thread_local PyWorkspacePlan *g_activePlan = nullptr;
+
+py::tuple ToTuple(const cvcuda::WorkspaceMemRequirements &req)
+{
+    return py::make_tuple(req.size, req.alignment);
+}
+
+} // namespace
+
+PyWorkspacePlan::PyWorkspacePlan(std::optional<nvcvpy::Stream> stream)
+    : m_stream(std::move(stream))
+{
+}
+
+void PyWorkspacePlan::enter()
+{
+    if (m_active)
+        throw std::runtime_error("The workspace plan is already active");
+
+    nvcvpy::Stream stream = m_stream ? *m_stream : nvcvpy::Stream::Current();
+    m_cudaStream          = stream.cudaHandle();
+    m_nextStage           = 0;
+
+    if (m_plan.numStages() > 0)
+    {
+        // Bypass the active plans, if any, this is the one lookup for the whole block.
+        auto s = m_cudaStream;
+        m_lease.reset(new WorkspaceLease(
+            WorkspaceCache::instance().get(m_plan.requirements(), std::nullopt, std::nullopt, std::nullopt, s, s, s)));
+    }
+
+    m_prev       = g_activePlan;
+    g_activePlan = this;
+    m_active     = true;
+}
+
+void PyWorkspacePlan::exit()
+{
+    if (!m_active)
+        throw std::runtime_error("The workspace plan is not active");
+    if (g_activePlan != this)
+        throw std::runtime_error("Workspace plans must be exited in the reverse order they were entered");
+
+    g_activePlan = m_prev;
+    m_prev       = nullptr;
+    m_active     = false;
+    m_lease.reset();
+}
+
+void PyWorkspacePlan::reset()
+{
+    if (m_active)
+        throw std::runtime_error("Cannot reset an active workspace plan");
+    m_plan.clear();
+}
+
+bool PyWorkspacePlan::GetStage(const cvcuda::WorkspaceRequirements &req, cudaStream_t stream,
+                               cvcuda::Workspace &view)
+{
+    return g_activePlan && g_activePlan->getStage(req, stream, view);
+}
+
+bool PyWorkspacePlan::getStage(const cvcuda::WorkspaceRequirements &req, cudaStream_t stream,
+                               cvcuda::Workspace &view)
+{
+    // The stages share the workspace, so they must be serialized on the plan's stream.
+    if (stream != m_cudaStream)
+        return false;
+
+    int stage = m_nextStage++;
+    if (stage < m_plan.numStages())
+        m_plan.setStageRequirements(stage, cvcuda::MaxWorkspaceReq(m_plan.stageRequirements(stage), req));
+    else
+        m_plan.addStage(req);
+
+    if (!m_lease || !cvcuda::WorkspacePlan::Fits(m_lease->get(), req))
+        return false;
+
+    view = cvcuda::WorkspacePlan::View(m_lease->get(), req);
+    return true;
+}
+
+void ExportWorkspacePlan(py::module &m)
+{
+    using namespace py::literals;
+
+    py::class_<PyWorkspacePlan>(m, "WorkspacePlan", R"pbdoc(
+        Shares one workspace among the operators called within a ``with`` block.
+
+        The first time the block is executed, the plan records the workspace requirements of each
+        operator called in it on the plan's stream. In the following executions, a single workspace
+        that covers all of them is obtained at the beginning of the block and each operator uses a
+        view of it, so the whole sequence of operators performs one workspace cache lookup.
+
+        Operators called on other streams, or whose requirements grew since they were recorded, use
+        the workspace cache as usual; the plan is updated to cover them the next time.
+
+        Example:
+            plan = cvcuda.WorkspacePlan()
+            for frame in frames:
+                with plan:
+                    resized = cvcuda.pillowresize(frame, shape, fmt)
+                    ...
+    )pbdoc")
+        .def(py::init<std::optional<nvcvpy::Stream>>(), "stream"_a = nullptr, R"pbdoc(
+            Creates a workspace plan.
+
+            Args:
+                stream (nvcv.cuda.Stream, optional): The stream on which the operators will be executed.
+                                                     Defaults to the current stream when the block is entered.
+        )pbdoc")
+        .def(
+            "__enter__",
+            [](PyWorkspacePlan &self) -> PyWorkspacePlan &
+            {
+                self.enter();
+                return self;
+            },
+            py::return_value_policy::reference, "Activates the plan for this thread.")
+        .def(
+            "__exit__", [](PyWorkspacePlan &self, py::object, py::object, py::object) { self.exit(); },
+            "Deactivates the plan and returns its workspace to the cache.")
+        .def("reset", &PyWorkspacePlan::reset, "Forgets the recorded stages.")
+        .def_property_readonly(
+            "num_stages", [](const PyWorkspacePlan &self) { return self.plan().numStages(); },
+            "Number of stages recorded by the plan.")
+        .def_property_readonly(
+            "requirements",
+            [](const PyWorkspacePlan &self)
+            {
+                cvcuda::WorkspaceRequirements req = self.plan().requirements();
+                return py::dict("host"_a = ToTuple(req.hostMem), "pinned"_a = ToTuple(req.pinnedMem),
+                                "cuda"_a = ToTuple(req.cudaMem));
+            },
+            "Merged requirements of all stages, as (size, alignment) tuples for each kind of memory.");
+}
+
+} // namespace cvcudapy
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_PYTHON_WORKSPACE_PLAN_HPP
+#define CVCUDA_PYTHON_WORKSPACE_PLAN_HPP
+
+#include "WorkspaceCache.hpp"
+
+#include <cvcuda/WorkspacePlan.hpp>
+#include <nvcv/python/Stream.hpp>
+#include <pybind11/pybind11.h>
+
+#include <memory>
+#include <optional>
+
+namespace cvcudapy {
+namespace py = ::pybind11;
+
+/** A workspace plan for the operators called within a `with` block.
+ *
+ * The plan learns the workspace requirements of the operators executed in the block, one stage per operator.
+ * The next time the block is entered, a single workspace covering all stages is obtained from the
+ * `WorkspaceCache` and the operators are given views into it, instead of each one doing its own lookup.
+ *
+ * Requests that don't fit in the planned workspace (e.g. because the input sizes grew), or are made on
+ * a stream other than the plan's, are served by the cache as usual and the plan is updated for the next time.
+ */
+class PyWorkspacePlan
+{
+public:
+    explicit PyWorkspacePlan(std::optional<nvcvpy::Stream> stream);
+
+    void enter();
+    void exit();
+
+    /** Obtains the workspace view for the next stage of the active plan.
+     *
+     * @return false if there's no active plan or the request can't be served from its workspace.
+     */
+    static bool GetStage(const cvcuda::WorkspaceRequirements &req, cudaStream_t stream, cvcuda::Workspace &view);
+
+    const cvcuda::WorkspacePlan &plan() const
+    {
+        return m_plan;
+    }
+
+    void reset();
+
+private:
+    cvcuda::WorkspacePlan           m_plan;
+    std::optional<nvcvpy::Stream>   m_stream;
+    cudaStream_t                    m_cudaStream = nullptr;
+    std::unique_ptr<WorkspaceLease> m_lease;
+    int                             m_nextStage = 0;
+    bool                            m_active    = false;
+    PyWorkspacePlan                *m_prev      = nullptr;
+
+    bool getStage(const cvcuda::WorkspaceRequirements &req, cudaStream_t stream, cvcuda::Workspace &view);
+};
+
+void ExportWorkspacePlan(py::module &m);
+
+} // namespace cvcudapy
+
+#endif // CVCUDA_PYTHON_WORKSPACE_PLAN_HPP
@@ -32,20 +32,17 @@ namespace nvcvpy::priv {
 
 std::shared_ptr<Array> Array::CreateFromReqs(const nvcv::Array::Requirements &reqs)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{reqs});
+    std::shared_ptr<Array> array = Cache::Instance().fetchOne<Array>(Key{reqs});
 
     // None found?
-    if (vcont.empty())
+    if (!array)
     {
-        std::shared_ptr<Array> array(new Array(reqs));
-        array->impl().resize(reqs.capacity);
-        Cache::Instance().add(*array);
-        return array;
+        std::unique_ptr<Array> newArray(new Array(reqs));
+        newArray->impl().resize(reqs.capacity);
+        return Cache::Instance().add(std::move(newArray));
     }
     else
     {
-        // Get the first one
-        auto array = std::static_pointer_cast<Array>(vcont[0]);
         NVCV_ASSERT(array->dtype() == reqs.dtype);
         return array;
     }
@@ -129,13 +126,10 @@ std::shared_ptr<Array> Array::Wrap(ExternalBuffer &buffer)
     // being used. They aren't reusable anyway.
     Cache::Instance().removeAllNotInUseMatching(key);
 
-    auto array = std::shared_ptr<Array>(new Array(data, py::cast(buffer.shared_from_this())));
-
     // Need to add wrappers to cache so that they don't get destroyed by
     // the cuda stream when they're last used, and python script isn't
     // holding a reference to them. If we don't do it, things might break.
-    Cache::Instance().add(*array);
-    return array;
+    return Cache::Instance().add(std::unique_ptr<Array>(new Array(data, py::cast(buffer.shared_from_this()))));
 }
 
 std::shared_ptr<Array> Array::ResizeArray(Array &array, int64_t length)
@@ -146,13 +140,10 @@ std::shared_ptr<Array> Array::ResizeArray(Array &array, int64_t length)
     auto array_impl = array.impl();
     array_impl.resize(length);
 
-    auto new_array = std::shared_ptr<Array>(new Array(std::move(array_impl)));
-
     // Need to add wrappers to cache so that they don't get destroyed by
     // the cuda stream when they're last used, and python script isn't
     // holding a reference to them. If we don't do it, things might break.
-    Cache::Instance().add(*new_array);
-    return new_array;
+    return Cache::Instance().add(std::unique_ptr<Array>(new Array(std::move(array_impl))));
 }
 
 std::shared_ptr<Array> Array::ResizeArray(Array &array, Shape shape)
@@ -174,6 +165,7 @@ Array::Array(const nvcv::Array::Requirements &reqs)
     : m_impl{reqs}
     , m_key{reqs}
 {
+    setSizeBytes(reqs.mem);
 }
 
 Array::Array(const nvcv::ArrayData &data, py::object wrappedObject)
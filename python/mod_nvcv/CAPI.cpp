@@ -234,8 +234,8 @@ extern "C" void ImplTensorBatch_Clear(PyObject *tensorBatch)
 
 extern "C" void ImplCache_Add(ICacheItem *extItem)
 {
-    auto item = std::make_shared<ExternalCacheItem>(extItem->shared_from_this());
-    Cache::Instance().add(*item);
+    // The item is released right away, it's fetched along with the other free items of its key.
+    Cache::Instance().add(std::make_unique<ExternalCacheItem>(extItem->shared_from_this()));
 }
 
 extern "C" ICacheItem **ImplCache_Fetch(const IKey *pkey)
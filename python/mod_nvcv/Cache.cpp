@@ -19,8 +19,15 @@
 
 #include <common/Assert.hpp>
 #include <common/PyUtil.hpp>
+#include <nvcv/alloc/Requirements.hpp>
+#include <pybind11/stl.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <list>
 #include <mutex>
+#include <stdexcept>
 #include <thread>
 #include <unordered_map>
 
@@ -47,7 +54,7 @@ struct KeyEqual
 
 CacheItem::CacheItem()
 {
-    static uint64_t idnext = 0;
+    static std::atomic<uint64_t> idnext{0};
 
     m_id = idnext++;
 }
@@ -67,115 +74,426 @@ std::shared_ptr<const CacheItem> CacheItem::shared_from_this() const
     return std::dynamic_pointer_cast<const CacheItem>(Object::shared_from_this());
 }
 
-bool CacheItem::isInUse() const
+int64_t CacheItem::sizeBytes() const
 {
-    std::shared_ptr<const CacheItem> sthis = this->shared_from_this();
+    return m_sizeBytes;
+}
 
-    // Return true if it is being used anywhere apart from cache and sthis
-    return sthis.use_count() > 2;
+void CacheItem::setSizeBytes(const NVCVRequirements &reqs)
+{
+    nvcv::Requirements r(reqs);
+    m_sizeBytes = nvcv::CalcTotalSizeBytes(r.cudaMem()) + nvcv::CalcTotalSizeBytes(r.hostMem())
+                + nvcv::CalcTotalSizeBytes(r.hostPinnedMem());
 }
 
 struct Cache::Impl
 {
-    std::mutex                                                                           mtx;
-    std::unordered_multimap<const IKey *, std::shared_ptr<CacheItem>, HashKey, KeyEqual> items;
+    using ItemList = std::list<CacheItem *>;
+
+    // Items with equal keys
+    struct Bucket
+    {
+        ItemList members; // the key of the first member is the bucket's key in the map
+        ItemList free;    // from the most to the least recently released
+    };
+
+    struct Entry
+    {
+        Bucket            *bucket;
+        ItemList::iterator memberPos;
+        bool               free = false;
+        ItemList::iterator freePos;     // valid if free
+        ItemList::iterator lruPos;      // valid if free
+        uint64_t           releaseTick; // valid if free
+    };
+
+    // Items are distributed among shards by their key's hash, each one with its own mutex,
+    // so that threads working with different keys don't contend.
+    //
+    // References to the items are created with the mutex locked, as they (re)bind the item's
+    // weak_from_this, which is read by doIterateThroughItems. The mutex is recursive because
+    // if creating the reference fails, its recycler is called right away.
+    struct Shard
+    {
+        std::recursive_mutex mtx;
+
+        std::unordered_map<const IKey *, std::unique_ptr<Bucket>, HashKey, KeyEqual> buckets;
+        std::unordered_map<CacheItem *, Entry>                                        entries;
+
+        // Free items of all buckets, from the most to the least recently released
+        ItemList lru;
+
+        CacheStats stats;
+    };
+
+    static constexpr int NUM_SHARDS = 16;
+
+    std::array<Shard, NUM_SHARDS> shards;
+
+    // Totals of all shards, to check the limits without locking every shard.
+    std::atomic<int64_t> totalBytes{0}, totalItems{0};
+
+    // Negative if there's no limit
+    std::atomic<int64_t> maxBytes{-1}, maxItems{-1};
+
+    // Orders releases across shards, for LRU eviction.
+    std::atomic<uint64_t> nextTick{0};
+
+    Shard &shardOf(const IKey &key)
+    {
+        return shards[key.hash() % NUM_SHARDS];
+    }
+
+    bool overLimits() const
+    {
+        int64_t mb = maxBytes.load(), mi = maxItems.load();
+        return (mb >= 0 && totalBytes.load() > mb) || (mi >= 0 && totalItems.load() > mi);
+    }
+
+    // The functions below require the shard's mutex to be locked.
+
+    void insert(Shard &shard, CacheItem *item)
+    {
+        auto itBucket = shard.buckets.find(&item->key());
+        if (itBucket == shard.buckets.end())
+        {
+            itBucket = shard.buckets.emplace(&item->key(), std::make_unique<Bucket>()).first;
+        }
+        Bucket *bucket = itBucket->second.get();
+
+        bucket->members.push_back(item);
+        shard.entries.emplace(item, Entry{bucket, std::prev(bucket->members.end())});
+
+        shard.stats.bytes += item->sizeBytes();
+        ++shard.stats.items;
+        totalBytes += item->sizeBytes();
+        ++totalItems;
+    }
+
+    void setFree(Shard &shard, Entry &e, CacheItem *item)
+    {
+        e.free        = true;
+        e.freePos     = e.bucket->free.insert(e.bucket->free.begin(), item);
+        e.lruPos      = shard.lru.insert(shard.lru.begin(), item);
+        e.releaseTick = nextTick++;
+    }
+
+    void setInUse(Shard &shard, Entry &e)
+    {
+        e.free = false;
+        e.bucket->free.erase(e.freePos);
+        shard.lru.erase(e.lruPos);
+    }
+
+    // Removes the item from the cache, moving it to 'hold' if it's free, so that it
+    // isn't destroyed while the mutex is locked. Items in use are deleted by the
+    // recycler when they're released.
+    void erase(Shard &shard, std::unordered_map<CacheItem *, Entry>::iterator itEntry,
+               std::vector<std::unique_ptr<CacheItem>> &hold)
+    {
+        CacheItem *item   = itEntry->first;
+        Entry     &e      = itEntry->second;
+        Bucket    *bucket = e.bucket;
+
+        if (e.free)
+        {
+            setInUse(shard, e);
+            hold.emplace_back(item);
+        }
+
+        bool isKeyItem = e.memberPos == bucket->members.begin();
+        bucket->members.erase(e.memberPos);
+        if (isKeyItem)
+        {
+            // The bucket's key belongs to the item being removed, re-key the
+            // bucket with the next member's key, or remove it if it's empty.
+            auto node = shard.buckets.extract(&item->key());
+            NVCV_ASSERT(!node.empty());
+            if (!bucket->members.empty())
+            {
+                node.key() = &bucket->members.front()->key();
+                shard.buckets.insert(std::move(node));
+            }
+        }
+
+        shard.stats.bytes -= item->sizeBytes();
+        --shard.stats.items;
+        totalBytes -= item->sizeBytes();
+        --totalItems;
+        shard.entries.erase(itEntry);
+    }
+
+    // Evicts the least recently released items of all shards while the cache is over its limits.
+    // Must be called with no shard mutex locked.
+    void evict()
+    {
+        while (overLimits())
+        {
+            Shard   *oldest     = nullptr;
+            uint64_t oldestTick = 0;
+            for (Shard &shard : shards)
+            {
+                std::unique_lock<std::recursive_mutex> lk(shard.mtx);
+                if (!shard.lru.empty())
+                {
+                    uint64_t tick = shard.entries.at(shard.lru.back()).releaseTick;
+                    if (oldest == nullptr || tick < oldestTick)
+                    {
+                        oldest     = &shard;
+                        oldestTick = tick;
+                    }
+                }
+            }
+
+            // Only items in use left?
+            if (oldest == nullptr)
+            {
+                break;
+            }
+
+            // Evicted items are destroyed after the mutex is unlocked, see removeAllNotInUseMatching.
+            std::vector<std::unique_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+
+            std::unique_lock<std::recursive_mutex> lk(oldest->mtx);
+            // It might have been taken by another thread in the meantime, in this case we just try again.
+            if (!oldest->lru.empty() && overLimits())
+            {
+                erase(*oldest, oldest->entries.find(oldest->lru.back()), holdItemsUntilMtxUnlocked);
+                ++oldest->stats.evictions;
+            }
+            lk.unlock();
+        }
+    }
+};
+
+// Deleter of the references handed out by the cache.
+class Cache::Recycler
+{
+public:
+    Recycler(std::weak_ptr<Impl> impl, Impl::Shard &shard)
+        : m_impl(std::move(impl))
+        , m_shard(&shard)
+    {
+    }
+
+    void operator()(CacheItem *item) const
+    {
+        // The cache might be gone already when the program is exiting.
+        if (std::shared_ptr<Impl> impl = m_impl.lock())
+        {
+            std::unique_lock<std::recursive_mutex> lk(m_shard->mtx);
+
+            auto itEntry = m_shard->entries.find(item);
+            if (itEntry != m_shard->entries.end())
+            {
+                impl->setFree(*m_shard, itEntry->second, item);
+                return;
+            }
+        }
+
+        // Not in the cache anymore (e.g. it was cleared while the item was in use).
+        delete item;
+    }
+
+private:
+    std::weak_ptr<Impl> m_impl;
+    Impl::Shard        *m_shard; // valid while m_impl is alive
 };
 
 Cache::Cache()
-    : pimpl(new Impl())
+    : pimpl(std::make_shared<Impl>())
 {
 }
 
-void Cache::add(CacheItem &item)
+std::shared_ptr<CacheItem> Cache::doAdd(std::unique_ptr<CacheItem> item)
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
+    Impl::Shard &shard = pimpl->shardOf(item->key());
+
+    std::shared_ptr<CacheItem> sitem;
+    {
+        std::unique_lock<std::recursive_mutex> lk(shard.mtx);
+
+        // From now on the item is owned by the cache. If creating the reference fails,
+        // the recycler makes it a free item.
+        CacheItem *pitem = item.release();
+        pimpl->insert(shard, pitem);
+        sitem = std::shared_ptr<CacheItem>(pitem, Recycler{pimpl, shard});
+    }
 
-    pimpl->items.emplace(&item.key(), item.shared_from_this());
+    pimpl->evict();
+    return sitem;
 }
 
 void Cache::removeAllNotInUseMatching(const IKey &key)
 {
-    // When we're removing items, we don't want their
-    // refcount getting to 0 while the mutex is locked, as
-    // deleting the object might recursively call removeAllNotInUseMatching,
-    // leading to a dead lock.
+    // When we're removing items, we don't want them to be
+    // destroyed while the mutex is locked, as deleting the
+    // object might recursively call removeAllNotInUseMatching,
+    // or release other items, leading to a dead lock.
     //
     // Instead, we gather the removed objects in the vector below, which will
-    // be destroyed after the mutex is unlocked. When this happens, the items'
-    // refcount will be decremented, and any object destruction will happen
-    // after the mutex is unlocked. Recursion can happen in this case, but won't
-    // lead to deadlocks
-    std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+    // be destroyed after the mutex is unlocked. Recursion can happen in this
+    // case, but won't lead to deadlocks
+    std::vector<std::unique_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
 
-    {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
+    Impl::Shard &shard = pimpl->shardOf(key);
 
-        auto itrange = pimpl->items.equal_range(&key);
+    {
+        std::unique_lock<std::recursive_mutex> lk(shard.mtx);
 
-        int numItems = std::distance(itrange.first, itrange.second);
+        auto itBucket = shard.buckets.find(&key);
+        if (itBucket == shard.buckets.end())
+        {
+            return;
+        }
 
-        auto it = itrange.first;
-        for (int i = 0; i < numItems; ++i)
+        // The bucket itself is destroyed when its last item is removed.
+        Impl::Bucket *bucket = itBucket->second.get();
+        while (!bucket->free.empty())
         {
-            if (!it->second->isInUse())
-            {
-                holdItemsUntilMtxUnlocked.push_back(it->second);
-                pimpl->items.erase(it++);
-            }
-            else
+            bool last = bucket->members.size() == 1;
+            pimpl->erase(shard, shard.entries.find(bucket->free.front()), holdItemsUntilMtxUnlocked);
+            if (last)
             {
-                ++it;
+                break;
             }
         }
     }
 }
 
-std::vector<std::shared_ptr<CacheItem>> Cache::fetch(const IKey &key) const
+std::shared_ptr<CacheItem> Cache::doFetchOne(const IKey &key)
 {
-    std::vector<std::shared_ptr<CacheItem>> v;
+    Impl::Shard &shard = pimpl->shardOf(key);
+
+    std::unique_lock<std::recursive_mutex> lk(shard.mtx);
+
+    auto itBucket = shard.buckets.find(&key);
+    if (itBucket != shard.buckets.end() && !itBucket->second->free.empty())
+    {
+        CacheItem *item = itBucket->second->free.front();
+        pimpl->setInUse(shard, shard.entries.at(item));
+        ++shard.stats.hits;
+        return std::shared_ptr<CacheItem>(item, Recycler{pimpl, shard});
+    }
+    else
+    {
+        ++shard.stats.misses;
+        return nullptr;
+    }
+}
 
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
+std::vector<std::shared_ptr<CacheItem>> Cache::fetch(const IKey &key)
+{
+    Impl::Shard &shard = pimpl->shardOf(key);
 
-    auto itrange = pimpl->items.equal_range(&key);
+    std::vector<std::shared_ptr<CacheItem>> v;
 
-    v.reserve(distance(itrange.first, itrange.second));
+    std::unique_lock<std::recursive_mutex> lk(shard.mtx);
 
-    for (auto it = itrange.first; it != itrange.second; ++it)
+    auto itBucket = shard.buckets.find(&key);
+    if (itBucket != shard.buckets.end())
     {
-        if (!it->second->isInUse())
+        Impl::ItemList &free = itBucket->second->free;
+
+        v.reserve(free.size());
+        while (!free.empty())
         {
-            v.emplace_back(it->second);
+            CacheItem *item = free.front();
+            pimpl->setInUse(shard, shard.entries.at(item));
+            v.emplace_back(item, Recycler{pimpl, shard});
         }
     }
 
+    if (v.empty())
+    {
+        ++shard.stats.misses;
+    }
+    else
+    {
+        ++shard.stats.hits;
+    }
+
+    // Unlock before the references are released, in case the vector has to be
+    // destroyed, e.g. when the caller throws.
+    lk.unlock();
     return v;
 }
 
 void Cache::clear()
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
-    pimpl->items.clear();
+    for (Impl::Shard &shard : pimpl->shards)
+    {
+        // Items are destroyed after the mutex is unlocked, see removeAllNotInUseMatching.
+        std::vector<std::unique_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+
+        std::unique_lock<std::recursive_mutex> lk(shard.mtx);
+
+        // Free items are destroyed, the ones in use will be when released.
+        while (!shard.entries.empty())
+        {
+            pimpl->erase(shard, shard.entries.begin(), holdItemsUntilMtxUnlocked);
+        }
+
+        lk.unlock();
+    }
 }
 
 size_t Cache::size()
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
-    return pimpl->items.size();
+    return pimpl->totalItems.load();
+}
+
+void Cache::setLimits(std::optional<int64_t> maxBytes, std::optional<int64_t> maxItems)
+{
+    if ((maxBytes && *maxBytes < 0) || (maxItems && *maxItems < 0))
+    {
+        throw std::invalid_argument("Cache limits must be non-negative");
+    }
+
+    pimpl->maxBytes = maxBytes.value_or(-1);
+    pimpl->maxItems = maxItems.value_or(-1);
+    pimpl->evict();
+}
+
+CacheStats Cache::stats() const
+{
+    CacheStats total;
+    for (Impl::Shard &shard : pimpl->shards)
+    {
+        std::unique_lock<std::recursive_mutex> lk(shard.mtx);
+        total.hits += shard.stats.hits;
+        total.misses += shard.stats.misses;
+        total.evictions += shard.stats.evictions;
+        total.items += shard.stats.items;
+        total.bytes += shard.stats.bytes;
+    }
+    return total;
 }
 
 void Cache::doIterateThroughItems(const std::function<void(CacheItem &item)> &fn) const
 {
-    // To avoid keeping mutex locked for too long, let's first gather all items
-    // into a vector, unlock the mutex, and then iterate through them.
+    // To avoid keeping mutexes locked for too long, let's first gather all items
+    // into a vector, unlock the mutexes, and then iterate through them.
     std::vector<std::shared_ptr<CacheItem>> v;
 
+    for (Impl::Shard &shard : pimpl->shards)
     {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
-        v.reserve(pimpl->items.size());
+        std::unique_lock<std::recursive_mutex> lk(shard.mtx);
+        v.reserve(v.size() + shard.entries.size());
 
-        for (auto it = pimpl->items.begin(); it != pimpl->items.end(); ++it)
+        for (auto &[item, e] : shard.entries)
         {
-            v.push_back(it->second);
+            if (e.free)
+            {
+                // Taken out of the cache while being iterated, it returns when released.
+                pimpl->setInUse(shard, e);
+                v.emplace_back(item, Recycler{pimpl, shard});
+            }
+            else if (std::shared_ptr<Object> obj = item->weak_from_this().lock())
+            {
+                // Items in use whose last reference is being released are skipped.
+                v.emplace_back(obj, item);
+            }
         }
     }
 
@@ -193,6 +511,8 @@ Cache &Cache::Instance()
 
 void Cache::Export(py::module &m)
 {
+    using namespace py::literals;
+
     py::class_<CacheItem, std::shared_ptr<CacheItem>>(nullptr, "CacheItem", py::module_local());
 
     py::class_<ExternalCacheItem, CacheItem, std::shared_ptr<ExternalCacheItem>>(nullptr, "ExternalCacheItem",
@@ -212,6 +532,31 @@ void Cache::Export(py::module &m)
         "cache_size", [] { return Cache::Instance().size(); },
         "Returns the quantity of items in the NVCV Python cache");
 
+    m.def(
+        "set_cache_limit", [](std::optional<int64_t> bytes, std::optional<int64_t> items)
+        { Cache::Instance().setLimits(bytes, items); },
+        "bytes"_a = nullptr, "items"_a = nullptr, R"pbdoc(
+        Limits the memory and the number of items held by the NVCV Python cache.
+
+        Objects not in use are evicted in least-recently-used order when the cache exceeds
+        the limits. Objects in use are never evicted.
+
+        Args:
+            bytes (int, optional): Maximum number of bytes allocated by the cached objects,
+                                   as given by their memory requirements. No limit if None.
+            items (int, optional): Maximum number of cached objects. No limit if None.
+        )pbdoc");
+
+    m.def(
+        "cache_stats",
+        []
+        {
+            CacheStats stats = Cache::Instance().stats();
+            return py::dict("hits"_a = stats.hits, "misses"_a = stats.misses, "evictions"_a = stats.evictions,
+                            "items"_a = stats.items, "bytes"_a = stats.bytes);
+        },
+        "Returns the hit, miss and eviction counters of the NVCV Python cache, and its current items and bytes");
+
     // Just to check if fetchAll compiles, it's harmless
     Cache::Instance().fetchAll<Cache>();
 }
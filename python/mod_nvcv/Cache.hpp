@@ -21,9 +21,14 @@
 #include "Object.hpp"
 
 #include <common/Hash.hpp>
+#include <nvcv/alloc/Requirements.h>
 #include <nvcv/python/Cache.hpp>
 #include <pybind11/pybind11.h>
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <vector>
 
 namespace nvcvpy::priv {
@@ -40,13 +45,21 @@ public:
     std::shared_ptr<CacheItem>       shared_from_this();
     std::shared_ptr<const CacheItem> shared_from_this() const;
 
-    bool isInUse() const;
+    /** Bytes of memory allocated by the item, counted against the cache's byte budget.
+     *
+     * Wrappers don't own their memory, their size is 0.
+     */
+    int64_t sizeBytes() const;
 
 protected:
     CacheItem();
 
+    // Sets the item size from the requirements used to allocate it.
+    void setSizeBytes(const NVCVRequirements &reqs);
+
 private:
     uint64_t m_id;
+    int64_t  m_sizeBytes = 0;
 };
 
 class ExternalCacheItem : public CacheItem
@@ -65,6 +78,29 @@ public:
     }
 };
 
+struct CacheStats
+{
+    int64_t hits      = 0; // fetches that found a free item
+    int64_t misses    = 0; // fetches that didn't find any
+    int64_t evictions = 0; // items removed to keep the cache within its limits
+    int64_t items     = 0;
+    int64_t bytes     = 0;
+};
+
+/** Cache of python objects that can be reused.
+ *
+ * The cache owns the items that aren't in use, in free lists indexed by the items' keys. Items are handed out
+ * in shared pointers whose deleter returns them to the free list once their last reference is released,
+ * be it from python or from a stream holding on to them, so fetching a free item is a pop from the
+ * free list of its key.
+ *
+ * Free items are evicted in least-recently-released order when the cache exceeds its limits on the
+ * number of items or the bytes allocated by them. Items in use are never evicted, so the cache may
+ * temporarily exceed its limits. By default the cache is unbounded.
+ *
+ * Items are spread among shards by the hash of their keys, each shard with its own mutex, so that
+ * threads using different keys don't contend. The limits apply to the whole cache.
+ */
 class PYBIND11_EXPORT Cache
 {
 public:
@@ -72,10 +108,35 @@ public:
 
     static Cache &Instance();
 
-    void add(CacheItem &container);
+    /** Adds a new item to the cache.
+     *
+     * @return The reference to be handed out. The item returns to the cache when it's released.
+     */
+    template<class T>
+    std::shared_ptr<T> add(std::unique_ptr<T> item)
+    {
+        T *p = item.get();
+        return std::shared_ptr<T>(doAdd(std::move(item)), p);
+    }
+
+    /** Removes the free items matching the key. */
     void removeAllNotInUseMatching(const IKey &key);
 
-    std::vector<std::shared_ptr<CacheItem>> fetch(const IKey &key) const;
+    /** Takes one free item matching the key out of the cache.
+     *
+     * @return The item, or null if there's no free item matching the key.
+     */
+    template<class T>
+    std::shared_ptr<T> fetchOne(const IKey &key)
+    {
+        return std::static_pointer_cast<T>(doFetchOne(key));
+    }
+
+    /** Takes all free items matching the key out of the cache.
+     *
+     * The ones that aren't used return to the cache once the returned references are released.
+     */
+    std::vector<std::shared_ptr<CacheItem>> fetch(const IKey &key);
 
     template<class T>
     std::vector<std::shared_ptr<T>> fetchAll() const
@@ -96,12 +157,25 @@ public:
     void   clear();
     size_t size();
 
+    /** Sets the maximum number of bytes and items held by the cache, or no limit if not set.
+     *
+     * Items are evicted right away if the cache exceeds the new limits.
+     */
+    void setLimits(std::optional<int64_t> maxBytes, std::optional<int64_t> maxItems);
+
+    CacheStats stats() const;
+
 private:
     struct Impl;
-    std::unique_ptr<Impl> pimpl;
+    std::shared_ptr<Impl> pimpl;
+
+    class Recycler;
 
     Cache();
 
+    std::shared_ptr<CacheItem> doAdd(std::unique_ptr<CacheItem> item);
+    std::shared_ptr<CacheItem> doFetchOne(const IKey &key);
+
     void doIterateThroughItems(const std::function<void(CacheItem &item)> &fn) const;
 };
 
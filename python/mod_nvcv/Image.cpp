@@ -452,10 +452,14 @@ nvcv::ImageDataStridedHost CreateNVCVImageDataHost(const std::vector<DLPackTenso
 } // namespace
 
 Image::Image(const Size2D &size, nvcv::ImageFormat fmt, int rowAlign)
-    : m_impl(nvcv::Size2D{std::get<0>(size), std::get<1>(size)}, fmt, nullptr /* allocator */,
-             rowAlign == 0 ? nvcv::MemAlignment{} : nvcv::MemAlignment{}.rowAddr(rowAlign))
-    , m_key{size, fmt}
+    : m_key{size, fmt}
 {
+    nvcv::MemAlignment bufAlign = rowAlign == 0 ? nvcv::MemAlignment{} : nvcv::MemAlignment{}.rowAddr(rowAlign);
+
+    nvcv::Image::Requirements reqs
+        = nvcv::Image::CalcRequirements(nvcv::Size2D{std::get<0>(size), std::get<1>(size)}, fmt, bufAlign);
+    m_impl = nvcv::Image(reqs);
+    setSizeBytes(reqs.mem);
 }
 
 Image::Image(std::vector<std::shared_ptr<ExternalBuffer>> bufs, const nvcv::ImageDataStridedCuda &imgData)
@@ -493,8 +497,10 @@ Image::Image(std::vector<py::buffer> bufs, const nvcv::ImageDataStridedHost &hos
     // We'll create a regular image and copy the host data into it.
 
     // Create the image with same size and format as host data
-    m_impl = nvcv::Image(hostData.size(), hostData.format(), nullptr /* allocator */,
-                         nvcv::MemAlignment{}.rowAddr(rowAlign));
+    nvcv::Image::Requirements reqs
+        = nvcv::Image::CalcRequirements(hostData.size(), hostData.format(), nvcv::MemAlignment{}.rowAddr(rowAlign));
+    m_impl = nvcv::Image(reqs);
+    setSizeBytes(reqs.mem);
 
     auto devData = *m_impl.exportData<nvcv::ImageDataStridedCuda>();
     NVCV_ASSERT(hostData.format() == devData.format());
@@ -532,19 +538,16 @@ std::shared_ptr<const Image> Image::shared_from_this() const
 
 std::shared_ptr<Image> Image::Create(const Size2D &size, nvcv::ImageFormat fmt, int rowAlign)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{size, fmt});
+    std::shared_ptr<Image> img = Cache::Instance().fetchOne<Image>(Key{size, fmt});
 
     // None found?
-    if (vcont.empty())
+    if (!img)
     {
-        std::shared_ptr<Image> img(new Image(size, fmt, rowAlign));
-        Cache::Instance().add(*img);
-        return img;
+        return Cache::Instance().add(std::unique_ptr<Image>(new Image(size, fmt, rowAlign)));
     }
     else
     {
-        // Get the first one
-        return std::static_pointer_cast<Image>(vcont[0]);
+        return img;
     }
 }
 
@@ -601,9 +604,7 @@ std::shared_ptr<Image> Image::WrapExternalBufferVector(std::vector<py::object> b
     // Need to add wrappers to cache so that they don't get destroyed by
     // the cuda stream when they're last used, and python script isn't
     // holding a reference to them. If we don't do it, things might break.
-    std::shared_ptr<Image> img(new Image(std::move(spBuffers), imgData));
-    Cache::Instance().add(*img);
-    return img;
+    return Cache::Instance().add(std::unique_ptr<Image>(new Image(std::move(spBuffers), imgData)));
 }
 
 std::shared_ptr<Image> Image::CreateHost(py::buffer buffer, nvcv::ImageFormat fmt, int rowAlign)
@@ -627,9 +628,7 @@ std::shared_ptr<Image> Image::CreateHostVector(std::vector<py::buffer> buffers,
     Image::Key key;
     Cache::Instance().removeAllNotInUseMatching(key);
 
-    std::shared_ptr<Image> img(new Image(std::move(buffers), imgData, rowAlign));
-    Cache::Instance().add(*img);
-    return img;
+    return Cache::Instance().add(std::unique_ptr<Image>(new Image(std::move(buffers), imgData, rowAlign)));
 }
 
 Size2D Image::size() const
@@ -39,19 +39,15 @@ bool ImageBatchVarShape::Key::doIsCompatible(const IKey &ithat) const
 
 std::shared_ptr<ImageBatchVarShape> ImageBatchVarShape::Create(int capacity)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{capacity});
+    std::shared_ptr<ImageBatchVarShape> batch = Cache::Instance().fetchOne<ImageBatchVarShape>(Key{capacity});
 
     // None found?
-    if (vcont.empty())
+    if (!batch)
     {
-        std::shared_ptr<ImageBatchVarShape> batch(new ImageBatchVarShape(capacity));
-        Cache::Instance().add(*batch);
-        return batch;
+        return Cache::Instance().add(std::unique_ptr<ImageBatchVarShape>(new ImageBatchVarShape(capacity)));
     }
     else
     {
-        // Get the first one
-        auto batch = std::static_pointer_cast<ImageBatchVarShape>(vcont[0]);
         batch->clear(); // make sure it's in pristine state
         return batch;
     }
@@ -79,6 +75,7 @@ ImageBatchVarShape::ImageBatchVarShape(int capacity)
     , m_impl(capacity)
 {
     m_list.reserve(capacity);
+    setSizeBytes(nvcv::ImageBatchVarShape::CalcRequirements(capacity).mem);
 }
 
 const nvcv::ImageBatchVarShape &ImageBatchVarShape::impl() const
@@ -24,6 +24,7 @@
 #include "Image.hpp"
 #include "ImageBatch.hpp"
 #include "ImageFormat.hpp"
+#include "ObjectStats.hpp"
 #include "Rect.hpp"
 #include "Resource.hpp"
 #include "Stream.hpp"
@@ -60,6 +61,7 @@ PYBIND11_MODULE(nvcv, m)
     ExportImageFormat(m);
     ExportDataType(m);
     ExportRect(m);
+    ExportObjectStats(m);
     Resource::Export(m);
     Container::Export(m);
     Tensor::Export(m);
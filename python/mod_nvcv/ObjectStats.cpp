@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ObjectStats.hpp"
+
+#include <nvcv/Config.hpp>
+
+namespace nvcvpy::priv {
+
+namespace {
+
+py::dict ToDict(const NVCVObjectCounts &counts)
+{
+    using namespace py::literals;
+
+    return py::dict("live"_a = counts.liveCount, "peak"_a = counts.peakCount, "capacity"_a = counts.capacity,
+                    "pool_growths"_a = counts.poolGrowths);
+}
+
+py::dict ToDict(const NVCVMemoryCounts &counts)
+{
+    using namespace py::literals;
+
+    return py::dict("bytes"_a = counts.bytesInUse, "peak_bytes"_a = counts.peakBytes, "allocs"_a = counts.numAllocs);
+}
+
+} // namespace
+
+void ExportObjectStats(py::module &m)
+{
+    using namespace py::literals;
+
+    m.def(
+        "object_stats",
+        []
+        {
+            NVCVObjectStats stats = nvcv::cfg::GetObjectStats();
+            return py::dict("images"_a = ToDict(stats.images), "image_batches"_a = ToDict(stats.imageBatches),
+                            "tensors"_a = ToDict(stats.tensors), "tensor_batches"_a = ToDict(stats.tensorBatches),
+                            "arrays"_a = ToDict(stats.arrays), "allocators"_a = ToDict(stats.allocators),
+                            "host_mem"_a = ToDict(stats.hostMem), "host_pinned_mem"_a = ToDict(stats.hostPinnedMem),
+                            "cuda_mem"_a = ToDict(stats.cudaMem));
+        },
+        R"pbdoc(
+        Returns statistics about the NVCV objects alive and the memory they allocated.
+
+        For each object type ('images', 'image_batches', 'tensors', 'tensor_batches',
+        'arrays' and 'allocators'), gives the number of 'live' objects, the 'peak'
+        number of objects alive at the same time, the 'capacity' of handles reserved
+        and how many times the handle pool had to grow ('pool_growths').
+
+        For each memory type ('host_mem', 'host_pinned_mem' and 'cuda_mem'), gives the
+        'bytes' currently allocated, the 'peak_bytes' allocated at the same time and the
+        number of allocations done ('allocs').
+
+        Objects kept in the NVCV Python cache are counted as alive.
+        )pbdoc");
+}
+
+} // namespace nvcvpy::priv
@@ -174,19 +174,16 @@ bool Stream::Key::doIsCompatible(const IKey &that) const
 
 std::shared_ptr<Stream> Stream::Create()
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Stream::Key{});
+    std::shared_ptr<Stream> stream = Cache::Instance().fetchOne<Stream>(Stream::Key{});
 
     // None found?
-    if (vcont.empty())
+    if (!stream)
     {
-        std::shared_ptr<Stream> stream(new Stream());
-        Cache::Instance().add(*stream);
-        return stream;
+        return Cache::Instance().add(std::unique_ptr<Stream>(new Stream()));
     }
     else
     {
-        // Get the first one
-        return std::static_pointer_cast<Stream>(vcont[0]);
+        return stream;
     }
 }
 
@@ -314,7 +311,7 @@ void Stream::Export(py::module &m)
     // It'll be destroyed when python module is deinitialized.
     static priv::ExternalStream<priv::VOIDP> cudaDefaultStream((cudaStream_t)0);
     auto                                     globalStream = std::make_shared<Stream>(cudaDefaultStream);
-    StreamStack::Instance().push(*globalStream);
+    StreamStack::Instance().setDefault(globalStream);
     stream.attr("default") = globalStream;
 
     // Order from most specific to less specific
@@ -341,19 +338,16 @@ void Stream::Export(py::module &m)
                               }
                               globalStream->sync();
 
-                              // There should only be 1 stream in the stack, namely the
-                              // global stream.
-                              auto s = StreamStack::Instance().top();
-                              if (s != globalStream)
+                              // All streams activated by the main thread should have been
+                              // deactivated by now.
+                              if (StreamStack::Instance().size() != 0)
                               {
                                   std::cerr << "Stream stack leak detected" << std::endl;
                               }
 
                               // Make sure stream stack is empty
-                              while (auto s = StreamStack::Instance().top())
-                              {
-                                  StreamStack::Instance().pop();
-                              }
+                              StreamStack::Instance().clear();
+                              StreamStack::Instance().setDefault(nullptr);
                           });
 }
 
@@ -21,31 +21,54 @@
 
 namespace nvcvpy::priv {
 
+std::stack<std::weak_ptr<Stream>> &StreamStack::ThreadStack()
+{
+    thread_local std::stack<std::weak_ptr<Stream>> stack;
+    return stack;
+}
+
 void StreamStack::push(Stream &stream)
 {
-    std::unique_lock lk(m_mtx);
-    m_stack.push(stream.shared_from_this());
+    ThreadStack().push(stream.shared_from_this());
 }
 
 void StreamStack::pop()
 {
-    std::unique_lock lk(m_mtx);
-    m_stack.pop();
+    ThreadStack().pop();
 }
 
 std::shared_ptr<Stream> StreamStack::top()
 {
-    std::unique_lock lk(m_mtx);
-    if (!m_stack.empty())
+    std::stack<std::weak_ptr<Stream>> &stack = ThreadStack();
+    if (!stack.empty())
     {
-        return m_stack.top().lock();
+        return stack.top().lock();
     }
     else
     {
-        return nullptr;
+        return std::atomic_load(&m_default);
     }
 }
 
+size_t StreamStack::size() const
+{
+    return ThreadStack().size();
+}
+
+void StreamStack::clear()
+{
+    std::stack<std::weak_ptr<Stream>> &stack = ThreadStack();
+    while (!stack.empty())
+    {
+        stack.pop();
+    }
+}
+
+void StreamStack::setDefault(std::shared_ptr<Stream> stream)
+{
+    std::atomic_store(&m_default, std::move(stream));
+}
+
 StreamStack &StreamStack::Instance()
 {
     static StreamStack stack;
@@ -19,13 +19,14 @@
 #define NVCV_PYTHON_PRIV_STREAMSTACK_HPP
 
 #include <memory>
-#include <mutex>
 #include <stack>
 
 namespace nvcvpy::priv {
 
 class Stream;
 
+// Stack of streams activated by the calling thread. Each thread has its own stack,
+// so no locking is needed. When a thread's stack is empty, the default stream is used.
 class StreamStack
 {
 public:
@@ -33,12 +34,21 @@ public:
     void                    pop();
     std::shared_ptr<Stream> top();
 
+    // Number of streams activated by the calling thread.
+    size_t size() const;
+
+    // Clears the calling thread's stack.
+    void clear();
+
+    // Stream used by all threads when they haven't activated any.
+    void setDefault(std::shared_ptr<Stream> stream);
+
     static StreamStack &Instance();
 
 private:
-    std::stack<std::weak_ptr<Stream>> m_stack;
-    std::weak_ptr<Stream>             m_cur;
-    std::mutex                        m_mtx;
+    std::shared_ptr<Stream> m_default; // accessed with atomic_load/atomic_store
+
+    static std::stack<std::weak_ptr<Stream>> &ThreadStack();
 };
 
 } // namespace nvcvpy::priv
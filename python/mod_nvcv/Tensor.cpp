@@ -68,19 +68,15 @@ std::shared_ptr<Tensor> Tensor::Create(Shape shape, nvcv::DataType dtype, std::o
 
 std::shared_ptr<Tensor> Tensor::CreateFromReqs(const nvcv::Tensor::Requirements &reqs)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{reqs});
+    std::shared_ptr<Tensor> tensor = Cache::Instance().fetchOne<Tensor>(Key{reqs});
 
     // None found?
-    if (vcont.empty())
+    if (!tensor)
     {
-        std::shared_ptr<Tensor> tensor(new Tensor(reqs));
-        Cache::Instance().add(*tensor);
-        return tensor;
+        return Cache::Instance().add(std::unique_ptr<Tensor>(new Tensor(reqs)));
     }
     else
     {
-        // Get the first one
-        auto tensor = std::static_pointer_cast<Tensor>(vcont[0]);
         NVCV_ASSERT(tensor->dtype() == reqs.dtype);
         return tensor;
     }
@@ -162,13 +158,10 @@ std::shared_ptr<Tensor> Tensor::Wrap(ExternalBuffer &buffer, std::optional<nvcv:
     // being used. They aren't reusable anyway.
     Cache::Instance().removeAllNotInUseMatching(key);
 
-    auto tensor = std::shared_ptr<Tensor>(new Tensor(data, py::cast(buffer.shared_from_this())));
-
     // Need to add wrappers to cache so that they don't get destroyed by
     // the cuda stream when they're last used, and python script isn't
     // holding a reference to them. If we don't do it, things might break.
-    Cache::Instance().add(*tensor);
-    return tensor;
+    return Cache::Instance().add(std::unique_ptr<Tensor>(new Tensor(data, py::cast(buffer.shared_from_this()))));
 }
 
 std::shared_ptr<Tensor> Tensor::WrapImage(Image &img)
@@ -176,10 +169,7 @@ std::shared_ptr<Tensor> Tensor::WrapImage(Image &img)
     Tensor::Key key;
     Cache::Instance().removeAllNotInUseMatching(key);
 
-    auto tensor = std::shared_ptr<Tensor>(new Tensor(img));
-
-    Cache::Instance().add(*tensor);
-    return tensor;
+    return Cache::Instance().add(std::unique_ptr<Tensor>(new Tensor(img)));
 }
 
 std::shared_ptr<Tensor> Tensor::ReshapeTensor(Tensor &tensor, Shape shape, std::optional<nvcv::TensorLayout> layout)
@@ -190,13 +180,11 @@ std::shared_ptr<Tensor> Tensor::ReshapeTensor(Tensor &tensor, Shape shape, std::
     nvcv::Tensor tensor_impl      = tensor.impl();
     auto         new_tensor_shape = CreateNVCVTensorShape(shape, layout ? *layout : tensor_impl.layout());
     nvcv::Tensor new_tensor_impl  = tensor_impl.reshape(std::move(new_tensor_shape));
-    auto         new_tensor       = std::shared_ptr<Tensor>(new Tensor(std::move(new_tensor_impl)));
 
     // Need to add wrappers to cache so that they don't get destroyed by
     // the cuda stream when they're last used, and python script isn't
     // holding a reference to them. If we don't do it, things might break.
-    Cache::Instance().add(*new_tensor);
-    return new_tensor;
+    return Cache::Instance().add(std::unique_ptr<Tensor>(new Tensor(std::move(new_tensor_impl))));
 }
 
 std::shared_ptr<Tensor> Tensor::Reshape(Shape shape, std::optional<nvcv::TensorLayout> layout)
@@ -208,6 +196,7 @@ Tensor::Tensor(const nvcv::Tensor::Requirements &reqs)
     : m_impl{reqs}
     , m_key{reqs}
 {
+    setSizeBytes(reqs.mem);
 }
 
 Tensor::Tensor(const nvcv::TensorData &data, py::object wrappedObject)
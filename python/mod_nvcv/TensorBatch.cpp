@@ -40,19 +40,15 @@ bool TensorBatch::Key::doIsCompatible(const IKey &ithat) const
 
 std::shared_ptr<TensorBatch> TensorBatch::Create(int capacity)
 {
-    std::vector<std::shared_ptr<CacheItem>> vcont = Cache::Instance().fetch(Key{capacity});
+    std::shared_ptr<TensorBatch> batch = Cache::Instance().fetchOne<TensorBatch>(Key{capacity});
 
     // None found?
-    if (vcont.empty())
+    if (!batch)
     {
-        std::shared_ptr<TensorBatch> batch(new TensorBatch(capacity));
-        Cache::Instance().add(*batch);
-        return batch;
+        return Cache::Instance().add(std::unique_ptr<TensorBatch>(new TensorBatch(capacity)));
     }
     else
     {
-        // Get the first one
-        auto batch = std::static_pointer_cast<TensorBatch>(vcont[0]);
         batch->clear(); // make sure it's in pristine state
         return batch;
     }
@@ -83,6 +79,7 @@ TensorBatch::TensorBatch(int capacity)
     , m_impl(capacity)
 {
     m_list.reserve(capacity);
+    setSizeBytes(nvcv::TensorBatch::CalcRequirements(capacity).mem);
 }
 
 const nvcv::TensorBatch &TensorBatch::impl() const
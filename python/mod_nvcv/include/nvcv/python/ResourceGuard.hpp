@@ -23,6 +23,9 @@
 #include "Resource.hpp"
 #include "Stream.hpp"
 
+#include <type_traits>
+#include <vector>
+
 namespace nvcvpy {
 
 namespace py = pybind11;
@@ -42,29 +45,24 @@ public:
 
     ResourceGuard &add(LockMode mode, std::initializer_list<std::reference_wrapper<const Resource>> resources)
     {
-        py::object pyLockMode;
-        switch (mode)
-        {
-        case LockMode::LOCK_NONE:
-            pyLockMode = py::str("");
-            break;
-        case LockMode::LOCK_READ:
-            pyLockMode = py::str("r");
-            break;
-        case LockMode::LOCK_WRITE:
-            pyLockMode = py::str("w");
-            break;
-        case LockMode::LOCK_READWRITE:
-            pyLockMode = py::str("rw");
-            break;
-        }
+        py::object pyLockMode = ToPyLockMode(mode);
 
         for (const std::reference_wrapper<const Resource> &r : resources)
         {
-            py::object pyRes = r.get();
+            addOne(pyLockMode, r.get());
+        }
+        return *this;
+    }
 
-            capi().Resource_SubmitSync(pyRes.ptr(), m_pyStream.ptr(), pyLockMode.ptr());
-            m_resourcesPerLockMode.append(std::make_pair(pyLockMode, std::move(pyRes)));
+    // Adds a list of resources, e.g. when an operator is called on several of them at once.
+    template<class T, class = std::enable_if_t<std::is_base_of_v<Resource, T>>>
+    ResourceGuard &add(LockMode mode, const std::vector<T> &resources)
+    {
+        py::object pyLockMode = ToPyLockMode(mode);
+
+        for (const Resource &r : resources)
+        {
+            addOne(pyLockMode, r);
         }
         return *this;
     }
@@ -102,6 +100,30 @@ public:
     }
 
 private:
+    static py::object ToPyLockMode(LockMode mode)
+    {
+        switch (mode)
+        {
+        case LockMode::LOCK_NONE:
+            return py::str("");
+        case LockMode::LOCK_READ:
+            return py::str("r");
+        case LockMode::LOCK_WRITE:
+            return py::str("w");
+        case LockMode::LOCK_READWRITE:
+            return py::str("rw");
+        }
+        return py::object();
+    }
+
+    void addOne(const py::object &pyLockMode, const Resource &r)
+    {
+        py::object pyRes = r;
+
+        capi().Resource_SubmitSync(pyRes.ptr(), m_pyStream.ptr(), pyLockMode.ptr());
+        m_resourcesPerLockMode.append(std::make_pair(pyLockMode, std::move(pyRes)));
+    }
+
     py::object m_pyStream;
     py::object m_pyLockMode;
     py::list   m_resourcesPerLockMode;
@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDAERATORS_WORKSPACE_PLAN_HPP
+#define CVCUDAERATORS_WORKSPACE_PLAN_HPP
+
+#include "Workspace.hpp"
+
+#include <nvcv/Exception.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace cvcuda {
+
+/** Plans a single workspace for a sequence of operators.
+ *
+ * Operators executed one after another on the same stream can share their workspace, since each of them
+ * is done with it by the time the next one starts. The plan collects the requirements of each stage and
+ * merges them into requirements that cover all of them, so that a single workspace is allocated (or obtained
+ * from a cache) for the whole sequence. Each stage is then given a view of that workspace.
+ *
+ * Example:
+ * @code{.cpp}
+ *   cvcuda::WorkspacePlan plan;
+ *   int resizeStage     = plan.addStage(resize.getWorkspaceRequirements(...));
+ *   int homographyStage = plan.addStage(findHomography.getWorkspaceRequirements(...));
+ *
+ *   auto ws = cvcuda::AllocateWorkspace(plan.requirements());
+ *   resize(stream, plan.stageView(ws.get(), resizeStage), ...);
+ *   findHomography(stream, plan.stageView(ws.get(), homographyStage), ...);
+ * @endcode
+ *
+ * @remark The views share the memory and the `ready` events of the workspace, so the stages must not run
+ *         concurrently.
+ */
+class WorkspacePlan
+{
+public:
+    /** Adds a stage with the given requirements.
+     *
+     * @return The index of the new stage.
+     */
+    int addStage(const WorkspaceRequirements &req)
+    {
+        m_stages.push_back(req);
+        return static_cast<int>(m_stages.size()) - 1;
+    }
+
+    /** Replaces the requirements of an existing stage, e.g. when its input sizes changed. */
+    void setStageRequirements(int stage, const WorkspaceRequirements &req)
+    {
+        checkStage(stage);
+        m_stages[stage] = req;
+    }
+
+    int numStages() const
+    {
+        return static_cast<int>(m_stages.size());
+    }
+
+    const WorkspaceRequirements &stageRequirements(int stage) const
+    {
+        checkStage(stage);
+        return m_stages[stage];
+    }
+
+    void clear()
+    {
+        m_stages.clear();
+    }
+
+    /** Computes the requirements of a workspace that can be used by all stages.
+     *
+     * For each kind of memory, the size is the largest size of all stages and the alignment is the least common
+     * multiple of their alignments. The size is rounded up to a multiple of the alignment.
+     */
+    WorkspaceRequirements requirements() const
+    {
+        WorkspaceRequirements ret{{0, 1}, {0, 1}, {0, 1}};
+        for (const WorkspaceRequirements &req : m_stages)
+        {
+            Merge(ret.hostMem, req.hostMem);
+            Merge(ret.pinnedMem, req.pinnedMem);
+            Merge(ret.cudaMem, req.cudaMem);
+        }
+        RoundUp(ret.hostMem);
+        RoundUp(ret.pinnedMem);
+        RoundUp(ret.cudaMem);
+        return ret;
+    }
+
+    /** Returns the view of a workspace to be passed to the given stage.
+     *
+     * @param ws    A workspace that satisfies `requirements()`
+     * @param stage The index of the stage
+     *
+     * @throw nvcv::Exception with `NVCV_ERROR_INVALID_ARGUMENT` if the workspace can't be used by the stage.
+     */
+    Workspace stageView(const Workspace &ws, int stage) const
+    {
+        checkStage(stage);
+        return View(ws, m_stages[stage]);
+    }
+
+    /** Checks whether the memory satisfies the requirements. */
+    static bool Fits(const WorkspaceMem &mem, const WorkspaceMemRequirements &req)
+    {
+        if (req.size == 0)
+            return true;
+        if (!mem.data || mem.req.size < req.size)
+            return false;
+        return req.alignment == 0 || reinterpret_cast<std::uintptr_t>(mem.data) % req.alignment == 0;
+    }
+
+    static bool Fits(const Workspace &ws, const WorkspaceRequirements &req)
+    {
+        return Fits(ws.hostMem, req.hostMem) && Fits(ws.pinnedMem, req.pinnedMem) && Fits(ws.cudaMem, req.cudaMem);
+    }
+
+    /** Returns a view of the workspace with the given requirements.
+     *
+     * The view starts at the beginning of the workspace memory; kinds of memory that aren't required
+     * are left empty.
+     *
+     * @throw nvcv::Exception with `NVCV_ERROR_INVALID_ARGUMENT` if the workspace doesn't satisfy the requirements.
+     */
+    static Workspace View(const Workspace &ws, const WorkspaceRequirements &req)
+    {
+        return {View(ws.hostMem, req.hostMem, "host"), View(ws.pinnedMem, req.pinnedMem, "pinned"),
+                View(ws.cudaMem, req.cudaMem, "device")};
+    }
+
+private:
+    std::vector<WorkspaceRequirements> m_stages;
+
+    void checkStage(int stage) const
+    {
+        if (stage < 0 || stage >= numStages())
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid workspace plan stage %d", stage);
+    }
+
+    static void Merge(WorkspaceMemRequirements &acc, const WorkspaceMemRequirements &req)
+    {
+        if (req.size > acc.size)
+            acc.size = req.size;
+        if (req.alignment > 0)
+            acc.alignment = acc.alignment / Gcd(acc.alignment, req.alignment) * req.alignment;
+    }
+
+    // std::gcd is C++17, this header must stay C++11-compatible
+    static size_t Gcd(size_t a, size_t b)
+    {
+        while (b != 0)
+        {
+            size_t r = a % b;
+            a        = b;
+            b        = r;
+        }
+        return a;
+    }
+
+    static void RoundUp(WorkspaceMemRequirements &req)
+    {
+        req.size = (req.size + req.alignment - 1) / req.alignment * req.alignment;
+    }
+
+    static WorkspaceMem View(const WorkspaceMem &mem, const WorkspaceMemRequirements &req, const char *kind)
+    {
+        if (req.size == 0)
+            return {req, nullptr, nullptr};
+
+        if (!Fits(mem, req))
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "The %s memory of the workspace doesn't satisfy the stage requirements", kind);
+
+        return {req, mem.data, mem.ready};
+    }
+};
+
+} // namespace cvcuda
+
+#endif // CVCUDAERATORS_WORKSPACE_PLAN_HPP
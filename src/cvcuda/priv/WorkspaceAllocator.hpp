@@ -18,8 +18,11 @@
 #ifndef CVCUDA_PRIV_WORKSPACE_ALLOCATOR_HPP
 #define CVCUDA_PRIV_WORKSPACE_ALLOCATOR_HPP
 
+#include "WorkspaceScope.hpp"
+
 #include <cvcuda/Workspace.hpp>
 
+#include <algorithm>
 #include <optional>
 
 namespace cvcuda {
@@ -111,6 +114,7 @@ public:
         if (offset > m_mem.req.size)
             throw nvcv::Exception(nvcv::Status::ERROR_OUT_OF_MEMORY, "Operator workspace too small.");
         m_offset = offset;
+        m_peak   = std::max(m_peak, m_offset);
         return ret;
     }
 
@@ -124,6 +128,46 @@ public:
         return m_offset;
     }
 
+    /**
+     * @brief The largest amount of memory allocated at any time, which can exceed `allocated` after a `rewind`.
+     */
+    constexpr size_t peak() const
+    {
+        return m_peak;
+    }
+
+    /**
+     * @brief Returns the current allocation position, to be passed to `rewind`.
+     */
+    size_t mark() const
+    {
+        return m_offset;
+    }
+
+    /**
+     * @brief Frees all the entries obtained since `mark` was called, so that their memory can be reused.
+     *
+     * See `WorkspaceScope` for a scoped version of mark/rewind and the requirements on memory reuse.
+     *
+     * @param mark a value returned by `mark`, not past the current allocation position
+     */
+    void rewind(size_t mark)
+    {
+        if (!tryRewind(mark))
+            throw std::logic_error("Cannot rewind the workspace past its current allocation position.");
+    }
+
+    /**
+     * @brief Same as `rewind`, but returns false instead of throwing if `mark` is past the current position.
+     */
+    bool tryRewind(size_t mark) noexcept
+    {
+        if (mark > m_offset)
+            return false;
+        m_offset = mark;
+        return true;
+    }
+
     /**
      * @brief Waits for the memory to become ready for use on the acquire stream, if specified, or on host.
      */
@@ -159,7 +203,7 @@ public:
         if (m_released)
             throw std::logic_error("Release called multiple times");
 
-        if (m_mem.ready && m_offset)
+        if (m_mem.ready && m_peak)
         {
             assert(m_acquired);
 
@@ -173,6 +217,7 @@ public:
 private:
     WorkspaceMem m_mem;
     size_t       m_offset   = 0;
+    size_t       m_peak     = 0;
     bool         m_acquired = false, m_released = false;
 
     std::optional<cudaStream_t> m_acquireStream, m_releaseStream;
@@ -206,6 +251,33 @@ public:
         return cudaMem.get<T>(count, alignment);
     }
 
+    struct Mark
+    {
+        size_t hostMem, pinnedMem, cudaMem;
+    };
+
+    Mark mark() const
+    {
+        return {hostMem.mark(), pinnedMem.mark(), cudaMem.mark()};
+    }
+
+    void rewind(const Mark &mark)
+    {
+        if (!tryRewind(mark))
+            throw std::logic_error("Cannot rewind the workspace past its current allocation position.");
+    }
+
+    bool tryRewind(const Mark &mark) noexcept
+    {
+        // Check all the positions first, so that nothing is rewound on failure
+        if (mark.hostMem > hostMem.mark() || mark.pinnedMem > pinnedMem.mark() || mark.cudaMem > cudaMem.mark())
+            return false;
+        hostMem.tryRewind(mark.hostMem);
+        pinnedMem.tryRewind(mark.pinnedMem);
+        cudaMem.tryRewind(mark.cudaMem);
+        return true;
+    }
+
     WorkspaceMemAllocator hostMem;
     WorkspaceMemAllocator pinnedMem;
     WorkspaceMemAllocator cudaMem;
@@ -18,28 +18,68 @@
 #ifndef CVCUDA_PRIV_WORKSPACE_ESTIMATOR_HPP
 #define CVCUDA_PRIV_WORKSPACE_ESTIMATOR_HPP
 
+#include "WorkspaceScope.hpp"
+
 #include <cvcuda/Workspace.hpp>
 
+#include <stdexcept>
+
 namespace cvcuda {
 
 struct WorkspaceMemEstimator
 {
     explicit WorkspaceMemEstimator(size_t initial_size = 0, size_t base_alignment = alignof(std::max_align_t))
         : req{initial_size, base_alignment}
+        , offset(initial_size)
     {
     }
 
+    // The required size is the peak of the allocation position.
     WorkspaceMemRequirements req;
 
+    // The current allocation position, as `WorkspaceMemAllocator::allocated` would be.
+    size_t offset;
+
     template<typename T = char>
     WorkspaceMemEstimator &add(size_t count = 1, size_t alignment = alignof(T))
     {
         if (alignment > req.alignment)
             req.alignment = alignment;
-        req.size = nvcv::detail::AlignUp(req.size, alignment);
-        req.size += nvcv::detail::AlignUp(count * sizeof(T), alignment);
+        offset = nvcv::detail::AlignUp(offset, alignment);
+        offset += nvcv::detail::AlignUp(count * sizeof(T), alignment);
+        if (offset > req.size)
+            req.size = offset;
         return *this;
     }
+
+    /**
+     * @brief Returns the current allocation position, to be passed to `rewind`.
+     */
+    size_t mark() const
+    {
+        return offset;
+    }
+
+    /**
+     * @brief Mirrors `WorkspaceMemAllocator::rewind`: the entries added since `mark` don't count
+     *        towards the size of the entries added next, but still count towards the peak.
+     */
+    void rewind(size_t mark)
+    {
+        if (!tryRewind(mark))
+            throw std::logic_error("Cannot rewind the workspace estimator past its current allocation position.");
+    }
+
+    /**
+     * @brief Same as `rewind`, but returns false instead of throwing if `mark` is past the current position.
+     */
+    bool tryRewind(size_t mark) noexcept
+    {
+        if (mark > offset)
+            return false;
+        offset = mark;
+        return true;
+    }
 };
 
 struct WorkspaceEstimator
@@ -83,6 +123,33 @@ struct WorkspaceEstimator
         cudaMem.add<T>(count, alignment);
         return *this;
     }
+
+    struct Mark
+    {
+        size_t hostMem, pinnedMem, cudaMem;
+    };
+
+    Mark mark() const
+    {
+        return {hostMem.mark(), pinnedMem.mark(), cudaMem.mark()};
+    }
+
+    void rewind(const Mark &mark)
+    {
+        if (!tryRewind(mark))
+            throw std::logic_error("Cannot rewind the workspace estimator past its current allocation position.");
+    }
+
+    bool tryRewind(const Mark &mark) noexcept
+    {
+        // Check all the positions first, so that nothing is rewound on failure
+        if (mark.hostMem > hostMem.mark() || mark.pinnedMem > pinnedMem.mark() || mark.cudaMem > cudaMem.mark())
+            return false;
+        hostMem.tryRewind(mark.hostMem);
+        pinnedMem.tryRewind(mark.pinnedMem);
+        cudaMem.tryRewind(mark.cudaMem);
+        return true;
+    }
 };
 
 } // namespace cvcuda
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_PRIV_WORKSPACE_SCOPE_HPP
+#define CVCUDA_PRIV_WORKSPACE_SCOPE_HPP
+
+#include <cassert>
+#include <utility>
+
+namespace cvcuda {
+
+/**
+ * @brief Marks the current position of a workspace allocator or estimator and rewinds to it when destroyed.
+ *
+ * Entries obtained within the scope can be reused by the entries obtained after the scope ends. This lets
+ * operators with several phases of temporary storage request the peak of the phases instead of their sum,
+ * provided that the same scopes are used when estimating and when allocating the workspace.
+ *
+ * ```
+ * {
+ *     WorkspaceScope phase1(alloc.cudaMem);
+ *     auto *tmp = alloc.getCuda<float>(n);
+ *     ...
+ * }
+ * {
+ *     WorkspaceScope phase2(alloc.cudaMem);
+ *     auto *tmp = alloc.getCuda<int>(m); // reuses the memory of phase 1
+ *     ...
+ * }
+ * ```
+ *
+ * Device memory can be reused this way as long as all the work of a phase is ordered before the next one,
+ * e.g. submitted on the same stream. Host memory must not be used anymore once its scope ends.
+ *
+ * @tparam Workspace a type with `mark()` and `tryRewind(mark)` member functions, such as
+ *                   `WorkspaceMemAllocator`, `WorkspaceAllocator`, `WorkspaceMemEstimator`
+ *                   and `WorkspaceEstimator`.
+ */
+template<typename Workspace>
+class WorkspaceScope
+{
+public:
+    using Mark = decltype(std::declval<Workspace &>().mark());
+
+    explicit WorkspaceScope(Workspace &ws)
+        : m_ws(ws)
+        , m_mark(ws.mark())
+    {
+    }
+
+    ~WorkspaceScope()
+    {
+        // Fails only if the workspace was rewound past the scope's mark while the scope was alive
+        bool rewound = m_ws.tryRewind(m_mark);
+        assert(rewound && "Workspace rewound past the mark of an enclosing scope");
+        (void)rewound;
+    }
+
+    WorkspaceScope(const WorkspaceScope &)            = delete;
+    WorkspaceScope &operator=(const WorkspaceScope &) = delete;
+
+private:
+    Workspace &m_ws;
+    Mark       m_mark;
+};
+
+} // namespace cvcuda
+
+#endif // CVCUDA_PRIV_WORKSPACE_SCOPE_HPP
@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include "priv/AllocTracer.hpp"
+#include "priv/ArenaAllocator.hpp"
 #include "priv/AllocatorManager.hpp"
 #include "priv/CustomAllocator.hpp"
 #include "priv/DefaultAllocator.hpp"
@@ -54,6 +56,26 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvAllocatorConstructCustom,
         });
 }
 
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvAllocatorConstructArena,
+                (const NVCVRequirements *reqs, NVCVAllocatorHandle parent, NVCVAllocatorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to requirements must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            *handle = priv::CreateCoreObject<priv::ArenaAllocator>(*reqs, priv::GetAllocator(parent));
+        });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorDecRef, (NVCVAllocatorHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -201,6 +223,16 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvAllocatorFreeCudaMemory,
         });
 }
 
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvAllocatorSetTraceFile, (NVCVAllocatorHandle halloc, const char *path))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            priv::IAllocator &alloc = priv::GetAllocator(halloc);
+            priv::SetAllocatorTracer(alloc, path != nullptr ? std::make_shared<priv::AllocTracer>(path) : nullptr);
+        });
+}
+
 NVCV_DEFINE_API(0, 4, const char *, nvcvResourceTypeGetName, (NVCVResourceType resource))
 {
     priv::CoreTLS &tls = priv::GetCoreTLS();
@@ -17,10 +17,12 @@
 
 #include "priv/AllocatorManager.hpp"
 #include "priv/ArrayManager.hpp"
+#include "priv/DefaultAllocator.hpp"
 #include "priv/ImageBatchManager.hpp"
 #include "priv/ImageManager.hpp"
 #include "priv/Status.hpp"
 #include "priv/SymbolVersioning.hpp"
+#include "priv/TensorBatchManager.hpp"
 #include "priv/TensorManager.hpp"
 
 #include <nvcv/Config.h>
@@ -111,3 +113,64 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvConfigSetMaxAllocatorCount, (int32_t maxCo
             }
         });
 }
+
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvConfigSetMaxHostMemPoolSize, (int64_t maxBytes))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            auto &alloc = static_cast<priv::DefaultAllocator &>(priv::GlobalContext().allocDefault());
+            alloc.setHostMemPoolLimit(maxBytes);
+        });
+}
+
+namespace {
+
+template<class HandleType>
+NVCVObjectCounts GetObjectCounts()
+{
+    priv::HandleManagerStats stats = priv::GlobalContext().manager<HandleType>().stats();
+
+    NVCVObjectCounts counts;
+    counts.liveCount   = stats.liveCount;
+    counts.peakCount   = stats.peakCount;
+    counts.capacity    = stats.capacity;
+    counts.poolGrowths = stats.poolGrowths;
+    return counts;
+}
+
+NVCVMemoryCounts GetMemoryCounts(NVCVResourceType resType)
+{
+    priv::AllocatorStats stats = priv::GetAllocatorStats(resType);
+
+    NVCVMemoryCounts counts;
+    counts.bytesInUse = stats.bytesInUse;
+    counts.peakBytes  = stats.peakBytes;
+    counts.numAllocs  = stats.numAllocs;
+    return counts;
+}
+
+} // namespace
+
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvGetObjectStats, (NVCVObjectStats * stats))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (stats == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output stats cannot be NULL");
+            }
+
+            stats->images        = GetObjectCounts<NVCVImageHandle>();
+            stats->imageBatches  = GetObjectCounts<NVCVImageBatchHandle>();
+            stats->tensors       = GetObjectCounts<NVCVTensorHandle>();
+            stats->tensorBatches = GetObjectCounts<NVCVTensorBatchHandle>();
+            stats->arrays        = GetObjectCounts<NVCVArrayHandle>();
+            stats->allocators    = GetObjectCounts<NVCVAllocatorHandle>();
+
+            stats->hostMem       = GetMemoryCounts(NVCV_RESOURCE_MEM_HOST);
+            stats->hostPinnedMem = GetMemoryCounts(NVCV_RESOURCE_MEM_HOST_PINNED);
+            stats->cudaMem       = GetMemoryCounts(NVCV_RESOURCE_MEM_CUDA);
+        });
+}
@@ -142,6 +142,12 @@ NVCV_DEFINE_API(0, 0, NVCVStatus, nvcvDataTypeGetChannelType,
 
 NVCV_DEFINE_API(0, 0, const char *, nvcvDataTypeGetName, (NVCVDataType type))
 {
+    // Predefined types have a static name, no need to format it.
+    if (const char *name = priv::GetPredefinedName(priv::DataType{type}))
+    {
+        return name;
+    }
+
     priv::CoreTLS &tls = priv::GetCoreTLS(); // noexcept
 
     char         *buffer  = tls.bufDataTypeName;
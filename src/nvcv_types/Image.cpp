@@ -87,6 +87,45 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageWrapDataConstruct,
         });
 }
 
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvImageWrapDataConstructMany,
+                (int32_t numImages, const NVCVImageData *data, NVCVImageDataCleanupFunc cleanup,
+                 void *const *ctxCleanup, NVCVImageHandle *handles))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (numImages < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of images must be >= 0, not %d",
+                                      numImages);
+            }
+
+            if (numImages == 0)
+            {
+                return;
+            }
+
+            if (handles == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handles must not be NULL");
+            }
+
+            if (data == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Image data array must not be NULL");
+            }
+
+            // Validate everything upfront, so that no image gets created (and
+            // later cleaned up) if any of them is invalid.
+            priv::ImageWrapData::ValidateMany(numImages, data);
+
+            priv::CreateCoreObjects<priv::ImageWrapData>(
+                numImages, handles,
+                [&](int32_t i)
+                { return std::make_tuple(data[i], cleanup, ctxCleanup ? ctxCleanup[i] : nullptr, false); });
+        });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageDecRef, (NVCVImageHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -98,6 +137,27 @@ NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageDecRef, (NVCVImageHandle handle, int
         });
 }
 
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvImageDecRefMany,
+                (int32_t numImages, const NVCVImageHandle *handles, int *newRefCounts))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (numImages < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of images must be >= 0, not %d",
+                                      numImages);
+            }
+
+            if (numImages > 0 && handles == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to handles must not be NULL");
+            }
+
+            priv::CoreObjectDecRefMany(numImages, handles, newRefCounts);
+        });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageIncRef, (NVCVImageHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
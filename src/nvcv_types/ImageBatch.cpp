@@ -20,12 +20,15 @@
 #include "priv/IAllocator.hpp"
 #include "priv/ImageBatchManager.hpp"
 #include "priv/ImageBatchVarShape.hpp"
+#include "priv/ImageManager.hpp"
 #include "priv/ImageFormat.hpp"
 #include "priv/Status.hpp"
 #include "priv/SymbolVersioning.hpp"
 
 #include <nvcv/ImageBatch.h>
 
+#include <vector>
+
 namespace priv = nvcv::priv;
 
 NVCV_DEFINE_API(0, 0, NVCVStatus, nvcvImageBatchVarShapeCalcRequirements,
@@ -310,3 +313,55 @@ NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvImageBatchVarShapeGetImages,
             batch.getImages(begIndex, outImages, numImages);
         });
 }
+
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvImageBatchVarShapeSlice,
+                (NVCVImageBatchHandle handle, int32_t begIndex, int32_t numImages, NVCVImageBatchHandle *outHandle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (outHandle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            if (numImages < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of images must be >= 0, not %d",
+                                      numImages);
+            }
+
+            auto &batch = priv::ToDynamicRef<const priv::IImageBatchVarShape>(handle);
+
+            // Hold references to the images while they're pushed into the new batch.
+            std::vector<NVCVImageHandle> images(numImages);
+            batch.getImages(begIndex, images.data(), numImages);
+
+            priv::SharedCoreObj<priv::IAllocator> alloc = batch.alloc();
+
+            NVCVImageBatchHandle newHandle = nullptr;
+            try
+            {
+                newHandle = priv::CreateCoreObject<priv::ImageBatchVarShape>(
+                    priv::ImageBatchVarShape::CalcRequirements(numImages), *alloc);
+
+                if (numImages > 0)
+                {
+                    auto &newBatch = priv::ToDynamicRef<priv::IImageBatchVarShape>(newHandle);
+                    newBatch.pushImages(images.data(), numImages);
+                }
+            }
+            catch (...)
+            {
+                if (newHandle)
+                {
+                    priv::CoreObjectDecRef(newHandle);
+                }
+                priv::CoreObjectDecRefMany(numImages, images.data(), nullptr);
+                throw;
+            }
+
+            priv::CoreObjectDecRefMany(numImages, images.data(), nullptr);
+            *outHandle = newHandle;
+        });
+}
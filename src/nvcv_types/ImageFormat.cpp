@@ -576,6 +576,12 @@ NVCV_DEFINE_API(0, 0, NVCVStatus, nvcvImageFormatGetPlaneSize,
 
 NVCV_DEFINE_API(0, 0, const char *, nvcvImageFormatGetName, (NVCVImageFormat fmt))
 {
+    // Predefined formats have a static name, no need to format it.
+    if (const char *name = priv::GetPredefinedName(priv::ImageFormat{fmt}))
+    {
+        return name;
+    }
+
     priv::CoreTLS &tls = priv::GetCoreTLS(); // noexcept
 
     char         *buffer  = tls.bufImageFormatName;
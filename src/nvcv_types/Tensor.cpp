@@ -96,6 +96,30 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorConstruct,
         });
 }
 
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorConstructWithTarget,
+                (const NVCVTensorRequirements *reqs, NVCVAllocatorHandle halloc, NVCVResourceType target,
+                 NVCVTensorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                      "Pointer to tensor image batch requirements must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            priv::IAllocator &alloc = priv::GetAllocator(halloc);
+
+            *handle = priv::CreateCoreObject<priv::Tensor>(*reqs, alloc, target);
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapDataConstruct,
                 (const NVCVTensorData *data, NVCVTensorDataCleanupFunc cleanup, void *ctxCleanup,
                  NVCVTensorHandle *handle))
@@ -116,6 +140,7 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapDataConstruct,
             switch (data->bufferType)
             {
             case NVCV_TENSOR_BUFFER_STRIDED_CUDA:
+            case NVCV_TENSOR_BUFFER_STRIDED_HOST:
                 *handle = priv::CreateCoreObject<priv::TensorWrapDataStrided>(*data, cleanup, ctxCleanup);
                 break;
 
@@ -125,6 +150,54 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapDataConstruct,
         });
 }
 
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorWrapDataConstructMany,
+                (int32_t numTensors, const NVCVTensorData *data, NVCVTensorDataCleanupFunc cleanup,
+                 void *const *ctxCleanup, NVCVTensorHandle *handles))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (numTensors < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of tensors must be >= 0, not %d",
+                                      numTensors);
+            }
+
+            if (numTensors == 0)
+            {
+                return;
+            }
+
+            if (data == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to tensor data array must not be NULL");
+            }
+
+            if (handles == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handles must not be NULL");
+            }
+
+            switch (data[0].bufferType)
+            {
+            case NVCV_TENSOR_BUFFER_STRIDED_CUDA:
+            case NVCV_TENSOR_BUFFER_STRIDED_HOST:
+                // Validate everything upfront, so that no tensor gets created (and
+                // later cleaned up) if any of them is invalid.
+                priv::TensorWrapDataStrided::ValidateMany(numTensors, data);
+
+                priv::CreateCoreObjects<priv::TensorWrapDataStrided>(
+                    numTensors, handles,
+                    [&](int32_t i)
+                    { return std::make_tuple(data[i], cleanup, ctxCleanup ? ctxCleanup[i] : nullptr, false); });
+                break;
+
+            default:
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Tensor buffer type not supported";
+            }
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapImageConstruct, (NVCVImageHandle himg, NVCVTensorHandle *handle))
 {
     return priv::ProtectCall(
@@ -168,6 +241,27 @@ NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorDecRef, (NVCVTensorHandle handle, in
         });
 }
 
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorDecRefMany,
+                (int32_t numTensors, const NVCVTensorHandle *handles, int *newRefCounts))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (numTensors < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of tensors must be >= 0, not %d",
+                                      numTensors);
+            }
+
+            if (numTensors > 0 && handles == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to handles must not be NULL");
+            }
+
+            priv::CoreObjectDecRefMany(numTensors, handles, newRefCounts);
+        });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvTensorIncRef, (NVCVTensorHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -342,3 +436,41 @@ NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorReshape,
             (void)tensor_ptr.release(); // we transferred ownership, we can release
         });
 }
+
+NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorSlice,
+                (NVCVTensorHandle handle, int32_t rank, const int64_t *begin, const int64_t *end, const int64_t *step,
+                 NVCVTensorHandle *out_handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Tensor handle must not be NULL");
+            }
+
+            if (out_handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            auto tensor_ptr = priv::ToSharedObj<priv::ITensor>(handle); // this will call incRef
+
+            NVCVTensorData new_tensor_data;
+            tensor_ptr->exportData(new_tensor_data);
+
+            // Modifies shape, strides and base pointer
+            priv::SliceTensorData(new_tensor_data, rank, begin, end, step);
+
+            // The cleanup consists of dropping the reference to the handle we reference
+            auto cleanup = [](void *h, const NVCVTensorData *)
+            {
+                priv::CoreObjectDecRef(static_cast<NVCVTensorHandle>(h));
+            };
+            void *cleanup_ctx = handle;
+
+            *out_handle = priv::CreateCoreObject<priv::TensorWrapDataStrided>(new_tensor_data, cleanup, cleanup_ctx);
+
+            (void)tensor_ptr.release(); // we transferred ownership, we can release
+        });
+}
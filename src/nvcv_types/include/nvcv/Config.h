@@ -107,6 +107,74 @@ NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxArrayCount(int32_t maxCount);
  */
 NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxAllocatorCount(int32_t maxCount);
 
+/**
+ * Set the maximum amount of memory cached by the default allocator's host memory pool.
+ *
+ * By default, host memory requested from the default allocator is obtained from the system
+ * allocator on every request. When a limit is set, small host buffers, such as the ones
+ * allocated by image and tensor batches, are recycled through a size-class pool with
+ * per-thread caches, avoiding the system allocator when objects are frequently created
+ * and destroyed.
+ *
+ * @param[in] maxBytes Maximum number of bytes kept cached by the pool.
+ *                     Each thread can additionally hold a small number of cached buffers.
+ *                     If negative, pooling is disabled and cached memory is released.
+ *
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvConfigSetMaxHostMemPoolSize(int64_t maxBytes);
+
+/** Counters of the handles of one object type. */
+typedef struct NVCVObjectCountsRec
+{
+    int64_t liveCount;   /**< Number of objects currently alive. */
+    int64_t peakCount;   /**< Maximum number of objects alive at the same time. */
+    int64_t capacity;    /**< Number of handles reserved, used or not. */
+    int64_t poolGrowths; /**< Number of times handles had to be reserved. */
+} NVCVObjectCounts;
+
+/** Counters of the memory of one resource type allocated through allocators. */
+typedef struct NVCVMemoryCountsRec
+{
+    int64_t bytesInUse; /**< Number of bytes currently allocated. */
+    int64_t peakBytes;  /**< Maximum number of bytes allocated at the same time. */
+    int64_t numAllocs;  /**< Number of allocations done so far. */
+} NVCVMemoryCounts;
+
+/** Statistics about the objects and memory managed by NVCV. */
+typedef struct NVCVObjectStatsRec
+{
+    NVCVObjectCounts images;
+    NVCVObjectCounts imageBatches;
+    NVCVObjectCounts tensors;
+    NVCVObjectCounts tensorBatches;
+    NVCVObjectCounts arrays;
+    NVCVObjectCounts allocators;
+
+    NVCVMemoryCounts hostMem;       /**< Memory of type \ref NVCV_RESOURCE_MEM_HOST */
+    NVCVMemoryCounts hostPinnedMem; /**< Memory of type \ref NVCV_RESOURCE_MEM_HOST_PINNED */
+    NVCVMemoryCounts cudaMem;       /**< Memory of type \ref NVCV_RESOURCE_MEM_CUDA */
+} NVCVObjectStats;
+
+/**
+ * Retrieves statistics about the objects alive and the memory allocated.
+ *
+ * The counters are always enabled. They are updated without synchronization
+ * between threads, so the values are only consistent with each other when no
+ * other thread is creating or destroying objects.
+ *
+ * Memory counters include all allocations done through allocators, either by
+ * the objects or by the user with \ref nvcvAllocatorAllocHostMemory and similar.
+ * Memory allocated directly by custom allocators' callbacks isn't accounted for.
+ *
+ * @param[out] stats Where the statistics will be written to.
+ *                   + Cannot be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvGetObjectStats(NVCVObjectStats *stats);
+
 #ifdef __cplusplus
 }
 #endif
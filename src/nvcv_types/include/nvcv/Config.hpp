@@ -84,6 +84,30 @@ inline void SetMaxAllocatorCount(int32_t maxCount)
     detail::CheckThrow(nvcvConfigSetMaxAllocatorCount(maxCount));
 }
 
+/**
+ * @brief Sets the maximum amount of memory cached by the default allocator's host memory pool.
+ *
+ * @param maxBytes The maximum number of cached bytes. If negative, host memory pooling is disabled.
+ * @throw An exception is thrown if the nvcvConfigSetMaxHostMemPoolSize function fails.
+ */
+inline void SetMaxHostMemPoolSize(int64_t maxBytes)
+{
+    detail::CheckThrow(nvcvConfigSetMaxHostMemPoolSize(maxBytes));
+}
+
+/**
+ * @brief Retrieves statistics about the objects alive and the memory allocated.
+ *
+ * @return The current object and memory counters.
+ * @throw An exception is thrown if the nvcvGetObjectStats function fails.
+ */
+inline NVCVObjectStats GetObjectStats()
+{
+    NVCVObjectStats stats;
+    detail::CheckThrow(nvcvGetObjectStats(&stats));
+    return stats;
+}
+
 }} // namespace nvcv::cfg
 
 #endif // NVCV_CONFIG_HPP
@@ -26,6 +26,7 @@
 
 #include "DataLayout.hpp"
 #include "DataType.h"
+#include "detail/FormatDecode.hpp"
 
 #include <iostream>
 
@@ -89,13 +90,13 @@ public:
     constexpr operator NVCVDataType() const;
 
     // Accessors for data type properties
-    Packing                packing() const;
+    constexpr Packing      packing() const;
     std::array<int32_t, 4> bitsPerChannel() const;
-    DataKind               dataKind() const;
-    int32_t                numChannels() const;
+    constexpr DataKind     dataKind() const;
+    constexpr int32_t      numChannels() const;
     DataType               channelType(int32_t channel) const;
-    int32_t                strideBytes() const;
-    int32_t                bitsPerPixel() const;
+    constexpr int32_t      strideBytes() const;
+    constexpr int32_t      bitsPerPixel() const;
     int32_t                alignment() const;
 
 private:
@@ -243,18 +244,14 @@ constexpr DataType::operator NVCVDataType() const
     return m_type;
 }
 
-inline Packing DataType::packing() const
+constexpr Packing DataType::packing() const
 {
-    NVCVPacking out;
-    detail::CheckThrow(nvcvDataTypeGetPacking(m_type, &out));
-    return static_cast<Packing>(out);
+    return static_cast<Packing>(detail::DataTypePacking(m_type));
 }
 
-inline int32_t DataType::bitsPerPixel() const
+constexpr int32_t DataType::bitsPerPixel() const
 {
-    int32_t out;
-    detail::CheckThrow(nvcvDataTypeGetBitsPerPixel(m_type, &out));
-    return out;
+    return detail::DataTypeBitsPerPixel(m_type);
 }
 
 inline std::array<int32_t, 4> DataType::bitsPerChannel() const
@@ -264,18 +261,14 @@ inline std::array<int32_t, 4> DataType::bitsPerChannel() const
     return {bits[0], bits[1], bits[2], bits[3]};
 }
 
-inline DataKind DataType::dataKind() const
+constexpr DataKind DataType::dataKind() const
 {
-    NVCVDataKind out;
-    detail::CheckThrow(nvcvDataTypeGetDataKind(m_type, &out));
-    return static_cast<DataKind>(out);
+    return static_cast<DataKind>(detail::DataTypeDataKind(m_type));
 }
 
-inline int32_t DataType::numChannels() const
+constexpr int32_t DataType::numChannels() const
 {
-    int32_t out;
-    detail::CheckThrow(nvcvDataTypeGetNumChannels(m_type, &out));
-    return out;
+    return detail::DataTypeNumChannels(m_type);
 }
 
 inline DataType DataType::channelType(int32_t channel) const
@@ -285,11 +278,9 @@ inline DataType DataType::channelType(int32_t channel) const
     return static_cast<DataType>(out);
 }
 
-inline int32_t DataType::strideBytes() const
+constexpr int32_t DataType::strideBytes() const
 {
-    int32_t out;
-    detail::CheckThrow(nvcvDataTypeGetStrideBytes(m_type, &out));
-    return out;
+    return detail::DataTypeStrideBytes(m_type);
 }
 
 inline int32_t DataType::alignment() const
@@ -148,6 +148,42 @@ NVCV_PUBLIC NVCVStatus nvcvImageConstruct(const NVCVImageRequirements *reqs, NVC
 NVCV_PUBLIC NVCVStatus nvcvImageWrapDataConstruct(const NVCVImageData *data, NVCVImageDataCleanupFunc cleanup,
                                                   void *ctxCleanup, NVCVImageHandle *handle);
 
+/** Wraps several existing image buffers into NVCV image instances.
+ *
+ * It's equivalent to calling \ref nvcvImageWrapDataConstruct for each buffer, but the
+ * resources for all images are reserved at once, and the properties shared by all
+ * images are validated only once.
+ *
+ * Either all images are created, or none is. In the latter case, the cleanup function isn't called.
+ *
+ * @param [in] numImages Number of images to be created.
+ *                       + Must be >= 0.
+ *
+ * @param [in] data Array with the contents of each image, with \p numImages elements.
+ *                  + Must not be NULL if \p numImages > 0.
+ *                  + All elements must have the same buffer type and format.
+ *                  + Buffer type must not be \ref NVCV_IMAGE_BUFFER_NONE.
+ *                  + Image dimensions must be >= 1x1
+ *
+ * @param [in] cleanup Cleanup function to be called when each image is destroyed
+ *                     via @ref nvcvImageDecRef or @ref nvcvImageDecRefMany.
+ *                     If NULL, no cleanup function is defined.
+ *
+ * @param [in] ctxCleanup Array with the pointer to be passed unchanged to the cleanup function of
+ *                        each image, with \p numImages elements.
+ *                        If NULL, NULL is passed to the cleanup function of all images.
+ *
+ * @param [out] handles Where the image instance handles will be written to, with \p numImages elements.
+ *                      + Must not be NULL if \p numImages > 0.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the images.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageWrapDataConstructMany(int32_t numImages, const NVCVImageData *data,
+                                                      NVCVImageDataCleanupFunc cleanup, void *const *ctxCleanup,
+                                                      NVCVImageHandle *handles);
+
 /** Decrements the reference count of an existing image instance.
  *
  * The image is destroyed when its reference count reaches zero.
@@ -169,6 +205,26 @@ NVCV_PUBLIC NVCVStatus nvcvImageWrapDataConstruct(const NVCVImageData *data, NVC
  */
 NVCV_PUBLIC NVCVStatus nvcvImageDecRef(NVCVImageHandle handle, int *newRefCount);
 
+/** Decrements the reference count of several images.
+ *
+ * It's equivalent to calling \ref nvcvImageDecRef for each handle, in order.
+ *
+ * @param [in] numImages Number of handles.
+ *                       + Must be >= 0.
+ *
+ * @param [in] handles Array with the images to be released, with \p numImages elements.
+ *                     NULL handles are skipped.
+ *                     + Must not be NULL if \p numImages > 0.
+ *
+ * @param [out] newRefCounts Array where the decremented reference count of each image will be written to.
+ *                           Can be NULL, if the caller isn't interested in the new reference counts.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some handle is invalid. The handles before it were released,
+ *                                      the ones after it were left untouched.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageDecRefMany(int32_t numImages, const NVCVImageHandle *handles, int *newRefCounts);
+
 /** Increments the reference count of an image.
  *
  * @param [in] handle       Image to be retained.
@@ -28,6 +28,7 @@
 #include "detail/Callback.hpp"
 
 #include <functional>
+#include <vector>
 
 namespace nvcv {
 
@@ -145,6 +146,32 @@ using ImageDataCleanupCallback
 // For API backward-compatibility
 inline Image ImageWrapData(const ImageData &data, ImageDataCleanupCallback &&cleanup = ImageDataCleanupCallback{});
 
+/**
+ * @brief Wraps several image data into image objects at once.
+ *
+ * It's more efficient than calling \ref ImageWrapData for each image data.
+ * The wrapped buffers aren't owned by the images, they must outlive them.
+ *
+ * @param data Array of image data to be wrapped, all must have the same format.
+ * @param count Number of elements in \p data.
+ * @return The image objects wrapping the given data, in the same order.
+ */
+inline std::vector<Image> ImageWrapDataMany(const ImageData *data, int32_t count);
+
+/**
+ * @brief Releases the references held by several images at once.
+ *
+ * It's more efficient than resetting each image individually.
+ * All images are left empty.
+ *
+ * If some images hold invalid handles, all the valid ones are still released
+ * and an exception is thrown afterwards.
+ *
+ * @param images Array of images to be released.
+ * @param count Number of elements in \p images.
+ */
+inline void ImageReleaseMany(Image *images, int32_t count);
+
 using ImageWrapHandle = NonOwningResource<Image>;
 
 } // namespace nvcv
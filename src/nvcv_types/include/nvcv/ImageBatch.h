@@ -396,6 +396,34 @@ NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeClear(NVCVImageBatchHandle handle);
 NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeGetImages(NVCVImageBatchHandle handle, int32_t begIndex,
                                                        NVCVImageHandle *outImages, int32_t numImages);
 
+/**
+ * Creates a varshape image batch with a range of the images of another one.
+ *
+ * The images are shared, not copied: the new batch holds new references to the same images.
+ * The new batch has capacity \p numImages and uses the same allocator as \p handle.
+ *
+ * @param[in] handle Varshape image batch to take the images from.
+ *                   + Must not be NULL.
+ *                   + The handle must have been created with @ref nvcvImageBatchVarShapeConstruct.
+ *
+ * @param[in] begIndex Index of the first image to be taken.
+ *                     + Must be >= 0.
+ *
+ * @param[in] numImages Number of images to be taken.
+ *                      + Must be >= 0.
+ *                      + Must be begIndex+numImages <= number of images in the batch.
+ *
+ * @param[out] outHandle Where the new image batch handle will be written to.
+ *                       + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_OVERFLOW         Tried to take more images that there are in the batch.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the image batch.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeSlice(NVCVImageBatchHandle handle, int32_t begIndex, int32_t numImages,
+                                                   NVCVImageBatchHandle *outHandle);
+
 #ifdef __cplusplus
 }
 #endif
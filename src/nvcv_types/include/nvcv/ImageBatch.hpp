@@ -180,6 +180,17 @@ public:
      */
     void clear();
 
+    /**
+     * @brief Create a batch with a range of the images of this batch.
+     *
+     * The images are shared, not copied.
+     *
+     * @param begIndex Index of the first image.
+     * @param numImages Number of images.
+     * @return A new batch with capacity \p numImages holding the images [begIndex, begIndex+numImages).
+     */
+    ImageBatchVarShape slice(int32_t begIndex, int32_t numImages) const;
+
     /**
      * @brief Get the maximum size among all images in the batch.
      *
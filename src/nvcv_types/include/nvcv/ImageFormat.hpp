@@ -28,6 +28,7 @@
 #include "DataLayout.hpp"
 #include "DataType.hpp"
 #include "ImageFormat.h"
+#include "detail/FormatDecode.hpp"
 
 #include <nvcv/Size.hpp>
 
@@ -180,11 +181,11 @@ public:
     constexpr bool operator==(ImageFormat that) const noexcept;
     constexpr bool operator!=(ImageFormat that) const noexcept;
 
-    ImageFormat dataKind(DataKind dataKind) const;
-    DataKind    dataKind() const noexcept;
+    ImageFormat        dataKind(DataKind dataKind) const;
+    constexpr DataKind dataKind() const noexcept;
 
-    ImageFormat memLayout(MemLayout newMemLayout) const;
-    MemLayout   memLayout() const noexcept;
+    ImageFormat         memLayout(MemLayout newMemLayout) const;
+    constexpr MemLayout memLayout() const noexcept;
 
     ImageFormat colorSpec(ColorSpec newColorSpec) const;
     ColorSpec   colorSpec() const noexcept;
@@ -195,31 +196,31 @@ public:
     ImageFormat rawPattern(RawPattern newRawPattern) const;
     RawPattern  rawPattern() const noexcept;
 
-    AlphaType   alphaType() const noexcept;
-    ImageFormat alphaType(AlphaType newAlphaType) const;
+    constexpr AlphaType alphaType() const noexcept;
+    ImageFormat         alphaType(AlphaType newAlphaType) const;
 
     void        extraChannelInfo(ExtraChannelInfo *exChannelInfo) const noexcept;
     ImageFormat extraChannelInfo(const ExtraChannelInfo *newExChannelInfo) const;
 
-    Swizzle                swizzle() const noexcept;
+    constexpr Swizzle      swizzle() const noexcept;
     ColorModel             colorModel() const noexcept;
     int32_t                numChannels() const noexcept;
     std::array<int32_t, 4> bitsPerChannel() const noexcept;
     uint32_t               fourCC() const;
-    int32_t                numPlanes() const noexcept;
+    constexpr int32_t      numPlanes() const noexcept;
 
     ImageFormat swizzleAndPacking(Swizzle newSwizzle, Packing newPacking0, Packing newPacking1, Packing newPacking2,
                                   Packing newPacking3) const;
 
-    Packing     planePacking(int32_t plane) const noexcept;
-    int32_t     planePixelStrideBytes(int32_t plane) const noexcept;
-    DataType    planeDataType(int32_t plane) const noexcept;
-    int32_t     planeNumChannels(int32_t plane) const noexcept;
-    int32_t     planeBitsPerPixel(int32_t plane) const noexcept;
-    int32_t     planeRowAlignment(int32_t plane) const noexcept;
-    Size2D      planeSize(Size2D imgSize, int32_t plane) const noexcept;
-    Swizzle     planeSwizzle(int32_t plane) const noexcept;
-    ImageFormat planeFormat(int32_t plane) const noexcept;
+    constexpr Packing planePacking(int32_t plane) const noexcept;
+    constexpr int32_t planePixelStrideBytes(int32_t plane) const noexcept;
+    DataType          planeDataType(int32_t plane) const noexcept;
+    constexpr int32_t planeNumChannels(int32_t plane) const noexcept;
+    constexpr int32_t planeBitsPerPixel(int32_t plane) const noexcept;
+    int32_t           planeRowAlignment(int32_t plane) const noexcept;
+    Size2D            planeSize(Size2D imgSize, int32_t plane) const noexcept;
+    Swizzle           planeSwizzle(int32_t plane) const noexcept;
+    ImageFormat       planeFormat(int32_t plane) const noexcept;
 
 private:
     NVCVImageFormat m_format;
@@ -707,11 +708,9 @@ inline ImageFormat ImageFormat::dataKind(DataKind newDataKind) const
     return ImageFormat{out};
 }
 
-inline DataKind ImageFormat::dataKind() const noexcept
+constexpr DataKind ImageFormat::dataKind() const noexcept
 {
-    NVCVDataKind out;
-    detail::CheckThrow(nvcvImageFormatGetDataKind(m_format, &out));
-    return static_cast<DataKind>(out);
+    return static_cast<DataKind>(detail::ImageFormatDataKind(m_format));
 }
 
 inline ImageFormat ImageFormat::alphaType(AlphaType newAlphaType) const
@@ -721,11 +720,9 @@ inline ImageFormat ImageFormat::alphaType(AlphaType newAlphaType) const
     return ImageFormat{out};
 }
 
-inline AlphaType ImageFormat::alphaType() const noexcept
+constexpr AlphaType ImageFormat::alphaType() const noexcept
 {
-    NVCVAlphaType out;
-    detail::CheckThrow(nvcvImageFormatGetAlphaType(m_format, &out));
-    return static_cast<AlphaType>(out);
+    return static_cast<AlphaType>(detail::ImageFormatAlphaType(m_format));
 }
 
 inline ImageFormat ImageFormat::extraChannelInfo(const ExtraChannelInfo *exChannelInfo) const
@@ -749,11 +746,9 @@ inline ImageFormat ImageFormat::memLayout(MemLayout newMemLayout) const
     return ImageFormat{out};
 }
 
-inline MemLayout ImageFormat::memLayout() const noexcept
+constexpr MemLayout ImageFormat::memLayout() const noexcept
 {
-    NVCVMemLayout out;
-    detail::CheckThrow(nvcvImageFormatGetMemLayout(m_format, &out));
-    return static_cast<MemLayout>(out);
+    return static_cast<MemLayout>(detail::ImageFormatMemLayout(m_format));
 }
 
 inline ImageFormat ImageFormat::colorSpec(ColorSpec newColorSpec) const
@@ -798,11 +793,9 @@ inline RawPattern ImageFormat::rawPattern() const noexcept
     return static_cast<RawPattern>(out);
 }
 
-inline Swizzle ImageFormat::swizzle() const noexcept
+constexpr Swizzle ImageFormat::swizzle() const noexcept
 {
-    NVCVSwizzle out;
-    detail::CheckThrow(nvcvImageFormatGetSwizzle(m_format, &out));
-    return static_cast<Swizzle>(out);
+    return static_cast<Swizzle>(detail::ImageFormatSwizzle(m_format));
 }
 
 inline ColorModel ImageFormat::colorModel() const noexcept
@@ -833,11 +826,9 @@ inline uint32_t ImageFormat::fourCC() const
     return out;
 }
 
-inline int32_t ImageFormat::numPlanes() const noexcept
+constexpr int32_t ImageFormat::numPlanes() const noexcept
 {
-    int32_t out;
-    detail::CheckThrow(nvcvImageFormatGetNumPlanes(m_format, &out));
-    return out;
+    return detail::ImageFormatNumPlanes(m_format);
 }
 
 inline ImageFormat ImageFormat::swizzleAndPacking(Swizzle newSwizzle, Packing newPacking0, Packing newPacking1,
@@ -851,11 +842,9 @@ inline ImageFormat ImageFormat::swizzleAndPacking(Swizzle newSwizzle, Packing ne
     return ImageFormat{out};
 }
 
-inline Packing ImageFormat::planePacking(int32_t plane) const noexcept
+constexpr Packing ImageFormat::planePacking(int32_t plane) const noexcept
 {
-    NVCVPacking out;
-    detail::CheckThrow(nvcvImageFormatGetPlanePacking(m_format, plane, &out));
-    return static_cast<Packing>(out);
+    return static_cast<Packing>(detail::ImageFormatPlanePacking(m_format, plane));
 }
 
 inline DataType ImageFormat::planeDataType(int32_t plane) const noexcept
@@ -865,25 +854,19 @@ inline DataType ImageFormat::planeDataType(int32_t plane) const noexcept
     return static_cast<DataType>(out);
 }
 
-inline int32_t ImageFormat::planePixelStrideBytes(int32_t plane) const noexcept
+constexpr int32_t ImageFormat::planePixelStrideBytes(int32_t plane) const noexcept
 {
-    int32_t out;
-    detail::CheckThrow(nvcvImageFormatGetPlanePixelStrideBytes(m_format, plane, &out));
-    return out;
+    return detail::ImageFormatPlanePixelStrideBytes(m_format, plane);
 }
 
-inline int32_t ImageFormat::planeNumChannels(int32_t plane) const noexcept
+constexpr int32_t ImageFormat::planeNumChannels(int32_t plane) const noexcept
 {
-    int32_t out;
-    detail::CheckThrow(nvcvImageFormatGetPlaneNumChannels(m_format, plane, &out));
-    return out;
+    return detail::ImageFormatPlaneNumChannels(m_format, plane);
 }
 
-inline int32_t ImageFormat::planeBitsPerPixel(int32_t plane) const noexcept
+constexpr int32_t ImageFormat::planeBitsPerPixel(int32_t plane) const noexcept
 {
-    int32_t out;
-    detail::CheckThrow(nvcvImageFormatGetPlaneBitsPerPixel(m_format, plane, &out));
-    return out;
+    return detail::ImageFormatPlaneBitsPerPixel(m_format, plane);
 }
 
 inline int32_t ImageFormat::planeRowAlignment(int32_t plane) const noexcept
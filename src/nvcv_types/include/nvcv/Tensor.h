@@ -160,6 +160,35 @@ NVCV_PUBLIC NVCVStatus nvcvTensorCalcRequirementsForImages(int32_t numImages, in
 NVCV_PUBLIC NVCVStatus nvcvTensorConstruct(const NVCVTensorRequirements *reqs, NVCVAllocatorHandle alloc,
                                            NVCVTensorHandle *handle);
 
+/** Constructs a tensor instance with given requirements on the target resource.
+ *
+ * The tensor's memory layout is the one given by the requirements, whatever the target is. Its buffer is
+ * allocated with the size and alignment given by \p reqs, in the memory resource selected by \p target.
+ * The buffer type of the exported tensor data is \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA for cuda memory,
+ * and \ref NVCV_TENSOR_BUFFER_STRIDED_HOST for host and host pinned memory.
+ *
+ * @param [in] reqs Tensor requirements. Must have been filled by one of the nvcvTensorCalcRequirements functions.
+ *                  + Must not be NULL
+ *
+ * @param [in] alloc Allocator to be used to allocate needed memory buffers.
+ *                   The resource used depends on \p target.
+ *                   If NULL, it'll use the internal default allocator.
+ *                   + Allocator must not be destroyed while an tensor still refers to it.
+ *
+ * @param [in] target Memory resource where the tensor contents will be allocated.
+ *                    + Must be one of \ref NVCV_RESOURCE_MEM_CUDA, \ref NVCV_RESOURCE_MEM_HOST or
+ *                      \ref NVCV_RESOURCE_MEM_HOST_PINNED.
+ *
+ * @param [out] handle Where the tensor instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the tensor instance.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorConstructWithTarget(const NVCVTensorRequirements *reqs, NVCVAllocatorHandle alloc,
+                                                     NVCVResourceType target, NVCVTensorHandle *handle);
+
 /** Wraps an existing tensor buffer into an NVCV tensor instance constructed in given storage
  *
  * It allows for interoperation of external tensor representations with NVCV.
@@ -168,6 +197,7 @@ NVCV_PUBLIC NVCVStatus nvcvTensorConstruct(const NVCVTensorRequirements *reqs, N
  *                  + Must not be NULL.
  *                  + Allowed buffer types:
  *                    - \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA
+ *                    - \ref NVCV_TENSOR_BUFFER_STRIDED_HOST
  *
  * @param [in] cleanup Cleanup function to be called when the tensor is destroyed
  *                     via @ref nvcvTensorDecRef.
@@ -185,6 +215,43 @@ NVCV_PUBLIC NVCVStatus nvcvTensorConstruct(const NVCVTensorRequirements *reqs, N
 NVCV_PUBLIC NVCVStatus nvcvTensorWrapDataConstruct(const NVCVTensorData *data, NVCVTensorDataCleanupFunc cleanup,
                                                    void *ctxCleanup, NVCVTensorHandle *handle);
 
+/** Wraps several existing tensor buffers into NVCV tensor instances.
+ *
+ * It's equivalent to calling \ref nvcvTensorWrapDataConstruct for each buffer, but the
+ * resources for all tensors are reserved at once, and the properties shared by all
+ * tensors are validated only once.
+ *
+ * Either all tensors are created, or none is. In the latter case, the cleanup function isn't called.
+ *
+ * @param [in] numTensors Number of tensors to be created.
+ *                        + Must be >= 0.
+ *
+ * @param [in] data Array with the contents of each tensor, with \p numTensors elements.
+ *                  + Must not be NULL if \p numTensors > 0.
+ *                  + All elements must have the same buffer type, rank, data type and layout.
+ *                  + Allowed buffer types:
+ *                    - \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA
+ *                    - \ref NVCV_TENSOR_BUFFER_STRIDED_HOST
+ *
+ * @param [in] cleanup Cleanup function to be called when each tensor is destroyed
+ *                     via @ref nvcvTensorDecRef or @ref nvcvTensorDecRefMany.
+ *                     If NULL, no cleanup function is defined.
+ *
+ * @param [in] ctxCleanup Array with the pointer to be passed unchanged to the cleanup function of
+ *                        each tensor, with \p numTensors elements.
+ *                        If NULL, NULL is passed to the cleanup function of all tensors.
+ *
+ * @param [out] handles Where the tensor instance handles will be written to, with \p numTensors elements.
+ *                      + Must not be NULL if \p numTensors > 0.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the tensors.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorWrapDataConstructMany(int32_t numTensors, const NVCVTensorData *data,
+                                                       NVCVTensorDataCleanupFunc cleanup, void *const *ctxCleanup,
+                                                       NVCVTensorHandle *handles);
+
 /** Wraps an existing NVCV image into an NVCV tensor instance constructed in given storage
  *
  * Tensor layout is inferred from image characteristics.
@@ -240,6 +307,26 @@ NVCV_PUBLIC NVCVStatus nvcvTensorWrapImageConstruct(NVCVImageHandle img, NVCVTen
  */
 NVCV_PUBLIC NVCVStatus nvcvTensorDecRef(NVCVTensorHandle handle, int *newRefCount);
 
+/** Decrements the reference count of several tensors.
+ *
+ * It's equivalent to calling \ref nvcvTensorDecRef for each handle, in order.
+ *
+ * @param [in] numTensors Number of handles.
+ *                        + Must be >= 0.
+ *
+ * @param [in] handles Array with the tensors to be released, with \p numTensors elements.
+ *                     NULL handles are skipped.
+ *                     + Must not be NULL if \p numTensors > 0.
+ *
+ * @param [out] newRefCounts Array where the decremented reference count of each tensor will be written to.
+ *                           Can be NULL, if the caller isn't interested in the new reference counts.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some handle is invalid. The handles before it were released,
+ *                                      the ones after it were left untouched.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorDecRefMany(int32_t numTensors, const NVCVTensorHandle *handles, int *newRefCounts);
+
 /** Increments the reference count of an tensor.
  *
  * @param [in] handle       Tensor to be retained.
@@ -396,6 +483,43 @@ NVCV_PUBLIC NVCVStatus nvcvTensorGetShape(NVCVTensorHandle handle, int32_t *rank
 NVCV_PUBLIC NVCVStatus nvcvTensorReshape(NVCVTensorHandle handle, int32_t rank, const int64_t *shape,
                                          NVCVTensorLayout layout, NVCVTensorHandle *out_handle);
 
+/**
+ * Creates a view of a region of a tensor.
+ *
+ * The view shares the tensor's memory, no data is copied. It holds a reference to the tensor, which is kept
+ * alive at least as long as the view.
+ * For each dimension d, the view has the elements begin[d], begin[d]+step[d], ..., up to but excluding end[d].
+ * The layout and data type are the same as the tensor's.
+ *
+ * @param[in] handle Tensor to create a view from.
+ *                   + Must not be NULL.
+ *
+ * @param[in] rank Number of elements in the begin, end and step arguments.
+ *                 + Must be equal to the tensor rank.
+ *
+ * @param[in] begin Index of the first element of each dimension.
+ *                  + Must not be NULL.
+ *                  + Must be >= 0 and < end.
+ *
+ * @param[in] end Index past the last element of each dimension.
+ *                + Must not be NULL.
+ *                + Must be <= the tensor's shape.
+ *
+ * @param[in] step Distance between consecutive elements of each dimension in the view.
+ *                 If NULL, all steps are 1.
+ *                 + Must be >= 1.
+ *                 + Must be 1 in packed dimensions (the innermost one, or the two innermost ones for
+ *                   channel-last layouts), unless only one element of the dimension is taken.
+ *
+ * @param [out] out_handle Where the tensor instance handle will be written to.
+ *                         + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is invalid.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorSlice(NVCVTensorHandle handle, int32_t rank, const int64_t *begin, const int64_t *end,
+                                       const int64_t *step, NVCVTensorHandle *out_handle);
+
 #ifdef __cplusplus
 }
 #endif
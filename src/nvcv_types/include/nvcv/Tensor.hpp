@@ -28,6 +28,8 @@
 #include "alloc/Allocator.hpp"
 #include "detail/Callback.hpp"
 
+#include <vector>
+
 namespace nvcv {
 
 NVCV_IMPL_SHARED_HANDLE(Tensor);
@@ -112,6 +114,17 @@ public:
      */
     Tensor reshape(const TensorShape &new_shape);
 
+    /**
+     * @brief Creates a view of a region of the tensor, sharing its memory.
+     *
+     * @param begin Index of the first element of each dimension.
+     * @param end Index past the last element of each dimension.
+     * @param step Distance between consecutive elements of each dimension. If empty, all steps are 1.
+     * @return A tensor that refers to the selected elements, with the same layout and data type.
+     */
+    Tensor slice(const TensorShape::ShapeType &begin, const TensorShape::ShapeType &end,
+                 const TensorShape::ShapeType &step = {}) const;
+
     /**
      * @brief Calculates the requirements for a tensor given its shape and data type.
      *
@@ -142,6 +155,16 @@ public:
     explicit Tensor(const Requirements &reqs, const Allocator &alloc = nullptr);
     explicit Tensor(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign = {},
                     const Allocator &alloc = nullptr);
+
+    /**
+     * @brief Constructors that allocate the tensor contents on the given target resource.
+     *
+     * With \ref NVCV_RESOURCE_MEM_HOST or \ref NVCV_RESOURCE_MEM_HOST_PINNED, the tensor data can be exported
+     * as \ref TensorDataStridedHost.
+     */
+    explicit Tensor(const Requirements &reqs, NVCVResourceType target, const Allocator &alloc = nullptr);
+    explicit Tensor(const TensorShape &shape, DataType dtype, NVCVResourceType target,
+                    const MemAlignment &bufAlign = {}, const Allocator &alloc = nullptr);
     explicit Tensor(int numImages, Size2D imgSize, ImageFormat fmt, const MemAlignment &bufAlign = {},
                     const Allocator &alloc = nullptr);
 };
@@ -180,6 +203,32 @@ inline Tensor TensorWrapData(const TensorData &data, TensorDataCleanupCallback &
  */
 inline Tensor TensorWrapImage(const Image &img);
 
+/**
+ * @brief Wraps several tensor data into tensor objects at once.
+ *
+ * It's more efficient than calling \ref TensorWrapData for each tensor data.
+ * The wrapped buffers aren't owned by the tensors, they must outlive them.
+ *
+ * @param data Array of tensor data to be wrapped, all must have the same rank, data type and layout.
+ * @param count Number of elements in \p data.
+ * @return The tensor objects wrapping the given data, in the same order.
+ */
+inline std::vector<Tensor> TensorWrapDataMany(const TensorData *data, int32_t count);
+
+/**
+ * @brief Releases the references held by several tensors at once.
+ *
+ * It's more efficient than resetting each tensor individually.
+ * All tensors are left empty.
+ *
+ * If some tensors hold invalid handles, all the valid ones are still released
+ * and an exception is thrown afterwards.
+ *
+ * @param tensors Array of tensors to be released.
+ * @param count Number of elements in \p tensors.
+ */
+inline void TensorReleaseMany(Tensor *tensors, int32_t count);
+
 using TensorWrapHandle = NonOwningResource<Tensor>;
 
 // Tensor const ref optional definition ---------------------------
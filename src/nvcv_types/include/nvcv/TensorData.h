@@ -48,6 +48,9 @@ typedef enum
 
     /** GPU-accessible with equal-shape planes in pitch-linear layout. */
     NVCV_TENSOR_BUFFER_STRIDED_CUDA,
+
+    /** Host-accessible with equal-shape planes in pitch-linear layout. */
+    NVCV_TENSOR_BUFFER_STRIDED_HOST,
 } NVCVTensorBufferType;
 
 /** Represents the available methods to access image batch contents.
@@ -57,6 +60,7 @@ typedef union NVCVTensorBufferRec
     /** Tensor image batch stored in pitch-linear layout.
      * To be used when \ref NVCVTensorData::bufferType is:
      * - \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA
+     * - \ref NVCV_TENSOR_BUFFER_STRIDED_HOST
      */
     NVCVTensorBufferStrided strided;
 } NVCVTensorBuffer;
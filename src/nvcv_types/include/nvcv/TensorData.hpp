@@ -161,7 +161,7 @@ public:
      */
     static bool IsCompatibleKind(NVCVTensorBufferType kind)
     {
-        return kind == NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+        return kind == NVCV_TENSOR_BUFFER_STRIDED_CUDA || kind == NVCV_TENSOR_BUFFER_STRIDED_HOST;
     }
 
 protected:
@@ -208,6 +208,45 @@ public:
     }
 };
 
+/**
+ * @brief Represents strided tensor data specifically for host.
+ *
+ * The `TensorDataStridedHost` class extends `TensorDataStrided` to handle tensor data stored in a strided manner
+ * in host memory, either pageable or pinned.
+ */
+class TensorDataStridedHost : public TensorDataStrided
+{
+public:
+    using Buffer = NVCVTensorBufferStrided;
+
+    /**
+     * @brief Constructs a `TensorDataStridedHost` object from an `NVCVTensorData` instance.
+     *
+     * @param data The underlying tensor data representation.
+     */
+    TensorDataStridedHost(const NVCVTensorData &data);
+
+    /**
+     * @brief Constructs a `TensorDataStridedHost` object from tensor shape, data type, and buffer.
+     *
+     * @param tshape Shape of the tensor.
+     * @param dtype Data type of the tensor elements.
+     * @param buffer The underlying strided buffer in host memory.
+     */
+    TensorDataStridedHost(const TensorShape &tshape, const DataType &dtype, const Buffer &buffer);
+
+    /**
+     * @brief Determines if a given tensor buffer type is compatible with host strided data.
+     *
+     * @param kind The tensor buffer type to check.
+     * @return true if the buffer type is compatible with host strided data, false otherwise.
+     */
+    static bool IsCompatibleKind(NVCVTensorBufferType kind)
+    {
+        return kind == NVCV_TENSOR_BUFFER_STRIDED_HOST;
+    }
+};
+
 } // namespace nvcv
 
 #include "detail/TensorDataImpl.hpp"
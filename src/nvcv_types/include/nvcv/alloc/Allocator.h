@@ -53,6 +53,7 @@
 #include "../Export.h"
 #include "../Status.h"
 #include "Fwd.h"
+#include "Requirements.h"
 
 #include <stdalign.h>
 
@@ -163,6 +164,41 @@ typedef struct NVCVAllocator *NVCVAllocatorHandle;
 NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructCustom(const NVCVResourceAllocator *customAllocators,
                                                     int32_t numCustomAllocators, NVCVAllocatorHandle *handle);
 
+/** Constructs an allocator that places objects in memory allocated upfront.
+ *
+ * One block of each memory type is allocated from the parent allocator, with
+ * the size given by the requirements. It's meant to build several objects with
+ * a single allocation per memory type: sum their requirements with
+ * \ref nvcvRequirementsAdd, construct the arena with the sum, then construct
+ * each object passing the arena as its allocator.
+ *
+ * Buffers are grouped by alignment inside each block, so the objects whose
+ * requirements were summed always fit, no matter in which order they're
+ * constructed. Requirements only state the buffers' sizes, not which memory
+ * they're allocated in, so the requirements of tensors allocated in host or
+ * host-pinned memory must be added to the corresponding memory type with
+ * \ref nvcvMemRequirementsAddBuffer.
+ *
+ * Each object keeps a reference to the arena, the blocks are returned to the
+ * parent allocator after the arena handle and all objects created with it are
+ * destroyed. Memory freed by an object isn't reused by the arena.
+ *
+ * @param [in] reqs   Summed requirements of the objects to be constructed.
+ *                    + Must not be NULL.
+ *
+ * @param [in] parent Allocator that provides the arena's memory blocks.
+ *                    If NULL, the default allocator is used.
+ *
+ * @param [out] handle Where new instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the arena.
+ * @retval #NVCV_SUCCESS                Allocator created successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructArena(const NVCVRequirements *reqs, NVCVAllocatorHandle parent,
+                                                   NVCVAllocatorHandle *handle);
+
 /** Decrements the reference count of an existing allocator instance.
  *
  * The allocator is destroyed when its reference count reaches zero.
@@ -371,6 +407,30 @@ NVCV_PUBLIC NVCVStatus nvcvAllocatorAllocCudaMemory(NVCVAllocatorHandle halloc,
 NVCV_PUBLIC NVCVStatus nvcvAllocatorFreeCudaMemory(NVCVAllocatorHandle halloc, void *ptr, int64_t sizeBytes,
                                                    int32_t alignBytes);
 
+/** Records the memory allocations and frees done by an allocator in a trace file.
+ *
+ * The trace is a binary file with one record per event, with its time, thread, resource
+ * type, address, size and alignment. It's meant to be analyzed offline, e.g. to size
+ * memory pools.
+ *
+ * Only allocations done through the allocator object are recorded, i.e. the ones done by
+ * NVCV objects and by functions like \ref nvcvAllocatorAllocHostMemory. Calling the
+ * functions returned by \ref nvcvAllocatorGet directly bypasses tracing.
+ *
+ * All allocators can also be traced into a single file by setting the NVCV_ALLOC_TRACE
+ * environment variable to its path before the first allocation.
+ *
+ * @param [in] halloc Handle to the allocator to be traced.
+ *                    If NULL, the default allocator is traced, i.e. the one used by
+ *                    objects created without an allocator.
+ * @param [in] path   Path of the trace file. If it exists, it's overwritten.
+ *                    If NULL, tracing stops and the current trace file is closed.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT The handle is invalid or the file can't be created.
+ * @retval #NVCV_SUCCESS                Operation completed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorSetTraceFile(NVCVAllocatorHandle halloc, const char *path);
+
 /** Returns a string representation of the resource type.
  *
  * @param[in] resource Resource type whose name is to be returned.
@@ -23,6 +23,7 @@
 #include "../detail/CompilerUtils.h"
 #include "../detail/TypeTraits.hpp"
 #include "Allocator.h"
+#include "Requirements.hpp"
 
 #include <cassert>
 #include <cstddef>
@@ -221,6 +222,14 @@ public:
 
     template<typename ResAlloc>
     ResAlloc get() const;
+
+    /** Records the allocations done by this allocator in a trace file.
+     *
+     * @see nvcvAllocatorSetTraceFile
+     *
+     * @param path Path of the trace file, or nullptr to stop tracing.
+     */
+    void setTraceFile(const char *path) const;
 };
 
 ///////////////////////////////////////////////
@@ -425,6 +434,21 @@ CustomAllocator<ResourceAllocators...> CreateCustomAllocator(ResourceAllocators
     return CustomAllocator<ResourceAllocators...>{std::move(allocators)...};
 }
 
+/** An allocator that places the objects created with it in memory allocated upfront.
+ *
+ * @see nvcvAllocatorConstructArena
+ */
+class ArenaAllocator final : public Allocator
+{
+public:
+    /** Allocates the arena's memory.
+     *
+     * @param reqs   Summed requirements of the objects to be created with the arena.
+     * @param parent Allocator that provides the arena's memory, or the default one if null.
+     */
+    explicit ArenaAllocator(const Requirements &reqs, const Allocator &parent = nullptr);
+};
+
 } // namespace nvcv
 
 #include "AllocatorImpl.hpp"
@@ -55,6 +55,11 @@ ResAlloc Allocator::get() const
     return ResAlloc(data);
 }
 
+inline void Allocator::setTraceFile(const char *path) const
+{
+    detail::CheckThrow(nvcvAllocatorSetTraceFile(handle(), path));
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // CustomMemAllocator
 
@@ -199,6 +204,13 @@ inline CustomAllocator<ResourceAllocators...>::CustomAllocator(ResourceAllocator
     reset(std::move(h));
 }
 
+inline ArenaAllocator::ArenaAllocator(const Requirements &reqs, const Allocator &parent)
+{
+    NVCVAllocatorHandle h = {};
+    detail::CheckThrow(nvcvAllocatorConstructArena(&reqs.cdata(), parent.handle(), &h));
+    reset(std::move(h));
+}
+
 namespace detail {
 
 template<NVCVResourceType KIND>
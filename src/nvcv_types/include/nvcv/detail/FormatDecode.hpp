@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_DETAIL_FORMAT_DECODE_HPP
+#define NVCV_DETAIL_FORMAT_DECODE_HPP
+
+// Header-only decoding of the packed NVCVImageFormat and NVCVDataType
+// encodings defined in FormatUtils.h. The encodings are part of the ABI,
+// so these can be evaluated inline (and at compile time) without calling
+// into the library. Not to be used directly.
+
+#include "../DataType.h"
+#include "../ImageFormat.h"
+
+#include <cstdint>
+
+namespace nvcv { namespace detail {
+
+constexpr uint64_t ExtractFormatBitfield(uint64_t value, int offset, int length) noexcept
+{
+    return (value >> offset) & ((1ULL << length) - 1);
+}
+
+// Packing ======================================
+
+// |11 10 09 08|05 04|03 02 01 00|
+// |  ENC(BPP) |#CH-1|   PACK    |
+
+constexpr int32_t DecodeSubByteBitsPerPixel(int32_t code) noexcept
+{
+    return code <= 2 ? code : (code == 3 ? 4 : (code <= 7 ? 8 : 0));
+}
+
+constexpr int32_t DecodeBitsPerPixel(int32_t enc) noexcept
+{
+    // 1..3 -> 16, 24, 32; 4,5 -> 48, 64; 6,7 -> 96, 128; 8,9 -> 192, 256
+    return enc <= 3 ? (enc + 1) * 8
+                    : (enc <= 5 ? (enc - 1) * 16 : (enc <= 7 ? (enc - 3) * 32 : (enc <= 9 ? (enc - 5) * 64 : 0)));
+}
+
+constexpr int32_t PackingBitsPerPixel(NVCVPacking packing) noexcept
+{
+    return (packing >> 6) == 0 ? DecodeSubByteBitsPerPixel(packing & 0xF) : DecodeBitsPerPixel(packing >> 6);
+}
+
+constexpr int32_t PackingNumComponents(NVCVPacking packing) noexcept
+{
+    return packing == NVCV_PACKING_0 ? 0 : static_cast<int32_t>(ExtractFormatBitfield(packing, 4, 2)) + 1;
+}
+
+constexpr int32_t PackingNumChannels(NVCVPacking packing) noexcept
+{
+    // Sub-sampled packings have two luma components for one pixel
+    return packing == NVCV_PACKING_X8_Y8__X8_Z8 || packing == NVCV_PACKING_Y8_X8__Z8_X8
+             ? 3
+             : PackingNumComponents(packing);
+}
+
+// Image format =================================
+
+// Inverse of NVCV_DETAIL_ENCODE_PACKING
+constexpr NVCVPacking DecodePlanePacking(uint64_t value, int chlen, int packlen, int bpplen) noexcept
+{
+    return static_cast<NVCVPacking>((ExtractFormatBitfield(value, packlen + chlen, bpplen) << 6)
+                                    | (ExtractFormatBitfield(value, packlen, chlen) << 4)
+                                    | ExtractFormatBitfield(value, 0, packlen));
+}
+
+// The 4th plane has neither channel count nor packing code, and
+// its 128bpp representation (7) is used to denote NVCV_PACKING_X8.
+constexpr NVCVPacking DecodeFourthPlanePacking(uint64_t value) noexcept
+{
+    return value == 7 ? NVCV_PACKING_X8 : static_cast<NVCVPacking>(value << 6);
+}
+
+constexpr bool ImageFormatIsPlanar(NVCVImageFormat fmt) noexcept
+{
+    return ExtractFormatBitfield(fmt, 7, 1) != 0;
+}
+
+constexpr NVCVPacking ImageFormatPlanePacking(NVCVImageFormat fmt, int32_t plane) noexcept
+{
+    return plane == 0 ? DecodePlanePacking(ExtractFormatBitfield(fmt, 35, 9), 2, 3, 4)
+         : (plane < 0 || plane > 3 || !ImageFormatIsPlanar(fmt))
+             ? NVCV_PACKING_0
+             : (plane == 1   ? DecodePlanePacking(ExtractFormatBitfield(fmt, 44, 7), 1, 3, 3)
+                : plane == 2 ? DecodePlanePacking(ExtractFormatBitfield(fmt, 51, 7), 1, 3, 3)
+                             : DecodeFourthPlanePacking(ExtractFormatBitfield(fmt, 58, 3)));
+}
+
+constexpr int32_t ImageFormatPlaneNumChannels(NVCVImageFormat fmt, int32_t plane) noexcept
+{
+    return PackingNumChannels(ImageFormatPlanePacking(fmt, plane));
+}
+
+constexpr int32_t ImageFormatPlaneBitsPerPixel(NVCVImageFormat fmt, int32_t plane) noexcept
+{
+    return PackingBitsPerPixel(ImageFormatPlanePacking(fmt, plane));
+}
+
+constexpr int32_t ImageFormatNumPlanes(NVCVImageFormat fmt) noexcept
+{
+    return (ImageFormatPlaneNumChannels(fmt, 0) != 0 ? 1 : 0) + (ImageFormatPlaneNumChannels(fmt, 1) != 0 ? 1 : 0)
+         + (ImageFormatPlaneNumChannels(fmt, 2) != 0 ? 1 : 0) + (ImageFormatPlaneNumChannels(fmt, 3) != 0 ? 1 : 0);
+}
+
+constexpr NVCVDataKind ImageFormatDataKind(NVCVImageFormat fmt) noexcept
+{
+    return static_cast<NVCVDataKind>(ExtractFormatBitfield(fmt, 61, 3));
+}
+
+constexpr NVCVMemLayout ImageFormatMemLayout(NVCVImageFormat fmt) noexcept
+{
+    return static_cast<NVCVMemLayout>(ExtractFormatBitfield(fmt, 12, 3));
+}
+
+constexpr NVCVSwizzle ImageFormatSwizzle(NVCVImageFormat fmt) noexcept
+{
+    return static_cast<NVCVSwizzle>(ExtractFormatBitfield(fmt, 0, 6));
+}
+
+constexpr NVCVAlphaType ImageFormatAlphaType(NVCVImageFormat fmt) noexcept
+{
+    return static_cast<NVCVAlphaType>(ExtractFormatBitfield(fmt, 6, 1));
+}
+
+// Data type ====================================
+
+constexpr NVCVPacking DataTypePacking(NVCVDataType type) noexcept
+{
+    return ImageFormatPlanePacking(type, 0);
+}
+
+constexpr NVCVDataKind DataTypeDataKind(NVCVDataType type) noexcept
+{
+    return ImageFormatDataKind(type);
+}
+
+constexpr int32_t DataTypeBitsPerPixel(NVCVDataType type) noexcept
+{
+    return PackingBitsPerPixel(DataTypePacking(type));
+}
+
+constexpr int32_t DataTypeNumChannels(NVCVDataType type) noexcept
+{
+    return PackingNumChannels(DataTypePacking(type));
+}
+
+constexpr int32_t DataTypeStrideBytes(NVCVDataType type) noexcept
+{
+    return (DataTypeBitsPerPixel(type) + 7) / 8;
+}
+
+// Pixel stride of a plane is given by the data type of its pixels, where
+// sub-sampled packings amount to two channels per pixel.
+constexpr int32_t PackingPixelStrideBytes(NVCVDataKind dataKind, NVCVPacking packing) noexcept
+{
+    return packing == NVCV_PACKING_0 ? 0
+         : (packing == NVCV_PACKING_X8_Y8__X8_Z8 || packing == NVCV_PACKING_Y8_X8__Z8_X8)
+             ? DataTypeStrideBytes(NVCV_MAKE_DATA_TYPE(dataKind, NVCV_PACKING_X8_Y8))
+             : DataTypeStrideBytes(NVCV_MAKE_DATA_TYPE(dataKind, packing));
+}
+
+constexpr int32_t ImageFormatPlanePixelStrideBytes(NVCVImageFormat fmt, int32_t plane) noexcept
+{
+    return PackingPixelStrideBytes(ImageFormatDataKind(fmt), ImageFormatPlanePacking(fmt, plane));
+}
+
+}} // namespace nvcv::detail
+
+#endif // NVCV_DETAIL_FORMAT_DECODE_HPP
@@ -185,6 +185,13 @@ inline void ImageBatchVarShape::clear()
     detail::CheckThrow(nvcvImageBatchVarShapeClear(this->handle()));
 }
 
+inline ImageBatchVarShape ImageBatchVarShape::slice(int32_t begIndex, int32_t numImages) const
+{
+    NVCVImageBatchHandle handle;
+    detail::CheckThrow(nvcvImageBatchVarShapeSlice(this->handle(), begIndex, numImages, &handle));
+    return ImageBatchVarShape(std::move(handle));
+}
+
 inline Size2D ImageBatchVarShape::maxSize() const
 {
     Size2D s;
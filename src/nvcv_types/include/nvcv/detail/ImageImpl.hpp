@@ -102,6 +102,66 @@ inline Image ImageWrapData(const ImageData &data, ImageDataCleanupCallback &&cle
     return Image(std::move(handle));
 }
 
+inline std::vector<Image> ImageWrapDataMany(const ImageData *data, int32_t count)
+{
+    std::vector<NVCVImageData> cdata;
+    cdata.reserve(count);
+    for (int32_t i = 0; i < count; ++i)
+    {
+        cdata.push_back(data[i].cdata());
+    }
+
+    std::vector<NVCVImageHandle> handles(count);
+    detail::CheckThrow(nvcvImageWrapDataConstructMany(count, cdata.data(), nullptr, nullptr, handles.data()));
+
+    std::vector<Image> images;
+    images.reserve(count);
+    for (NVCVImageHandle &h : handles)
+    {
+        images.emplace_back(std::move(h));
+    }
+    return images;
+}
+
+inline void ImageReleaseMany(Image *images, int32_t count)
+{
+    std::vector<NVCVImageHandle> handles;
+    handles.reserve(count);
+    for (int32_t i = 0; i < count; ++i)
+    {
+        handles.push_back(images[i].release());
+    }
+
+    // Handles that weren't processed keep a negative count
+    std::vector<int> refCounts(count, -1);
+
+    NVCVStatus status = nvcvImageDecRefMany(count, handles.data(), refCounts.data());
+    if (status == NVCV_SUCCESS)
+    {
+        return;
+    }
+
+    try
+    {
+        detail::ThrowException(status);
+    }
+    catch (...)
+    {
+        // Processing stops at an invalid handle. The images don't own the handles
+        // after it anymore, release them so that they don't leak.
+        for (int32_t i = 0; i < count; ++i)
+        {
+            if (refCounts[i] < 0
+                && nvcvImageDecRefMany(count - i - 1, handles.data() + i + 1, refCounts.data() + i + 1) != NVCV_SUCCESS)
+            {
+                // Only the first error is reported
+                nvcvGetLastError();
+            }
+        }
+        throw;
+    }
+}
+
 } // namespace nvcv
 
 #endif // NVCV_IMAGE_IMPL_HPP
@@ -151,6 +151,31 @@ inline TensorDataStridedCuda::TensorDataStridedCuda(const NVCVTensorData &data)
     }
 }
 
+// TensorDataStridedHost implementation -----------------------
+
+inline TensorDataStridedHost::TensorDataStridedHost(const TensorShape &tshape, const DataType &dtype,
+                                                    const Buffer &buffer)
+{
+    NVCVTensorData &data = this->data();
+
+    std::copy(tshape.shape().begin(), tshape.shape().end(), data.shape);
+    data.rank   = tshape.rank();
+    data.dtype  = dtype;
+    data.layout = tshape.layout();
+
+    data.bufferType     = NVCV_TENSOR_BUFFER_STRIDED_HOST;
+    data.buffer.strided = buffer;
+}
+
+inline TensorDataStridedHost::TensorDataStridedHost(const NVCVTensorData &data)
+    : TensorDataStrided(data)
+{
+    if (!IsCompatibleKind(data.bufferType))
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Incompatible buffer type.");
+    }
+}
+
 } // namespace nvcv
 
 #endif // NVCV_TENSORDATA_IMPL_HPP
@@ -71,7 +71,7 @@ inline TensorData Tensor::exportData() const
     NVCVTensorData data;
     detail::CheckThrow(nvcvTensorExportData(this->handle(), &data));
 
-    if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+    if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA && data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_HOST)
     {
         throw Exception(Status::ERROR_INVALID_OPERATION, "Tensor data cannot be exported, buffer type not supported");
     }
@@ -100,6 +100,21 @@ inline Tensor Tensor::reshape(const TensorShape &new_shape)
     return out_tensor;
 }
 
+inline Tensor Tensor::slice(const TensorShape::ShapeType &begin, const TensorShape::ShapeType &end,
+                            const TensorShape::ShapeType &step) const
+{
+    if (begin.size() != end.size() || (step.size() != 0 && step.size() != begin.size()))
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Slice begin, end and step must have the same size");
+    }
+
+    NVCVTensorHandle out_handle;
+    // The shapes' storage always has MAX_RANK elements, it's safe to take their address even if empty.
+    detail::CheckThrow(nvcvTensorSlice(this->handle(), begin.size(), &*begin.begin(), &*end.begin(),
+                                       step.size() != 0 ? &*step.begin() : nullptr, &out_handle));
+    return Tensor(std::move(out_handle));
+}
+
 inline auto Tensor::CalcRequirements(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign)
     -> Requirements
 {
@@ -126,6 +141,13 @@ inline Tensor::Tensor(const Requirements &reqs, const Allocator &alloc)
     reset(std::move(handle));
 }
 
+inline Tensor::Tensor(const Requirements &reqs, NVCVResourceType target, const Allocator &alloc)
+{
+    NVCVTensorHandle handle;
+    detail::CheckThrow(nvcvTensorConstructWithTarget(&reqs, alloc.handle(), target, &handle));
+    reset(std::move(handle));
+}
+
 inline Tensor::Tensor(int numImages, Size2D imgSize, ImageFormat fmt, const MemAlignment &bufAlign,
                       const Allocator &alloc)
     : Tensor(CalcRequirements(numImages, imgSize, fmt, bufAlign), alloc)
@@ -137,6 +159,12 @@ inline Tensor::Tensor(const TensorShape &shape, DataType dtype, const MemAlignme
 {
 }
 
+inline Tensor::Tensor(const TensorShape &shape, DataType dtype, NVCVResourceType target, const MemAlignment &bufAlign,
+                      const Allocator &alloc)
+    : Tensor(CalcRequirements(shape, dtype, bufAlign), target, alloc)
+{
+}
+
 // Factory functions --------------------------------------------------
 
 inline Tensor TensorWrapData(const TensorData &data, TensorDataCleanupCallback &&cleanup)
@@ -155,6 +183,66 @@ inline Tensor TensorWrapImage(const Image &img)
     return Tensor(std::move(handle));
 }
 
+inline std::vector<Tensor> TensorWrapDataMany(const TensorData *data, int32_t count)
+{
+    std::vector<NVCVTensorData> cdata;
+    cdata.reserve(count);
+    for (int32_t i = 0; i < count; ++i)
+    {
+        cdata.push_back(data[i].cdata());
+    }
+
+    std::vector<NVCVTensorHandle> handles(count);
+    detail::CheckThrow(nvcvTensorWrapDataConstructMany(count, cdata.data(), nullptr, nullptr, handles.data()));
+
+    std::vector<Tensor> tensors;
+    tensors.reserve(count);
+    for (NVCVTensorHandle &h : handles)
+    {
+        tensors.emplace_back(std::move(h));
+    }
+    return tensors;
+}
+
+inline void TensorReleaseMany(Tensor *tensors, int32_t count)
+{
+    std::vector<NVCVTensorHandle> handles;
+    handles.reserve(count);
+    for (int32_t i = 0; i < count; ++i)
+    {
+        handles.push_back(tensors[i].release());
+    }
+
+    // Handles that weren't processed keep a negative count
+    std::vector<int> refCounts(count, -1);
+
+    NVCVStatus status = nvcvTensorDecRefMany(count, handles.data(), refCounts.data());
+    if (status == NVCV_SUCCESS)
+    {
+        return;
+    }
+
+    try
+    {
+        detail::ThrowException(status);
+    }
+    catch (...)
+    {
+        // Processing stops at an invalid handle. The tensors don't own the handles
+        // after it anymore, release them so that they don't leak.
+        for (int32_t i = 0; i < count; ++i)
+        {
+            if (refCounts[i] < 0
+                && nvcvTensorDecRefMany(count - i - 1, handles.data() + i + 1, refCounts.data() + i + 1) != NVCV_SUCCESS)
+            {
+                // Only the first error is reported
+                nvcvGetLastError();
+            }
+        }
+        throw;
+    }
+}
+
 } // namespace nvcv
 
 #endif // NVCV_TENSOR_IMPL_HPP
@@ -0,0 +1,191 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AllocTracer.hpp"
+
+#include "Exception.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+
+namespace nvcv::priv {
+
+namespace {
+
+constexpr const char *ALLOC_TRACE_ENVVAR = "NVCV_ALLOC_TRACE";
+
+// Traced events are buffered, the file is written in blocks of this size.
+constexpr size_t kBufferSize = 1 << 20;
+
+struct TracerRegistry
+{
+    std::mutex                                                           lock;
+    std::unordered_map<const IAllocator *, std::shared_ptr<AllocTracer>> tracers;
+};
+
+// Number of traced allocators, checked before looking them up.
+std::atomic<int> g_numTracedAllocators{0};
+
+TracerRegistry &Registry()
+{
+    // Never destroyed, allocators can be used during static destruction.
+    static TracerRegistry *registry = new TracerRegistry;
+    return *registry;
+}
+
+uint16_t ThreadId() noexcept
+{
+    static std::atomic<uint16_t> nextId{0};
+    thread_local uint16_t        id = nextId.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+} // namespace
+
+AllocTracer::AllocTracer(const char *path)
+{
+    if (path == nullptr)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Allocation trace file path must not be NULL");
+    }
+
+    m_file = fopen(path, "wb");
+    if (m_file == nullptr)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Can't create allocation trace file '%s': %s", path,
+                        strerror(errno));
+    }
+    setvbuf(m_file, nullptr, _IOFBF, kBufferSize);
+
+    util::AllocTraceHeader hdr = {};
+    memcpy(hdr.magic, util::AllocTraceHeader::MAGIC, sizeof(hdr.magic));
+    hdr.version    = util::AllocTraceHeader::VERSION;
+    hdr.recordSize = sizeof(util::AllocTraceRecord);
+    hdr.startTime  = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count();
+    m_start = std::chrono::steady_clock::now();
+
+    if (fwrite(&hdr, sizeof(hdr), 1, m_file) != 1)
+    {
+        fclose(m_file);
+        throw Exception(NVCV_ERROR_INTERNAL, "Can't write allocation trace file '%s'", path);
+    }
+}
+
+AllocTracer::~AllocTracer()
+{
+    fclose(m_file);
+}
+
+void AllocTracer::record(util::AllocTraceOp op, NVCVResourceType resType, const void *ptr, int64_t size,
+                         int32_t align) noexcept
+{
+    util::AllocTraceRecord rec;
+    rec.ptr     = reinterpret_cast<uintptr_t>(ptr);
+    rec.size    = size;
+    rec.align   = align;
+    rec.thread  = ThreadId();
+    rec.op      = op;
+    rec.resType = resType;
+
+    std::unique_lock lk(m_lock);
+    if (m_failed)
+    {
+        return;
+    }
+
+    // Taken while locked so that times are increasing along the file
+    rec.time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start)
+                   .count();
+
+    if (fwrite(&rec, sizeof(rec), 1, m_file) != 1)
+    {
+        // Don't keep on writing a trace with holes
+        m_failed = true;
+        lk.unlock();
+        std::cerr << "WARNING: failed writing allocation trace, tracing stopped" << std::endl;
+    }
+}
+
+AllocTracer *AllocTracer::FromEnv() noexcept
+{
+    // Never destroyed, so that allocations done during static destruction are still traced.
+    // Buffered events are flushed when the process exits.
+    static AllocTracer *tracer = []() -> AllocTracer *
+    {
+        const char *path = getenv(ALLOC_TRACE_ENVVAR);
+        if (path == nullptr || *path == '\0')
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            return new AllocTracer(path);
+        }
+        catch (std::exception &e)
+        {
+            std::cerr << "WARNING: " << ALLOC_TRACE_ENVVAR << " is set, but allocations can't be traced: " << e.what()
+                      << std::endl;
+            return nullptr;
+        }
+    }();
+
+    return tracer;
+}
+
+void SetAllocatorTracer(const IAllocator &alloc, std::shared_ptr<AllocTracer> tracer)
+{
+    TracerRegistry &reg = Registry();
+
+    // The previous tracer, if any, is closed after the lock is released
+    std::shared_ptr<AllocTracer> prevTracer;
+
+    std::lock_guard lk(reg.lock);
+    if (tracer)
+    {
+        prevTracer = std::exchange(reg.tracers[&alloc], std::move(tracer));
+    }
+    else if (auto it = reg.tracers.find(&alloc); it != reg.tracers.end())
+    {
+        prevTracer = std::move(it->second);
+        reg.tracers.erase(it);
+    }
+    g_numTracedAllocators.store(reg.tracers.size(), std::memory_order_relaxed);
+}
+
+std::shared_ptr<AllocTracer> GetAllocatorTracer(const IAllocator &alloc) noexcept
+{
+    if (g_numTracedAllocators.load(std::memory_order_relaxed) == 0)
+    {
+        return nullptr;
+    }
+
+    TracerRegistry &reg = Registry();
+
+    std::lock_guard lk(reg.lock);
+    auto            it = reg.tracers.find(&alloc);
+    return it != reg.tracers.end() ? it->second : nullptr;
+}
+
+} // namespace nvcv::priv
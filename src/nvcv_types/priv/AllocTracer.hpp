@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_ALLOC_TRACER_HPP
+#define NVCV_CORE_PRIV_ALLOC_TRACER_HPP
+
+#include <nvcv/alloc/Allocator.h>
+#include <util/AllocTraceFormat.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+namespace nvcv::priv {
+
+class IAllocator;
+
+/** Writes allocation and free events to a trace file.
+ *
+ * The file format is described by @ref util::AllocTraceHeader. Events are serialized
+ * by a mutex, so that they appear in the file in the order they happened. Frees must
+ * be recorded before the memory is released and allocations after they're done, so
+ * that the same address never appears allocated twice.
+ */
+class AllocTracer
+{
+public:
+    // Truncates the file if it exists.
+    explicit AllocTracer(const char *path);
+    ~AllocTracer();
+
+    AllocTracer(const AllocTracer &)            = delete;
+    AllocTracer &operator=(const AllocTracer &) = delete;
+
+    void record(util::AllocTraceOp op, NVCVResourceType resType, const void *ptr, int64_t size,
+                int32_t align) noexcept;
+
+    // Tracer of all allocators, enabled by setting NVCV_ALLOC_TRACE to the trace file path.
+    // Returns nullptr if the variable isn't set.
+    static AllocTracer *FromEnv() noexcept;
+
+private:
+    std::mutex                            m_lock;
+    FILE                                 *m_file;
+    std::chrono::steady_clock::time_point m_start;
+    bool                                  m_failed = false;
+};
+
+// Tracers of individual allocators are kept aside, as the allocator interface can't
+// change. Tracing of an allocator stops when tracer is null.
+void SetAllocatorTracer(const IAllocator &alloc, std::shared_ptr<AllocTracer> tracer);
+
+// Returns nullptr if the allocator isn't traced.
+std::shared_ptr<AllocTracer> GetAllocatorTracer(const IAllocator &alloc) noexcept;
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_ALLOC_TRACER_HPP
@@ -18,6 +18,7 @@
 #ifndef NVCV_PRIV_CORE_ALLOCATORMANAGER_HPP
 #define NVCV_PRIV_CORE_ALLOCATORMANAGER_HPP
 
+#include "ArenaAllocator.hpp"
 #include "CustomAllocator.hpp"
 #include "DefaultAllocator.hpp"
 #include "IContext.hpp"
@@ -29,7 +30,7 @@ using AllocatorManager = CoreObjManager<NVCVAllocatorHandle>;
 template<>
 struct ResourceStorage<IAllocator>
 {
-    using type = CompatibleStorage<DefaultAllocator, CustomAllocator>;
+    using type = CompatibleStorage<DefaultAllocator, CustomAllocator, ArenaAllocator>;
     ;
 };
 
@@ -0,0 +1,293 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ArenaAllocator.hpp"
+
+#include "AllocTracer.hpp"
+#include "Exception.hpp"
+#include "Requirements.hpp"
+
+#include <util/Math.hpp>
+
+#include <limits>
+
+namespace nvcv::priv {
+
+namespace {
+
+const char *GetMemoryName(NVCVResourceType resType)
+{
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        return "host memory";
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        return "host-pinned memory";
+    case NVCV_RESOURCE_MEM_CUDA:
+        return "cuda memory";
+    }
+    return "unknown memory";
+}
+
+} // namespace
+
+ArenaLayout::ArenaLayout(const NVCVMemRequirements &reqs)
+{
+    int64_t totalSize = CalcTotalSizeBytes(reqs);
+
+    m_alignBytes  = 1;
+    int64_t start = 0;
+    for (int i = kNumRegions - 1; i >= 0; --i)
+    {
+        if (reqs.numBlocks[i] > 0 && m_alignBytes == 1)
+        {
+            m_alignBytes = int64_t{1} << i;
+        }
+
+        m_next[i] = start;
+        start += reqs.numBlocks[i] << i;
+        m_end[i] = start;
+    }
+    NVCV_ASSERT(start == totalSize);
+
+    m_sizeBytes = util::RoundUpPowerOfTwo(totalSize, m_alignBytes);
+}
+
+int64_t ArenaLayout::sizeBytes() const
+{
+    return m_sizeBytes;
+}
+
+int64_t ArenaLayout::alignBytes() const
+{
+    return m_alignBytes;
+}
+
+int64_t ArenaLayout::place(int64_t size, int32_t align)
+{
+    NVCV_ASSERT(size >= 0);
+    NVCV_ASSERT(util::IsPowerOfTwo(align));
+
+    for (int i = util::ILog2(align); i < kNumRegions; ++i)
+    {
+        int64_t bufSize = util::RoundUpPowerOfTwo(size, int64_t{1} << i);
+        if (m_end[i] - m_next[i] >= bufSize)
+        {
+            int64_t offset = m_next[i];
+            m_next[i] += bufSize;
+            return offset;
+        }
+    }
+    return -1;
+}
+
+ArenaAllocator::ArenaAllocator(const NVCVRequirements &reqs, IAllocator &parent)
+    : m_parent{parent}
+{
+    try
+    {
+        m_hostMem       = allocBlock(NVCV_RESOURCE_MEM_HOST, reqs.hostMem);
+        m_hostPinnedMem = allocBlock(NVCV_RESOURCE_MEM_HOST_PINNED, reqs.hostPinnedMem);
+        m_cudaMem       = allocBlock(NVCV_RESOURCE_MEM_CUDA, reqs.cudaMem);
+    }
+    catch (...)
+    {
+        freeBlock(NVCV_RESOURCE_MEM_HOST, m_hostMem);
+        freeBlock(NVCV_RESOURCE_MEM_HOST_PINNED, m_hostPinnedMem);
+        throw;
+    }
+}
+
+ArenaAllocator::~ArenaAllocator()
+{
+    // Another allocator might be created at the same address
+    SetAllocatorTracer(*this, nullptr);
+
+    freeBlock(NVCV_RESOURCE_MEM_HOST, m_hostMem);
+    freeBlock(NVCV_RESOURCE_MEM_HOST_PINNED, m_hostPinnedMem);
+    freeBlock(NVCV_RESOURCE_MEM_CUDA, m_cudaMem);
+}
+
+auto ArenaAllocator::allocBlock(NVCVResourceType resType, const NVCVMemRequirements &reqs) -> std::unique_ptr<Block>
+{
+    auto block = std::make_unique<Block>(Block{ArenaLayout{reqs}, nullptr});
+
+    int64_t size = block->layout.sizeBytes();
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    if (block->layout.alignBytes() > std::numeric_limits<int32_t>::max())
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Arena alignment must be <= %d, not %ld",
+                        std::numeric_limits<int32_t>::max(), block->layout.alignBytes());
+    }
+    int32_t align = static_cast<int32_t>(block->layout.alignBytes());
+
+    // The block isn't counted in the allocator stats, the buffers placed in it are.
+    ForwardedAllocScope scope;
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        block->base = m_parent->allocHostMem(size, align);
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        block->base = m_parent->allocHostPinnedMem(size, align);
+        break;
+    case NVCV_RESOURCE_MEM_CUDA:
+        block->base = m_parent->allocCudaMem(size, align);
+        break;
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Unknown resource type: " << resType << ".";
+    }
+    return block;
+}
+
+void ArenaAllocator::freeBlock(NVCVResourceType resType, std::unique_ptr<Block> &block) noexcept
+{
+    if (!block)
+    {
+        return;
+    }
+
+    int64_t size  = block->layout.sizeBytes();
+    int32_t align = static_cast<int32_t>(block->layout.alignBytes());
+
+    ForwardedAllocScope scope;
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        m_parent->freeHostMem(block->base, size, align);
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        m_parent->freeHostPinnedMem(block->base, size, align);
+        break;
+    case NVCV_RESOURCE_MEM_CUDA:
+        m_parent->freeCudaMem(block->base, size, align);
+        break;
+    default:
+        NVCV_ASSERT(!"Unknown resource type");
+    }
+    block.reset();
+}
+
+void *ArenaAllocator::place(NVCVResourceType resType, Block *block, int64_t size, int32_t align)
+{
+    int64_t offset;
+    {
+        std::lock_guard lk(m_lock);
+        offset = block ? block->layout.place(size, align) : -1;
+    }
+
+    if (offset < 0)
+    {
+        throw Exception(NVCV_ERROR_OUT_OF_MEMORY,
+                        "Arena has no room left for %ld bytes of %s aligned at %d bytes, its allocations must match "
+                        "the requirements it was created with",
+                        size, GetMemoryName(resType), align);
+    }
+
+    return static_cast<std::byte *>(block->base) + offset;
+}
+
+void *ArenaAllocator::doAllocHostMem(int64_t size, int32_t align)
+{
+    return place(NVCV_RESOURCE_MEM_HOST, m_hostMem.get(), size, align);
+}
+
+void ArenaAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    // Memory is returned to the parent allocator when the arena is destroyed
+    (void)ptr;
+    (void)size;
+    (void)align;
+}
+
+void *ArenaAllocator::doAllocHostPinnedMem(int64_t size, int32_t align)
+{
+    return place(NVCV_RESOURCE_MEM_HOST_PINNED, m_hostPinnedMem.get(), size, align);
+}
+
+void ArenaAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    (void)ptr;
+    (void)size;
+    (void)align;
+}
+
+void *ArenaAllocator::doAllocCudaMem(int64_t size, int32_t align)
+{
+    return place(NVCV_RESOURCE_MEM_CUDA, m_cudaMem.get(), size, align);
+}
+
+void ArenaAllocator::doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    (void)ptr;
+    (void)size;
+    (void)align;
+}
+
+NVCVResourceAllocator ArenaAllocator::doGet(NVCVResourceType resType)
+{
+    NVCVResourceAllocator custAllocator = {};
+    custAllocator.ctx                   = this;
+    custAllocator.resType               = resType;
+
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        custAllocator.res.mem.fnAlloc = [](void *ctx, int64_t size, int32_t align)
+        {
+            return static_cast<ArenaAllocator *>(ctx)->allocHostMem(size, align);
+        };
+        custAllocator.res.mem.fnFree = [](void *ctx, void *ptr, int64_t size, int32_t align)
+        {
+            static_cast<ArenaAllocator *>(ctx)->freeHostMem(ptr, size, align);
+        };
+        break;
+
+    case NVCV_RESOURCE_MEM_CUDA:
+        custAllocator.res.mem.fnAlloc = [](void *ctx, int64_t size, int32_t align)
+        {
+            return static_cast<ArenaAllocator *>(ctx)->allocCudaMem(size, align);
+        };
+        custAllocator.res.mem.fnFree = [](void *ctx, void *ptr, int64_t size, int32_t align)
+        {
+            static_cast<ArenaAllocator *>(ctx)->freeCudaMem(ptr, size, align);
+        };
+        break;
+
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        custAllocator.res.mem.fnAlloc = [](void *ctx, int64_t size, int32_t align)
+        {
+            return static_cast<ArenaAllocator *>(ctx)->allocHostPinnedMem(size, align);
+        };
+        custAllocator.res.mem.fnFree = [](void *ctx, void *ptr, int64_t size, int32_t align)
+        {
+            static_cast<ArenaAllocator *>(ctx)->freeHostPinnedMem(ptr, size, align);
+        };
+        break;
+
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Unknown resource type: " << resType << ".";
+    }
+
+    return custAllocator;
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_ARENA_ALLOCATOR_HPP
+#define NVCV_CORE_PRIV_ARENA_ALLOCATOR_HPP
+
+#include "IAllocator.hpp"
+#include "SharedCoreObj.hpp"
+
+#include <nvcv/alloc/Requirements.h>
+
+#include <memory>
+#include <mutex>
+
+namespace nvcv::priv {
+
+// Places buffers in a block whose size is given by memory requirements.
+// The block is split in one region per alignment, from the largest alignment
+// to the smallest, so every region starts at an offset that is a multiple of
+// its alignment. Placing the same buffers that were added to the requirements,
+// in any order, fills the block exactly.
+class ArenaLayout
+{
+public:
+    explicit ArenaLayout(const NVCVMemRequirements &reqs);
+
+    // Block size, rounded up to a multiple of its alignment.
+    int64_t sizeBytes() const;
+
+    // Largest alignment in the requirements, the block's base must be aligned to it.
+    int64_t alignBytes() const;
+
+    // Returns the offset of a buffer in the block, or -1 if there's no room left.
+    // When the region of the buffer's alignment is full, regions with larger
+    // alignment are used.
+    int64_t place(int64_t size, int32_t align);
+
+private:
+    static constexpr int kNumRegions = NVCV_MAX_MEM_REQUIREMENTS_LOG2_BLOCK_SIZE;
+
+    int64_t m_next[kNumRegions]; // next free offset in each region
+    int64_t m_end[kNumRegions];  // end offset of each region
+    int64_t m_sizeBytes;
+    int64_t m_alignBytes;
+};
+
+// Serves the allocations of several objects from one block per resource type,
+// allocated upfront from a parent allocator and sized after the objects' summed
+// requirements. Objects keep a reference to their allocator, so the blocks are
+// returned to the parent only when the last object built in them is destroyed.
+// Memory freed by an object isn't reused.
+class ArenaAllocator final : public CoreObjectBase<IAllocator>
+{
+public:
+    ArenaAllocator(const NVCVRequirements &reqs, IAllocator &parent);
+    ~ArenaAllocator();
+
+private:
+    struct Block
+    {
+        ArenaLayout layout;
+        void       *base;
+    };
+
+    SharedCoreObj<IAllocator> m_parent;
+
+    std::mutex             m_lock;
+    std::unique_ptr<Block> m_hostMem, m_hostPinnedMem, m_cudaMem;
+
+    std::unique_ptr<Block> allocBlock(NVCVResourceType resType, const NVCVMemRequirements &reqs);
+    void                   freeBlock(NVCVResourceType resType, std::unique_ptr<Block> &block) noexcept;
+
+    void *place(NVCVResourceType resType, Block *block, int64_t size, int32_t align);
+
+    void *doAllocHostMem(int64_t size, int32_t align) override;
+    void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    void *doAllocHostPinnedMem(int64_t size, int32_t align) override;
+    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    void *doAllocCudaMem(int64_t size, int32_t align) override;
+    void  doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    NVCVResourceAllocator doGet(NVCVResourceType resType) override;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_ARENA_ALLOCATOR_HPP
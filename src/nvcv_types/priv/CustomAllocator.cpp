@@ -17,6 +17,7 @@
 
 #include "CustomAllocator.hpp"
 
+#include "AllocTracer.hpp"
 #include "DefaultAllocator.hpp"
 
 #include <cuda_runtime.h>
@@ -108,6 +109,9 @@ CustomAllocator::CustomAllocator(const NVCVResourceAllocator *customAllocators,
 
 CustomAllocator::~CustomAllocator()
 {
+    // Another allocator might be created at the same address
+    SetAllocatorTracer(*this, nullptr);
+
     for (NVCVResourceAllocator &alloc : m_allocators)
     {
         if (alloc.cleanup)
@@ -21,6 +21,7 @@
 #include "Exception.hpp"
 #include "TLS.hpp"
 
+#include <nvcv/detail/FormatDecode.hpp>
 #include <util/Assert.h>
 #include <util/Math.hpp>
 #include <util/String.hpp>
@@ -469,7 +470,7 @@ std::optional<NVCVPacking> MakeNVCVPacking(const NVCVPackingParams &params) noex
     }
 }
 
-const uint64_t swizzleBitsArray[NVCV_MAX_SWIZZLE_COUNT]
+constexpr uint64_t swizzleBitsArray[NVCV_MAX_SWIZZLE_COUNT]
     = {NVCV_DETAIL_MAKE_SWZL(0, 0, 0, 0), NVCV_DETAIL_MAKE_SWZL(X, 0, 0, 0), NVCV_DETAIL_MAKE_SWZL(X, Y, 0, 0),
        NVCV_DETAIL_MAKE_SWZL(X, Y, Z, 0), NVCV_DETAIL_MAKE_SWZL(X, Y, Z, W), NVCV_DETAIL_MAKE_SWZL(1, 0, 0, 0),
        NVCV_DETAIL_MAKE_SWZL(0, 0, 0, 1), NVCV_DETAIL_MAKE_SWZL(Z, Y, X, W), NVCV_DETAIL_MAKE_SWZL(W, X, Y, Z),
@@ -490,18 +491,55 @@ const uint64_t swizzleBitsArray[NVCV_MAX_SWIZZLE_COUNT]
        NVCV_DETAIL_MAKE_SWZL(X, Y, W, 0), NVCV_DETAIL_MAKE_SWZL(Y, Z, W, 0), NVCV_DETAIL_MAKE_SWZL(Y, Z, 0, 0),
        NVCV_DETAIL_MAKE_SWZL(0, 0, X, 1), NVCV_DETAIL_MAKE_SWZL(0, Z, X, Y)};
 
-NVCVSwizzle MakeNVCVSwizzle(NVCVChannel x, NVCVChannel y, NVCVChannel z, NVCVChannel w) noexcept
+namespace {
+
+constexpr int kSwizzleBits = 12;
+
+// Maps the bits of a swizzle's 4 channels to the NVCVSwizzle, or -1 if not supported.
+constexpr std::array<int8_t, 1 << kSwizzleBits> MakeSwizzleFromBitsTable()
 {
-    NVCVSwizzle swizzle     = NVCV_SWIZZLE_UNSUPPORTED;
-    uint64_t    swizzleBits = NVCV_DETAIL_MAKE_SWIZZLE(x, y, z, w);
-    for (int i = 0; i < NVCV_MAX_SWIZZLE_COUNT; i++)
+    std::array<int8_t, 1 << kSwizzleBits> table{};
+    for (size_t i = 0; i < table.size(); ++i)
     {
-        if (swizzleBitsArray[i] == swizzleBits)
+        table[i] = -1;
+    }
+    // Going backwards so that the first swizzle wins if two have the same channels.
+    for (int i = NVCV_MAX_SWIZZLE_COUNT - 1; i >= 0; --i)
+    {
+        table[swizzleBitsArray[i]] = i;
+    }
+    return table;
+}
+
+constexpr std::array<int8_t, 1 << kSwizzleBits> g_SwizzleFromBits = MakeSwizzleFromBitsTable();
+
+// Swizzle names are their channels, such as "XYZ1".
+constexpr std::array<std::array<char, 5>, NVCV_MAX_SWIZZLE_COUNT> MakeSwizzleNames()
+{
+    constexpr char channelNames[] = "0XYZW1??";
+
+    std::array<std::array<char, 5>, NVCV_MAX_SWIZZLE_COUNT> names{};
+    for (int i = 0; i < NVCV_MAX_SWIZZLE_COUNT; ++i)
+    {
+        for (int c = 0; c < 4; ++c)
         {
-            return (NVCVSwizzle)i;
+            names[i][c] = channelNames[ExtractBitfield(swizzleBitsArray[i], c * 3, 3)];
         }
     }
-    return swizzle;
+    return names;
+}
+
+constexpr std::array<std::array<char, 5>, NVCV_MAX_SWIZZLE_COUNT> g_SwizzleNames = MakeSwizzleNames();
+
+} // namespace
+
+NVCVSwizzle MakeNVCVSwizzle(NVCVChannel x, NVCVChannel y, NVCVChannel z, NVCVChannel w) noexcept
+{
+    uint64_t swizzleBits = NVCV_DETAIL_MAKE_SWIZZLE(x, y, z, w);
+    static_assert(NVCV_DETAIL_MAKE_SWIZZLE(7, 7, 7, 7) < (1 << kSwizzleBits));
+
+    int swizzle = g_SwizzleFromBits[swizzleBits];
+    return swizzle >= 0 ? (NVCVSwizzle)swizzle : NVCV_SWIZZLE_UNSUPPORTED;
 }
 
 bool IsSubWord(const NVCVPackingParams &p)
@@ -544,89 +582,14 @@ NVCVPackingParams GetPackingParams(NVCVPacking packing) noexcept
 
 int GetBitsPerPixel(NVCVPacking packing) noexcept
 {
-    int bpp = packing >> 6;
-
-    // If bpp <= 8, we store it in the packing. This limits
-    // the number of packings there can be (LSB bits), but this number is
-    // naturally limited.
-    if (bpp == 0)
-    {
-        int code = packing & 0b1111;
-
-        if (code == 0)
-        {
-            NVCV_ASSERT(bpp == 0);
-            NVCV_ASSERT(packing == NVCV_PACKING_0);
-        }
-        else if (code <= 2)
-        {
-            bpp = code;
-        }
-        else if (code == 3)
-        {
-            bpp = 4;
-        }
-        else if (code <= 0b111)
-        {
-            bpp = 8;
-        }
-        else
-        {
-            // invalid
-            return 0;
-        }
-    }
-    else
-    {
-        // Now we decode like this:
-        // 1 -> 16 bpp
-        // 2 -> 24 bpp
-        // 3 -> 32 bpp
-        //
-        // 4 -> 48 bpp
-        // 5 -> 64 bpp
-        //
-        // 6 -> 96 bpp
-        // 7 -> 128 bpp
-        //
-        // 8 -> 192 bpp
-        // 9 -> 256 bpp
-
-        if (bpp <= 3)
-        {
-            bpp = (bpp + 1) * 8;
-        }
-        else if (bpp <= 5)
-        {
-            bpp = (bpp - 1) * 16;
-        }
-        else if (bpp <= 7)
-        {
-            bpp = (bpp - 3) * 32;
-        }
-        else if (bpp <= 9)
-        {
-            bpp = (bpp - 5) * 64;
-        }
-        else
-        {
-            // invalid;
-            return 0;
-        }
-    }
-
-    return bpp;
+    return nvcv::detail::PackingBitsPerPixel(packing);
 }
 
 NVCVChannel GetSwizzleChannel(NVCVSwizzle swizzle, int idx) noexcept
 {
-    // initialize with max in case swizzle is not supported
-    uint64_t swizzleBits = UINT64_MAX;
-    for (int i = 0; i < NVCV_MAX_SWIZZLE_COUNT; i++)
-    {
-        if (swizzle == i)
-            swizzleBits = swizzleBitsArray[i];
-    }
+    // all ones in case swizzle is not supported
+    uint64_t swizzleBits
+        = 0 <= swizzle && swizzle < NVCV_MAX_SWIZZLE_COUNT ? swizzleBitsArray[swizzle] : UINT64_MAX;
     return (NVCVChannel)ExtractBitfield(swizzleBits, idx * 3, 3);
 }
 
@@ -675,31 +638,12 @@ int GetBlockHeightLog2(NVCVMemLayout memLayout) noexcept
 
 int GetNumComponents(NVCVPacking packing) noexcept
 {
-    if (packing == NVCV_PACKING_0)
-    {
-        return 0;
-    }
-    else
-    {
-        return ExtractBitfield(packing, 4, 2) + 1;
-    }
+    return nvcv::detail::PackingNumComponents(packing);
 }
 
 int GetNumChannels(NVCVPacking packing) noexcept
 {
-    int cnt = GetNumComponents(packing);
-
-    switch (packing)
-    {
-    case NVCV_PACKING_X8_Y8__X8_Z8:
-    case NVCV_PACKING_Y8_X8__Z8_X8:
-        NVCV_ASSERT(cnt == 4);
-        cnt = 3;
-        break;
-    default:
-        break;
-    }
-    return cnt;
+    return nvcv::detail::PackingNumChannels(packing);
 }
 
 std::array<int32_t, 4> GetBitsPerComponent(NVCVPacking packing) noexcept
@@ -982,6 +926,11 @@ const char *GetName(NVCVExtraChannel channelType)
 
 const char *GetName(NVCVSwizzle swizzle)
 {
+    if (0 <= swizzle && swizzle < NVCV_MAX_SWIZZLE_COUNT)
+    {
+        return g_SwizzleNames[swizzle].data();
+    }
+
     std::array<NVCVChannel, 4> channels = priv::GetChannels(swizzle);
 
     priv::CoreTLS &tls = priv::GetCoreTLS();
@@ -20,6 +20,7 @@
 #include "DataLayout.hpp"
 #include "Exception.hpp"
 #include "ImageFormat.hpp"
+#include "LookupTable.hpp"
 
 #include <util/Assert.h>
 #include <util/Math.hpp>
@@ -82,78 +83,85 @@ int DataType::alignment() const noexcept
     return GetAlignment(packing());
 }
 
+namespace {
+
+struct DataTypeName
+{
+    NVCVDataType type;
+    const char  *name;
+};
+
+constexpr DataTypeName g_DataTypeNames[] = {
+#define NVCV_ENUM(E) {E, #E}
+    NVCV_ENUM(NVCV_DATA_TYPE_NONE),
+    NVCV_ENUM(NVCV_DATA_TYPE_U8),
+    NVCV_ENUM(NVCV_DATA_TYPE_2U8),
+    NVCV_ENUM(NVCV_DATA_TYPE_3U8),
+    NVCV_ENUM(NVCV_DATA_TYPE_4U8),
+    NVCV_ENUM(NVCV_DATA_TYPE_S8),
+    NVCV_ENUM(NVCV_DATA_TYPE_2S8),
+    NVCV_ENUM(NVCV_DATA_TYPE_3S8),
+    NVCV_ENUM(NVCV_DATA_TYPE_4S8),
+    NVCV_ENUM(NVCV_DATA_TYPE_U16),
+    NVCV_ENUM(NVCV_DATA_TYPE_2U16),
+    NVCV_ENUM(NVCV_DATA_TYPE_3U16),
+    NVCV_ENUM(NVCV_DATA_TYPE_4U16),
+    NVCV_ENUM(NVCV_DATA_TYPE_S16),
+    NVCV_ENUM(NVCV_DATA_TYPE_2S16),
+    NVCV_ENUM(NVCV_DATA_TYPE_3S16),
+    NVCV_ENUM(NVCV_DATA_TYPE_4S16),
+    NVCV_ENUM(NVCV_DATA_TYPE_U32),
+    NVCV_ENUM(NVCV_DATA_TYPE_2U32),
+    NVCV_ENUM(NVCV_DATA_TYPE_3U32),
+    NVCV_ENUM(NVCV_DATA_TYPE_4U32),
+    NVCV_ENUM(NVCV_DATA_TYPE_S32),
+    NVCV_ENUM(NVCV_DATA_TYPE_2S32),
+    NVCV_ENUM(NVCV_DATA_TYPE_3S32),
+    NVCV_ENUM(NVCV_DATA_TYPE_4S32),
+    NVCV_ENUM(NVCV_DATA_TYPE_F16),
+    NVCV_ENUM(NVCV_DATA_TYPE_2F16),
+    NVCV_ENUM(NVCV_DATA_TYPE_3F16),
+    NVCV_ENUM(NVCV_DATA_TYPE_4F16),
+    NVCV_ENUM(NVCV_DATA_TYPE_F32),
+    NVCV_ENUM(NVCV_DATA_TYPE_2F32),
+    NVCV_ENUM(NVCV_DATA_TYPE_3F32),
+    NVCV_ENUM(NVCV_DATA_TYPE_4F32),
+    NVCV_ENUM(NVCV_DATA_TYPE_U64),
+    NVCV_ENUM(NVCV_DATA_TYPE_2U64),
+    NVCV_ENUM(NVCV_DATA_TYPE_3U64),
+    NVCV_ENUM(NVCV_DATA_TYPE_4U64),
+    NVCV_ENUM(NVCV_DATA_TYPE_S64),
+    NVCV_ENUM(NVCV_DATA_TYPE_2S64),
+    NVCV_ENUM(NVCV_DATA_TYPE_3S64),
+    NVCV_ENUM(NVCV_DATA_TYPE_4S64),
+    NVCV_ENUM(NVCV_DATA_TYPE_F64),
+    NVCV_ENUM(NVCV_DATA_TYPE_2F64),
+    NVCV_ENUM(NVCV_DATA_TYPE_3F64),
+    NVCV_ENUM(NVCV_DATA_TYPE_4F64),
+    NVCV_ENUM(NVCV_DATA_TYPE_C64),
+    NVCV_ENUM(NVCV_DATA_TYPE_2C64),
+    NVCV_ENUM(NVCV_DATA_TYPE_3C64),
+    NVCV_ENUM(NVCV_DATA_TYPE_4C64),
+    NVCV_ENUM(NVCV_DATA_TYPE_C128),
+    NVCV_ENUM(NVCV_DATA_TYPE_2C128),
+#undef NVCV_ENUM
+};
+
+constexpr auto g_DataTypeToName = MakeLookupTable(g_DataTypeNames, &DataTypeName::type, &DataTypeName::name);
+
+} // namespace
+
+const char *GetPredefinedName(DataType type) noexcept
+{
+    const char *const *name = g_DataTypeToName.find(type.value());
+    return name ? *name : nullptr;
+}
+
 std::ostream &operator<<(std::ostream &out, DataType type)
 {
-    switch (type.value())
+    if (const char *name = GetPredefinedName(type))
     {
-#define NVCV_ENUM(E) \
-    case E:          \
-        return out << #E;
-        NVCV_ENUM(NVCV_DATA_TYPE_NONE);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_U8);
-        NVCV_ENUM(NVCV_DATA_TYPE_2U8);
-        NVCV_ENUM(NVCV_DATA_TYPE_3U8);
-        NVCV_ENUM(NVCV_DATA_TYPE_4U8);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_S8);
-        NVCV_ENUM(NVCV_DATA_TYPE_2S8);
-        NVCV_ENUM(NVCV_DATA_TYPE_3S8);
-        NVCV_ENUM(NVCV_DATA_TYPE_4S8);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_U16);
-        NVCV_ENUM(NVCV_DATA_TYPE_2U16);
-        NVCV_ENUM(NVCV_DATA_TYPE_3U16);
-        NVCV_ENUM(NVCV_DATA_TYPE_4U16);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_S16);
-        NVCV_ENUM(NVCV_DATA_TYPE_2S16);
-        NVCV_ENUM(NVCV_DATA_TYPE_3S16);
-        NVCV_ENUM(NVCV_DATA_TYPE_4S16);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_U32);
-        NVCV_ENUM(NVCV_DATA_TYPE_2U32);
-        NVCV_ENUM(NVCV_DATA_TYPE_3U32);
-        NVCV_ENUM(NVCV_DATA_TYPE_4U32);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_S32);
-        NVCV_ENUM(NVCV_DATA_TYPE_2S32);
-        NVCV_ENUM(NVCV_DATA_TYPE_3S32);
-        NVCV_ENUM(NVCV_DATA_TYPE_4S32);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_F16);
-        NVCV_ENUM(NVCV_DATA_TYPE_2F16);
-        NVCV_ENUM(NVCV_DATA_TYPE_3F16);
-        NVCV_ENUM(NVCV_DATA_TYPE_4F16);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_F32);
-        NVCV_ENUM(NVCV_DATA_TYPE_2F32);
-        NVCV_ENUM(NVCV_DATA_TYPE_3F32);
-        NVCV_ENUM(NVCV_DATA_TYPE_4F32);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_U64);
-        NVCV_ENUM(NVCV_DATA_TYPE_2U64);
-        NVCV_ENUM(NVCV_DATA_TYPE_3U64);
-        NVCV_ENUM(NVCV_DATA_TYPE_4U64);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_S64);
-        NVCV_ENUM(NVCV_DATA_TYPE_2S64);
-        NVCV_ENUM(NVCV_DATA_TYPE_3S64);
-        NVCV_ENUM(NVCV_DATA_TYPE_4S64);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_F64);
-        NVCV_ENUM(NVCV_DATA_TYPE_2F64);
-        NVCV_ENUM(NVCV_DATA_TYPE_3F64);
-        NVCV_ENUM(NVCV_DATA_TYPE_4F64);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_C64);
-        NVCV_ENUM(NVCV_DATA_TYPE_2C64);
-        NVCV_ENUM(NVCV_DATA_TYPE_3C64);
-        NVCV_ENUM(NVCV_DATA_TYPE_4C64);
-
-        NVCV_ENUM(NVCV_DATA_TYPE_C128);
-        NVCV_ENUM(NVCV_DATA_TYPE_2C128);
-#undef NVCV_ENUM
+        return out << name;
     }
 
     return out << "NVCVDataType(" << type.dataKind() << "," << type.packing() << ")";
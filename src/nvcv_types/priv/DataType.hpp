@@ -76,6 +76,9 @@ private:
     NVCVDataType m_type;
 };
 
+// Returns the name of a predefined data type, or NULL if it isn't one.
+const char *GetPredefinedName(DataType type) noexcept;
+
 std::ostream &operator<<(std::ostream &out, DataType type);
 
 } // namespace nvcv::priv
@@ -26,16 +26,50 @@
 
 namespace nvcv::priv {
 
+void DefaultAllocator::setHostMemPoolLimit(int64_t maxCachedBytes)
+{
+    if (maxCachedBytes >= 0)
+    {
+        m_hostMemPool.setMaxCachedBytes(maxCachedBytes);
+        m_useHostMemPool = true;
+    }
+    else
+    {
+        m_useHostMemPool = false;
+        m_hostMemPool.flushThreadCache();
+        m_hostMemPool.trim();
+    }
+}
+
+HostMemPool &DefaultAllocator::hostMemPool()
+{
+    return m_hostMemPool;
+}
+
 void *DefaultAllocator::doAllocHostMem(int64_t size, int32_t align)
 {
-    return std::aligned_alloc(align, size);
+    if (m_useHostMemPool.load(std::memory_order_relaxed))
+    {
+        return m_hostMemPool.alloc(size, align);
+    }
+    else
+    {
+        return std::aligned_alloc(align, size);
+    }
 }
 
 void DefaultAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept
 {
-    (void)size;
-    (void)align;
-    std::free(ptr);
+    // Pooled blocks are allocated with std::aligned_alloc, they can be
+    // released with std::free after pooling is disabled.
+    if (m_useHostMemPool.load(std::memory_order_relaxed))
+    {
+        m_hostMemPool.free(ptr, size, align);
+    }
+    else
+    {
+        std::free(ptr);
+    }
 }
 
 void *DefaultAllocator::doAllocHostPinnedMem(int64_t size, int32_t align)
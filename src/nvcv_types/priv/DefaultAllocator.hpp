@@ -18,13 +18,26 @@
 #ifndef NVCV_CORE_PRIV_DEFAULT_ALLOCATOR_HPP
 #define NVCV_CORE_PRIV_DEFAULT_ALLOCATOR_HPP
 
+#include "HostMemPool.hpp"
 #include "IAllocator.hpp"
 
+#include <atomic>
+
 namespace nvcv::priv {
 
 class DefaultAllocator final : public CoreObjectBase<IAllocator>
 {
+public:
+    // Serves host memory from a size-class pool that caches up to maxCachedBytes.
+    // If negative, host memory is served directly by the system allocator.
+    void setHostMemPoolLimit(int64_t maxCachedBytes);
+
+    HostMemPool &hostMemPool();
+
 private:
+    HostMemPool       m_hostMemPool;
+    std::atomic<bool> m_useHostMemPool = false;
+
     void *doAllocHostMem(int64_t size, int32_t align) override;
     void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept override;
 
@@ -0,0 +1,183 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DirtyRangeSet.hpp"
+
+#include "Exception.hpp"
+
+#include <util/Assert.h>
+
+#include <algorithm>
+
+namespace nvcv::priv {
+
+namespace {
+
+constexpr int kWordBits = 64;
+
+// Mask with bits [begin, end) of a word set, 0 <= begin < end <= 64
+uint64_t WordMask(int begin, int end)
+{
+    uint64_t hi = end == kWordBits ? ~uint64_t(0) : (uint64_t(1) << end) - 1;
+    return hi & (~uint64_t(0) << begin);
+}
+
+// Sets or clears bits [begin, end)
+void AssignBits(uint64_t *bits, int32_t begin, int32_t end, bool value)
+{
+    while (begin < end)
+    {
+        int32_t  w    = begin / kWordBits;
+        int32_t  wEnd = std::min(end, (w + 1) * kWordBits);
+        uint64_t mask = WordMask(begin % kWordBits, wEnd - w * kWordBits);
+        bits[w]       = value ? bits[w] | mask : bits[w] & ~mask;
+        begin         = wEnd;
+    }
+}
+
+} // namespace
+
+DirtyRangeSet::DirtyRangeSet(int32_t capacity, int32_t maxGap)
+    : m_bits((capacity + kWordBits - 1) / kWordBits, 0)
+    , m_capacity(capacity)
+{
+    NVCV_ASSERT(capacity >= 0);
+    this->setMaxGap(maxGap);
+}
+
+int32_t DirtyRangeSet::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+int32_t DirtyRangeSet::maxGap() const noexcept
+{
+    return m_maxGap;
+}
+
+void DirtyRangeSet::setMaxGap(int32_t maxGap)
+{
+    if (maxGap < 0)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Maximum gap between merged ranges must be >= 0, not %d", maxGap);
+    }
+    m_maxGap = maxGap;
+}
+
+void DirtyRangeSet::mark(int32_t begin, int32_t end)
+{
+    NVCV_ASSERT(0 <= begin && end <= m_capacity);
+
+    if (begin >= end)
+    {
+        return;
+    }
+
+    AssignBits(m_bits.data(), begin, end, true);
+
+    if (m_begin == m_end)
+    {
+        m_begin = begin;
+        m_end   = end;
+    }
+    else
+    {
+        m_begin = std::min(m_begin, begin);
+        m_end   = std::max(m_end, end);
+    }
+}
+
+void DirtyRangeSet::truncate(int32_t size) noexcept
+{
+    NVCV_ASSERT(0 <= size && size <= m_capacity);
+
+    if (size >= m_end)
+    {
+        return;
+    }
+
+    AssignBits(m_bits.data(), std::max(size, m_begin), m_end, false);
+
+    if (size <= m_begin)
+    {
+        m_begin = m_end = 0;
+    }
+    else
+    {
+        m_end = size;
+    }
+}
+
+void DirtyRangeSet::clear() noexcept
+{
+    if (m_begin != m_end)
+    {
+        std::fill(m_bits.begin() + m_begin / kWordBits, m_bits.begin() + (m_end + kWordBits - 1) / kWordBits, 0);
+        m_begin = m_end = 0;
+    }
+}
+
+bool DirtyRangeSet::empty() const noexcept
+{
+    return m_begin == m_end;
+}
+
+auto DirtyRangeSet::bounds() const noexcept -> Range
+{
+    return {m_begin, m_end};
+}
+
+bool DirtyRangeSet::doFindRun(int32_t from, Range &run) const noexcept
+{
+    if (from >= m_end)
+    {
+        return false;
+    }
+
+    // Find the first set bit
+    int32_t  w    = from / kWordBits;
+    uint64_t word = m_bits[w] & (~uint64_t(0) << (from % kWordBits));
+    while (word == 0)
+    {
+        if (++w * kWordBits >= m_end)
+        {
+            return false;
+        }
+        word = m_bits[w];
+    }
+    run.begin = w * kWordBits + __builtin_ctzll(word);
+
+    // Find the first clear bit after it
+    word = ~m_bits[w] & (~uint64_t(0) << (run.begin % kWordBits));
+    while (word == 0 && (w + 1) * kWordBits < m_end)
+    {
+        word = ~m_bits[++w];
+    }
+    run.end = word == 0 ? m_end : std::min(m_end, w * kWordBits + __builtin_ctzll(word));
+
+    NVCV_ASSERT(run.begin < run.end);
+    return true;
+}
+
+std::vector<DirtyRangeSet::Range> DirtyRangeSet::ranges() const
+{
+    std::vector<Range> out;
+    this->forEachRange([&out](int32_t begin, int32_t end) { out.push_back({begin, end}); });
+    return out;
+}
+
+} // namespace nvcv::priv
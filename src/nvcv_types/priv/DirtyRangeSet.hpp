@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_DIRTY_RANGE_SET_HPP
+#define NVCV_CORE_PRIV_DIRTY_RANGE_SET_HPP
+
+#include <cstdint>
+#include <vector>
+
+namespace nvcv::priv {
+
+/** Tracks which elements of a host buffer were modified and must be copied to its device mirror.
+ *
+ * Modified elements are kept in a bitmap, along with a range that contains them all,
+ * so that clean sets are detected in O(1) and only the modified region is scanned.
+ *
+ * The modified elements are reported as coalesced ranges. Two ranges separated by at most
+ * maxGap clean elements are merged, as copying a few clean elements is cheaper than issuing
+ * another copy.
+ */
+class DirtyRangeSet
+{
+public:
+    struct Range
+    {
+        int32_t begin, end;
+    };
+
+    explicit DirtyRangeSet(int32_t capacity, int32_t maxGap = 0);
+
+    int32_t capacity() const noexcept;
+
+    int32_t maxGap() const noexcept;
+    void    setMaxGap(int32_t maxGap);
+
+    // Marks [begin, end) as modified, nothing is done if the range is empty.
+    void mark(int32_t begin, int32_t end);
+
+    // Forgets about modified elements from index size onwards, e.g. when they are removed.
+    void truncate(int32_t size) noexcept;
+
+    void clear() noexcept;
+
+    bool empty() const noexcept;
+
+    // Range that contains all modified elements, not necessarily the smallest one.
+    Range bounds() const noexcept;
+
+    // Calls fn(begin, end) for each coalesced range of modified elements, in increasing order.
+    template<class F>
+    void forEachRange(F &&fn) const;
+
+    // Returns the coalesced ranges, mostly useful for testing.
+    std::vector<Range> ranges() const;
+
+private:
+    std::vector<uint64_t> m_bits;
+    int32_t               m_capacity;
+    int32_t               m_maxGap;
+
+    // Bounds of the modified elements, m_begin == m_end if empty.
+    // Invariant: no bits are set outside of [m_begin, m_end).
+    int32_t m_begin = 0;
+    int32_t m_end   = 0;
+
+    // Finds the first range of contiguous modified elements starting at or after 'from'.
+    // Returns false if there's none.
+    bool doFindRun(int32_t from, Range &run) const noexcept;
+};
+
+template<class F>
+void DirtyRangeSet::forEachRange(F &&fn) const
+{
+    Range cur, run;
+    if (!doFindRun(m_begin, cur))
+    {
+        return;
+    }
+
+    while (doFindRun(cur.end, run))
+    {
+        if (run.begin - cur.end <= m_maxGap)
+        {
+            cur.end = run.end;
+        }
+        else
+        {
+            fn(cur.begin, cur.end);
+            cur = run;
+        }
+    }
+
+    fn(cur.begin, cur.end);
+}
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_DIRTY_RANGE_SET_HPP
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -56,6 +57,14 @@ using GetHandleType = typename detail::GetHandleType<T>::type;
 // R=resource address, G=generation
 static constexpr int kResourceAlignment = 16; // Must be a power of two.
 
+struct HandleManagerStats
+{
+    int64_t liveCount;   // Number of handles in use.
+    int64_t peakCount;   // Maximum number of handles in use at the same time.
+    int64_t capacity;    // Number of handles in the pools.
+    int64_t poolGrowths; // Number of pools allocated.
+};
+
 /** A type trait that defines storage for objects implementing given interface
  *
  * This struct must define a ::type that is sufficiently large and aligned to contain
@@ -158,6 +167,56 @@ public:
         }
     }
 
+    /** Creates several objects, fetching all the resources they need at once.
+     *
+     * Either all objects are created or none is. If a constructor throws, the objects
+     * already created are destroyed and the exception is propagated.
+     *
+     * @param count     Number of objects to create.
+     * @param handles   Receives the handles of the created objects.
+     * @param getArgs   Called as getArgs(i), returns a std::tuple with the arguments of
+     *                  the i-th object's constructor.
+     * @param onCreated Called as onCreated(handle, obj) after each object is constructed.
+     *                  Must not throw.
+     */
+    template<class T, class GetArgs, class OnCreated>
+    void createMany(int32_t count, HandleType *handles, GetArgs &&getArgs, OnCreated &&onCreated)
+    {
+        if (count <= 0)
+        {
+            return;
+        }
+
+        ResourceBase *first = doFetchFreeResources(count);
+        ResourceBase *res   = first;
+        try
+        {
+            for (int32_t i = 0; i < count; ++i)
+            {
+                T *obj = std::apply([res](auto &&...args)
+                                    { return res->template constructObject<T>(std::forward<decltype(args)>(args)...); },
+                                    getArgs(i));
+                handles[i] = doGetHandleFromResource(res); // noexcept
+                onCreated(handles[i], obj);
+
+                res = res->next;
+            }
+        }
+        catch (...)
+        {
+            // Destroy what was created so far and return all the fetched resources.
+            ResourceBase *last = nullptr;
+            for (ResourceBase *r = first; r; r = r->next)
+            {
+                r->destroyObject();
+                r->decRef();
+                last = r;
+            }
+            doReturnResources(first, last, count);
+            throw;
+        }
+    }
+
     /** Decrements the reference count of the object pointed to by the handle and destroys
      *  it if no longer referenced
      *
@@ -165,6 +224,15 @@ public:
      */
     int decRef(HandleType handle);
 
+    /** Decrements the reference count of several objects, destroying the ones no longer referenced.
+     *
+     * Handles are processed in order. Null handles are ignored. If an invalid handle is found,
+     * an exception is thrown, and the handles that come after it are left untouched.
+     *
+     * @param newRefCounts If not NULL, receives the remaining reference count of each object.
+     */
+    void decRefMany(int32_t count, const HandleType *handles, int *newRefCounts);
+
     /** Increments the reference count of the object pointed to by the handle.
      *
      * @return The new reference count.
@@ -182,6 +250,8 @@ public:
 
     void clear();
 
+    HandleManagerStats stats() const noexcept;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -193,6 +263,11 @@ private:
 
     ResourceBase *doFetchFreeResource();
     void          doReturnResource(ResourceBase *r);
+
+    // Fetches a list of count resources, linked through ResourceBase::next.
+    ResourceBase *doFetchFreeResources(int32_t count);
+    // Returns a list of count resources, from first to last.
+    void          doReturnResources(ResourceBase *first, ResourceBase *last, int32_t count);
     uint8_t       doGetHandleGeneration(HandleType handle) const noexcept;
     HandleType    doGetHandleFromResource(ResourceBase *r) const noexcept;
     ResourceBase *doGetResourceFromHandle(HandleType handle) const noexcept;
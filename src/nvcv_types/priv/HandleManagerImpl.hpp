@@ -20,7 +20,9 @@
 
 #include "Exception.hpp"
 #include "LockFreeStack.hpp"
+#include "PeakCounter.hpp"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
@@ -153,6 +155,9 @@ struct HandleManager<Interface>::Impl
 
         // Add them to the list of free resources.
         freeResources.pushStack(data, data + count - 1);
+
+        totalCapacity.fetch_add(count, std::memory_order_relaxed);
+        poolGrowths.fetch_add(1, std::memory_order_relaxed);
     }
 
     // Store the resources' buffer.
@@ -165,10 +170,153 @@ struct HandleManager<Interface>::Impl
 
     static_assert(std::atomic<ResourceBase *>::is_always_lock_free);
 
-    bool            hasFixedSize  = false;
-    int             totalCapacity = 0;
-    std::atomic_int usedCount     = 0;
-    const char     *name;
+    // Under the dynamic size policy, each thread keeps a small magazine of free
+    // resources, so that most create/destroy calls don't touch the shared
+    // freeResources stack. Resources move between the magazine and the stack
+    // in batches of kThreadCacheSize/2.
+    static constexpr int kThreadCacheSize = 32;
+
+    // Shared between the manager and the thread caches that refer to it,
+    // it allows thread caches to outlive the manager.
+    struct ThreadCacheKey
+    {
+        // Set to null when the manager is destroyed.
+        std::atomic<Impl *> impl;
+        // Incremented whenever the resources are released, invalidating
+        // the resources held by thread caches.
+        std::atomic_int epoch = 0;
+    };
+
+    class ThreadCache
+    {
+    public:
+        struct Slot
+        {
+            std::shared_ptr<ThreadCacheKey> key;
+
+            int           epoch = 0;
+            ResourceBase *head  = nullptr;
+            int           count = 0;
+
+            ResourceBase *pop() noexcept
+            {
+                ResourceBase *r = head;
+                if (r)
+                {
+                    head = r->next;
+                    --count;
+                }
+                return r;
+            }
+
+            void push(ResourceBase *r) noexcept
+            {
+                r->next = head;
+                head    = r;
+                ++count;
+            }
+
+            // Detaches the first n resources, returning the last one detached.
+            ResourceBase *detach(int n) noexcept
+            {
+                NVCV_ASSERT(0 < n && n <= count);
+
+                ResourceBase *last = head;
+                for (int i = 1; i < n; ++i)
+                {
+                    last = last->next;
+                }
+                head       = last->next;
+                last->next = nullptr;
+                count -= n;
+                return last;
+            }
+
+            void flush() noexcept
+            {
+                if (head)
+                {
+                    Impl *impl = key->impl.load(std::memory_order_acquire);
+                    if (impl && epoch == key->epoch.load(std::memory_order_acquire))
+                    {
+                        ResourceBase *first = head;
+                        ResourceBase *last  = detach(count);
+                        impl->freeResources.pushStack(first, last);
+                    }
+                }
+                head  = nullptr;
+                count = 0;
+                key.reset();
+            }
+        };
+
+        ~ThreadCache()
+        {
+            for (Slot &s : m_slots)
+            {
+                s.flush();
+            }
+        }
+
+        Slot &get(const std::shared_ptr<ThreadCacheKey> &key) noexcept
+        {
+            Slot *slot = nullptr;
+            for (Slot &s : m_slots)
+            {
+                if (s.key == key)
+                {
+                    slot = &s;
+                    break;
+                }
+            }
+
+            if (slot == nullptr)
+            {
+                slot = &m_slots[kMaxSlots - 1];
+                for (Slot &s : m_slots)
+                {
+                    // Unused slot, or one whose manager was already destroyed.
+                    if (!s.key || s.key.use_count() == 1)
+                    {
+                        slot = &s;
+                        break;
+                    }
+                }
+                slot->flush();
+                slot->key   = key;
+                slot->epoch = key->epoch.load(std::memory_order_acquire);
+            }
+            else if (int epoch = key->epoch.load(std::memory_order_acquire); slot->epoch != epoch)
+            {
+                // Resources were released, drop the dangling references.
+                slot->head  = nullptr;
+                slot->count = 0;
+                slot->epoch = epoch;
+            }
+
+            return *slot;
+        }
+
+    private:
+        // Maximum number of managers of the same type a thread can cache resources for.
+        static constexpr int kMaxSlots = 4;
+
+        Slot m_slots[kMaxSlots];
+    };
+
+    std::shared_ptr<ThreadCacheKey> cacheKey = std::make_shared<ThreadCacheKey>();
+
+    typename ThreadCache::Slot &threadCache() noexcept
+    {
+        thread_local ThreadCache cache;
+        return cache.get(cacheKey);
+    }
+
+    bool                 hasFixedSize  = false;
+    std::atomic_int      totalCapacity = 0;
+    std::atomic<int64_t> poolGrowths   = 0;
+    PeakCounter          usedCount;
+    const char          *name;
 };
 
 template<typename Interface>
@@ -176,11 +324,13 @@ HandleManager<Interface>::HandleManager(const char *name)
     : pimpl(std::make_unique<Impl>())
 {
     pimpl->name = name;
+    pimpl->cacheKey->impl.store(pimpl.get(), std::memory_order_release);
 }
 
 template<typename Interface>
 HandleManager<Interface>::~HandleManager()
 {
+    pimpl->cacheKey->impl.store(nullptr, std::memory_order_release);
     this->clear();
 }
 
@@ -206,6 +356,58 @@ int HandleManager<Interface>::decRef(HandleType handle)
     }
 }
 
+template<typename Interface>
+void HandleManager<Interface>::decRefMany(int32_t count, const HandleType *handles, int *newRefCounts)
+{
+    // Destroyed objects' resources are returned all at once at the end
+    ResourceBase *freed    = nullptr;
+    ResourceBase *last     = nullptr;
+    int32_t       numFreed = 0;
+
+    auto returnFreed = [&]
+    {
+        if (freed)
+        {
+            doReturnResources(freed, last, numFreed);
+        }
+    };
+
+    for (int32_t i = 0; i < count; ++i)
+    {
+        int ref = 0;
+        if (handles[i])
+        {
+            ResourceBase *res = this->getValidResource(handles[i]);
+            if (!res)
+            {
+                returnFreed();
+                throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Handle #%d is invalid.", i);
+            }
+
+            ref = res->decRef();
+            if (ref == 0)
+            {
+                res->destroyObject();
+
+                res->next = freed;
+                freed     = res;
+                if (last == nullptr)
+                {
+                    last = res;
+                }
+                ++numFreed;
+            }
+        }
+
+        if (newRefCounts)
+        {
+            newRefCounts[i] = ref;
+        }
+    }
+
+    returnFreed();
+}
+
 template<typename Interface>
 int HandleManager<Interface>::incRef(HandleType handle)
 {
@@ -284,14 +486,14 @@ template<typename Interface>
 void HandleManager<Interface>::setFixedSize(int32_t maxSize)
 {
     std::lock_guard lock(pimpl->mtxAlloc);
-    if (pimpl->usedCount > 0)
+    if (pimpl->usedCount.value() > 0)
     {
         throw Exception(NVCV_ERROR_INVALID_OPERATION,
-                        "Cannot change the size policy while there are still %d live %s handles", (int)pimpl->usedCount,
-                        pimpl->name);
+                        "Cannot change the size policy while there are still %d live %s handles",
+                        (int)pimpl->usedCount.value(), pimpl->name);
     }
 
-    if (pimpl->totalCapacity >= maxSize)
+    if (pimpl->hasFixedSize && pimpl->totalCapacity == maxSize)
     {
         return;
     }
@@ -299,7 +501,10 @@ void HandleManager<Interface>::setFixedSize(int32_t maxSize)
     this->clear();
 
     pimpl->hasFixedSize = true;
-    doAllocate(maxSize - pimpl->totalCapacity);
+    if (maxSize > 0)
+    {
+        doAllocate(maxSize);
+    }
 }
 
 template<typename Interface>
@@ -310,14 +515,15 @@ void HandleManager<Interface>::setDynamicSize(int32_t minSize)
     pimpl->hasFixedSize = false;
     if (pimpl->totalCapacity < minSize)
     {
-        doAllocate(minSize);
+        doAllocate(minSize - pimpl->totalCapacity);
     }
 }
 
 template<typename Interface>
 void HandleManager<Interface>::clear()
 {
-    if (pimpl->usedCount > 0)
+    int64_t usedCount = pimpl->usedCount.value();
+    if (usedCount > 0)
     {
         const char *leakDetection = getenv(LEAK_DETECTION_ENVVAR);
 #ifndef NDEBUG
@@ -348,8 +554,8 @@ void HandleManager<Interface>::clear()
                 abort();
             }
 
-            std::cerr << pimpl->name << " leak detection: " << pimpl->usedCount << " handle"
-                      << (pimpl->usedCount > 1 ? "s" : "") << " still in use" << std::endl;
+            std::cerr << pimpl->name << " leak detection: " << usedCount << " handle" << (usedCount > 1 ? "s" : "")
+                      << " still in use" << std::endl;
             if (doAbort)
             {
                 abort();
@@ -357,8 +563,23 @@ void HandleManager<Interface>::clear()
         }
     }
 
+    // Invalidate the resources cached by all threads.
+    pimpl->cacheKey->epoch.fetch_add(1, std::memory_order_acq_rel);
+
     pimpl->freeResources.clear();
     pimpl->resourceStack.clear();
+    pimpl->totalCapacity = 0;
+}
+
+template<typename Interface>
+HandleManagerStats HandleManager<Interface>::stats() const noexcept
+{
+    HandleManagerStats stats;
+    stats.liveCount   = pimpl->usedCount.value();
+    stats.peakCount   = pimpl->usedCount.peak();
+    stats.capacity    = pimpl->totalCapacity.load(std::memory_order_relaxed);
+    stats.poolGrowths = pimpl->poolGrowths.load(std::memory_order_relaxed);
+    return stats;
 }
 
 template<typename Interface>
@@ -380,7 +601,8 @@ void HandleManager<Interface>::doGrow()
     std::lock_guard lock(pimpl->mtxAlloc);
     if (!pimpl->freeResources.top())
     {
-        doAllocate(pimpl->totalCapacity ? pimpl->totalCapacity : pimpl->kMinHandles);
+        // Double the capacity
+        doAllocate(std::max<int>(pimpl->totalCapacity, Impl::kMinHandles));
     }
 }
 
@@ -389,9 +611,26 @@ auto HandleManager<Interface>::doFetchFreeResource() -> ResourceBase *
 {
     for (;;)
     {
-        if (auto *r = pimpl->freeResources.pop())
+        ResourceBase *r;
+        if (pimpl->hasFixedSize)
+        {
+            // Resources can't be held by thread caches, or other threads
+            // might run out of them even though the pool isn't exhausted.
+            r = pimpl->freeResources.pop();
+        }
+        else
         {
-            pimpl->usedCount++;
+            auto &cache = pimpl->threadCache();
+            if (cache.count == 0)
+            {
+                cache.head = pimpl->freeResources.popList(Impl::kThreadCacheSize / 2, cache.count);
+            }
+            r = cache.pop();
+        }
+
+        if (r)
+        {
+            pimpl->usedCount.add(1);
             r->incRef();
             assert(r->refCount() == 1);
             return r;
@@ -406,8 +645,112 @@ auto HandleManager<Interface>::doFetchFreeResource() -> ResourceBase *
 template<typename Interface>
 void HandleManager<Interface>::doReturnResource(ResourceBase *r)
 {
-    pimpl->freeResources.push(r);
-    pimpl->usedCount--;
+    if (pimpl->hasFixedSize)
+    {
+        pimpl->freeResources.push(r);
+    }
+    else
+    {
+        auto &cache = pimpl->threadCache();
+        if (cache.count == Impl::kThreadCacheSize)
+        {
+            // Spill half of the magazine to the shared stack
+            ResourceBase *first = cache.head;
+            ResourceBase *last  = cache.detach(Impl::kThreadCacheSize / 2);
+            pimpl->freeResources.pushStack(first, last);
+        }
+        cache.push(r);
+    }
+    pimpl->usedCount.sub(1);
+}
+
+template<typename Interface>
+auto HandleManager<Interface>::doFetchFreeResources(int32_t count) -> ResourceBase *
+{
+    NVCV_ASSERT(count > 0);
+
+    ResourceBase *first   = nullptr;
+    ResourceBase *last    = nullptr;
+    int32_t       fetched = 0;
+
+    // Under the dynamic size policy, start with what's in the thread cache.
+    if (!pimpl->hasFixedSize)
+    {
+        auto &cache = pimpl->threadCache();
+        if (int n = std::min(count, cache.count); n > 0)
+        {
+            first   = cache.head;
+            last    = cache.detach(n);
+            fetched = n;
+        }
+    }
+
+    while (fetched < count)
+    {
+        int           n;
+        ResourceBase *list = pimpl->freeResources.popList(count - fetched, n);
+        if (list == nullptr)
+        {
+            try
+            {
+                doGrow();
+            }
+            catch (...)
+            {
+                if (first)
+                {
+                    pimpl->freeResources.pushStack(first, last);
+                }
+                throw;
+            }
+            continue;
+        }
+
+        // Prepend the popped list to what we already have
+        ResourceBase *listLast = list;
+        while (listLast->next)
+        {
+            listLast = listLast->next;
+        }
+        listLast->next = first;
+        if (first == nullptr)
+        {
+            last = listLast;
+        }
+        first = list;
+        fetched += n;
+    }
+
+    for (ResourceBase *r = first; r; r = r->next)
+    {
+        r->incRef();
+        assert(r->refCount() == 1);
+    }
+    pimpl->usedCount.add(count);
+
+    return first;
+}
+
+template<typename Interface>
+void HandleManager<Interface>::doReturnResources(ResourceBase *first, ResourceBase *last, int32_t count)
+{
+    if (!pimpl->hasFixedSize)
+    {
+        // Fill up the thread cache first, the rest goes to the shared stack
+        auto &cache = pimpl->threadCache();
+        while (first && cache.count < Impl::kThreadCacheSize)
+        {
+            ResourceBase *next = first->next;
+            cache.push(first);
+            first = next;
+        }
+    }
+
+    if (first)
+    {
+        pimpl->freeResources.pushStack(first, last);
+    }
+    pimpl->usedCount.sub(count);
 }
 
 template<typename Interface>
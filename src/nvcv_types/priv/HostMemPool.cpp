@@ -0,0 +1,415 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostMemPool.hpp"
+
+#include <malloc.h> // for malloc_usable_size
+#include <util/Math.hpp>
+
+#include <algorithm>
+#include <cstdlib> // for aligned_alloc
+#include <mutex>
+#include <utility>
+
+namespace nvcv::priv {
+
+namespace {
+
+// Free blocks are linked through their first bytes. The smallest size class
+// is large enough to hold all the fields.
+struct Block
+{
+    Block *next;
+    // Only valid on the first block of a magazine stored in the depot
+    Block *nextMagazine;
+    int    count;
+};
+
+static_assert(sizeof(Block) <= (1 << HostMemPool::kMinClassLog2));
+
+struct Magazine
+{
+    Block *head  = nullptr;
+    int    count = 0;
+
+    void push(void *ptr) noexcept
+    {
+        auto *b = static_cast<Block *>(ptr);
+        b->next = head;
+        head    = b;
+        ++count;
+    }
+
+    void *pop() noexcept
+    {
+        Block *b = head;
+        head     = b->next;
+        --count;
+        return b;
+    }
+
+    void release() noexcept
+    {
+        while (head)
+        {
+            std::free(pop());
+        }
+    }
+};
+
+constexpr int64_t kMagazineBytes = 256 << 10;
+
+int64_t ClassSize(int sizeClass)
+{
+    return int64_t(1) << (sizeClass + HostMemPool::kMinClassLog2);
+}
+
+int32_t ClassAlignment(int sizeClass)
+{
+    return std::min<int64_t>(ClassSize(sizeClass), HostMemPool::kMaxAlignment);
+}
+
+// Lifetime of the calling thread's cache. It's trivially destructible, so it can
+// still be read by destructors that run after the cache was destroyed, e.g. the
+// global pools' during static destruction.
+enum class ThreadCacheState : uint8_t
+{
+    NONE,
+    ALIVE,
+    DESTROYED
+};
+
+thread_local ThreadCacheState g_threadCacheState = ThreadCacheState::NONE;
+
+} // namespace
+
+struct HostMemPool::Depot
+{
+    struct Bin
+    {
+        std::mutex mtx;
+        // Full magazines, linked through Block::nextMagazine
+        Block *magazines = nullptr;
+    };
+
+    Bin bins[kNumClasses];
+
+    std::atomic<int64_t> maxCachedBytes;
+    std::atomic<int64_t> cachedBytes = 0;
+
+    explicit Depot(int64_t maxBytes)
+        : maxCachedBytes(maxBytes)
+    {
+    }
+
+    ~Depot()
+    {
+        releaseAll();
+    }
+
+    // Takes ownership of the magazine, or releases its blocks if
+    // the depot would exceed its capacity.
+    void push(int sizeClass, Magazine &mag) noexcept
+    {
+        if (mag.count == 0)
+        {
+            return;
+        }
+
+        int64_t bytes    = mag.count * ClassSize(sizeClass);
+        int64_t maxBytes = maxCachedBytes.load(std::memory_order_relaxed);
+
+        if (maxBytes >= 0 && cachedBytes.load(std::memory_order_relaxed) + bytes > maxBytes)
+        {
+            mag.release();
+            return;
+        }
+
+        cachedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+        mag.head->count = mag.count;
+
+        Bin            &bin = bins[sizeClass];
+        std::lock_guard lk(bin.mtx);
+        mag.head->nextMagazine = bin.magazines;
+        bin.magazines          = mag.head;
+
+        mag = {};
+    }
+
+    bool pop(int sizeClass, Magazine &mag) noexcept
+    {
+        Block *head;
+        {
+            Bin            &bin = bins[sizeClass];
+            std::lock_guard lk(bin.mtx);
+            head = bin.magazines;
+            if (head == nullptr)
+            {
+                return false;
+            }
+            bin.magazines = head->nextMagazine;
+        }
+
+        mag.head  = head;
+        mag.count = head->count;
+
+        cachedBytes.fetch_sub(mag.count * ClassSize(sizeClass), std::memory_order_relaxed);
+        return true;
+    }
+
+    void releaseAll() noexcept
+    {
+        for (int c = 0; c < kNumClasses; ++c)
+        {
+            Magazine mag;
+            while (pop(c, mag))
+            {
+                mag.release();
+            }
+        }
+    }
+};
+
+struct HostMemPool::ThreadCache
+{
+    // Maximum number of pools a thread can cache blocks for at the same time.
+    static constexpr int kMaxPools = 4;
+
+    // Two magazines per size class, as in Bonwick's magazine allocator. Having a spare one
+    // avoids exchanging magazines with the depot when alloc/free oscillate at a boundary.
+    struct Slot
+    {
+        std::shared_ptr<Depot> depot;
+        Magazine               loaded[kNumClasses];
+        Magazine               previous[kNumClasses];
+
+        void flush() noexcept
+        {
+            if (depot)
+            {
+                for (int c = 0; c < kNumClasses; ++c)
+                {
+                    depot->push(c, loaded[c]);
+                    depot->push(c, previous[c]);
+                }
+                depot.reset();
+            }
+        }
+    };
+
+    Slot slots[kMaxPools];
+
+    ThreadCache() noexcept
+    {
+        g_threadCacheState = ThreadCacheState::ALIVE;
+    }
+
+    ~ThreadCache()
+    {
+        for (Slot &s : slots)
+        {
+            s.flush();
+        }
+        g_threadCacheState = ThreadCacheState::DESTROYED;
+    }
+
+    Slot *find(const Depot *depot) noexcept
+    {
+        for (Slot &s : slots)
+        {
+            if (s.depot.get() == depot)
+            {
+                return &s;
+            }
+        }
+        return nullptr;
+    }
+
+    Slot &get(const std::shared_ptr<Depot> &depot) noexcept
+    {
+        if (Slot *s = this->find(depot.get()))
+        {
+            return *s;
+        }
+
+        Slot *victim = &slots[kMaxPools - 1];
+        for (Slot &s : slots)
+        {
+            // Unused slot, or one whose pool was already destroyed
+            if (!s.depot || s.depot.use_count() == 1)
+            {
+                victim = &s;
+                break;
+            }
+        }
+
+        victim->flush();
+        victim->depot = depot;
+        return *victim;
+    }
+};
+
+HostMemPool::HostMemPool(int64_t maxCachedBytes)
+    : m_depot(std::make_shared<Depot>(maxCachedBytes))
+{
+}
+
+HostMemPool::~HostMemPool()
+{
+    // Blocks cached by threads (this one included, if its cache was already
+    // destroyed) went to the depot, which they keep alive until then.
+    this->flushThreadCache();
+}
+
+auto HostMemPool::threadCache() noexcept -> ThreadCache *
+{
+    if (g_threadCacheState == ThreadCacheState::DESTROYED)
+    {
+        return nullptr;
+    }
+
+    thread_local ThreadCache cache;
+    return &cache;
+}
+
+int HostMemPool::SizeClass(int64_t size, int32_t align) noexcept
+{
+    if (size > (int64_t(1) << kMaxClassLog2) || align > kMaxAlignment)
+    {
+        return -1;
+    }
+
+    int64_t bytes = std::max<int64_t>({size, align, int64_t(1) << kMinClassLog2});
+    return util::ILog2(bytes - 1) + 1 - kMinClassLog2;
+}
+
+int HostMemPool::MagazineCapacity(int sizeClass) noexcept
+{
+    return std::clamp<int64_t>(kMagazineBytes / ClassSize(sizeClass), 2, 64);
+}
+
+void *HostMemPool::alloc(int64_t size, int32_t align)
+{
+    int c = SizeClass(size, align);
+    if (c < 0)
+    {
+        return std::aligned_alloc(align, size);
+    }
+
+    ThreadCache *cache = this->threadCache();
+    if (cache == nullptr)
+    {
+        return std::aligned_alloc(ClassAlignment(c), ClassSize(c));
+    }
+
+    ThreadCache::Slot &slot   = cache->get(m_depot);
+    Magazine          &loaded = slot.loaded[c];
+
+    if (loaded.count == 0)
+    {
+        Magazine &previous = slot.previous[c];
+        if (previous.count > 0)
+        {
+            std::swap(loaded, previous);
+        }
+        else if (!m_depot->pop(c, loaded))
+        {
+            return std::aligned_alloc(ClassAlignment(c), ClassSize(c));
+        }
+    }
+
+    return loaded.pop();
+}
+
+void HostMemPool::free(void *ptr, int64_t size, int32_t align) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    int c = SizeClass(size, align);
+
+    // The block might not have been allocated by the pool, e.g. it was allocated
+    // before pooling was enabled. It can only be recycled if it can hold any
+    // request that maps to its size class.
+    if (c < 0 || malloc_usable_size(ptr) < (size_t)ClassSize(c)
+        || reinterpret_cast<uintptr_t>(ptr) % ClassAlignment(c) != 0)
+    {
+        std::free(ptr);
+        return;
+    }
+
+    ThreadCache *cache = this->threadCache();
+    if (cache == nullptr)
+    {
+        std::free(ptr);
+        return;
+    }
+
+    ThreadCache::Slot &slot   = cache->get(m_depot);
+    Magazine          &loaded = slot.loaded[c];
+
+    if (loaded.count == MagazineCapacity(c))
+    {
+        Magazine &previous = slot.previous[c];
+        if (previous.count > 0)
+        {
+            m_depot->push(c, previous);
+        }
+        std::swap(loaded, previous);
+    }
+
+    loaded.push(ptr);
+}
+
+void HostMemPool::setMaxCachedBytes(int64_t maxCachedBytes) noexcept
+{
+    m_depot->maxCachedBytes.store(maxCachedBytes, std::memory_order_relaxed);
+}
+
+int64_t HostMemPool::maxCachedBytes() const noexcept
+{
+    return m_depot->maxCachedBytes.load(std::memory_order_relaxed);
+}
+
+int64_t HostMemPool::cachedBytes() const noexcept
+{
+    return m_depot->cachedBytes.load(std::memory_order_relaxed);
+}
+
+void HostMemPool::trim() noexcept
+{
+    m_depot->releaseAll();
+}
+
+void HostMemPool::flushThreadCache() noexcept
+{
+    // Don't create the cache just to flush it
+    if (g_threadCacheState != ThreadCacheState::ALIVE)
+    {
+        return;
+    }
+
+    if (ThreadCache::Slot *slot = this->threadCache()->find(m_depot.get()))
+    {
+        slot->flush();
+    }
+}
+
+} // namespace nvcv::priv
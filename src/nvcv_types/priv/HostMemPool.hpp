@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_HOST_MEM_POOL_HPP
+#define NVCV_CORE_PRIV_HOST_MEM_POOL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace nvcv::priv {
+
+/** A size-class pooling allocator for small host buffers.
+ *
+ * Requests are rounded up to a power-of-two size class. Freed blocks are kept in
+ * per-thread magazines (intrusive lists of blocks of the same class), so that the
+ * common alloc/free churn doesn't touch any shared state. When a thread's magazines
+ * are full (or empty), a whole magazine is exchanged with a central depot, guarded
+ * by a per-class mutex.
+ *
+ * The depot can be capped to a maximum number of cached bytes. Magazines that would
+ * make the depot exceed the cap are given back to the system.
+ *
+ * The depot is shared by the pool and the thread caches that hold its magazines,
+ * and releases the blocks when the last of them goes away. The pool can thus
+ * outlive a thread's cache, as global pools do during static destruction. Past
+ * that point, that thread's requests aren't pooled anymore.
+ *
+ * Requests that are too large or too strictly aligned to be pooled are forwarded
+ * to std::aligned_alloc / std::free. All blocks, pooled or not, are allocated with
+ * std::aligned_alloc, so they can always be released with std::free.
+ */
+class HostMemPool
+{
+public:
+    // Size classes go from 2^kMinClassLog2 to 2^kMaxClassLog2 bytes.
+    static constexpr int kMinClassLog2 = 6;
+    static constexpr int kMaxClassLog2 = 18;
+    static constexpr int kNumClasses   = kMaxClassLog2 - kMinClassLog2 + 1;
+
+    // Maximum alignment of pooled blocks.
+    static constexpr int32_t kMaxAlignment = 4096;
+
+    /**
+     * @param maxCachedBytes Maximum number of bytes cached by the central depot.
+     *                       If negative, there's no limit.
+     */
+    explicit HostMemPool(int64_t maxCachedBytes = -1);
+    ~HostMemPool();
+
+    HostMemPool(const HostMemPool &)            = delete;
+    HostMemPool &operator=(const HostMemPool &) = delete;
+
+    void *alloc(int64_t size, int32_t align);
+    void  free(void *ptr, int64_t size, int32_t align) noexcept;
+
+    void    setMaxCachedBytes(int64_t maxCachedBytes) noexcept;
+    int64_t maxCachedBytes() const noexcept;
+
+    // Number of bytes currently held by the central depot.
+    int64_t cachedBytes() const noexcept;
+
+    // Releases all blocks held by the central depot back to the system.
+    // Blocks held in the magazines of other threads aren't affected.
+    void trim() noexcept;
+
+    // Returns the calling thread's magazines to the central depot.
+    // Never touches the thread's cache if it wasn't created or was already destroyed.
+    void flushThreadCache() noexcept;
+
+    // Returns the size class index for a request, or -1 if it can't be pooled.
+    static int SizeClass(int64_t size, int32_t align) noexcept;
+
+    // Maximum number of blocks a magazine of a given class holds.
+    static int MagazineCapacity(int sizeClass) noexcept;
+
+private:
+    struct Depot;
+    struct ThreadCache;
+
+    std::shared_ptr<Depot> m_depot;
+
+    // Returns nullptr if the calling thread's cache was already destroyed.
+    ThreadCache *threadCache() noexcept;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_HOST_MEM_POOL_HPP
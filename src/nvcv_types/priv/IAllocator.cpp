@@ -17,13 +17,140 @@
 
 #include "IAllocator.hpp"
 
+#include "AllocTracer.hpp"
 #include "AllocatorManager.hpp"
 #include "IContext.hpp"
+#include "PeakCounter.hpp"
 
 #include <util/Math.hpp>
 
 namespace nvcv::priv {
 
+namespace {
+
+struct MemoryCounters
+{
+    PeakCounter          bytes;
+    std::atomic<int64_t> numAllocs{0};
+
+    void countAlloc(int64_t size) noexcept
+    {
+        bytes.add(size);
+        numAllocs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void countFree(int64_t size) noexcept
+    {
+        bytes.sub(size);
+    }
+};
+
+// Constant-initialized, so allocations done during static initialization are counted too.
+MemoryCounters g_hostMem, g_hostPinnedMem, g_cudaMem;
+
+// Allocators can forward to other allocators, e.g. CustomAllocator forwards the resources
+// that weren't customized to the default allocator. Only the outermost call is counted
+// and recorded in the NVCV_ALLOC_TRACE trace. Allocators traced individually record all
+// calls made to them.
+thread_local int g_allocDepth = 0;
+
+class AllocScope
+{
+public:
+    AllocScope() noexcept
+        : m_outermost(g_allocDepth++ == 0)
+    {
+    }
+
+    ~AllocScope()
+    {
+        --g_allocDepth;
+    }
+
+    AllocScope(const AllocScope &)            = delete;
+    AllocScope &operator=(const AllocScope &) = delete;
+
+    void *onAlloc(const IAllocator &alloc, MemoryCounters &counters, NVCVResourceType resType, void *ptr,
+                  int64_t size, int32_t align) const noexcept
+    {
+        if (ptr != nullptr)
+        {
+            trace(alloc, util::AllocTraceOp::ALLOC, resType, ptr, size, align);
+            if (m_outermost)
+            {
+                counters.countAlloc(size);
+            }
+        }
+        return ptr;
+    }
+
+    void onFree(const IAllocator &alloc, MemoryCounters &counters, NVCVResourceType resType, void *ptr, int64_t size,
+                int32_t align) const noexcept
+    {
+        if (ptr != nullptr)
+        {
+            trace(alloc, util::AllocTraceOp::FREE, resType, ptr, size, align);
+            if (m_outermost)
+            {
+                counters.countFree(size);
+            }
+        }
+    }
+
+private:
+    bool m_outermost;
+
+    void trace(const IAllocator &alloc, util::AllocTraceOp op, NVCVResourceType resType, void *ptr, int64_t size,
+               int32_t align) const noexcept
+    {
+        if (std::shared_ptr<AllocTracer> tracer = GetAllocatorTracer(alloc))
+        {
+            tracer->record(op, resType, ptr, size, align);
+        }
+        if (AllocTracer *tracer = AllocTracer::FromEnv(); tracer && m_outermost)
+        {
+            tracer->record(op, resType, ptr, size, align);
+        }
+    }
+};
+
+} // namespace
+
+AllocatorStats GetAllocatorStats(NVCVResourceType resType) noexcept
+{
+    const MemoryCounters *counters;
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        counters = &g_hostMem;
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        counters = &g_hostPinnedMem;
+        break;
+    case NVCV_RESOURCE_MEM_CUDA:
+        counters = &g_cudaMem;
+        break;
+    default:
+        return {};
+    }
+
+    AllocatorStats stats;
+    stats.bytesInUse = counters->bytes.value();
+    stats.peakBytes  = counters->bytes.peak();
+    stats.numAllocs  = counters->numAllocs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+ForwardedAllocScope::ForwardedAllocScope() noexcept
+{
+    ++g_allocDepth;
+}
+
+ForwardedAllocScope::~ForwardedAllocScope()
+{
+    --g_allocDepth;
+}
+
 NVCVResourceAllocator IAllocator::get(NVCVResourceType resType)
 {
     return doGet(resType);
@@ -49,11 +176,14 @@ void *IAllocator::allocHostMem(int64_t size, int32_t align)
                         size);
     }
 
-    return doAllocHostMem(size, align);
+    AllocScope scope;
+    return scope.onAlloc(*this, g_hostMem, NVCV_RESOURCE_MEM_HOST, doAllocHostMem(size, align), size, align);
 }
 
 void IAllocator::freeHostMem(void *ptr, int64_t size, int32_t align) noexcept
 {
+    AllocScope scope;
+    scope.onFree(*this, g_hostMem, NVCV_RESOURCE_MEM_HOST, ptr, size, align);
     doFreeHostMem(ptr, size, align);
 }
 
@@ -77,11 +207,15 @@ void *IAllocator::allocHostPinnedMem(int64_t size, int32_t align)
                         size);
     }
 
-    return doAllocHostPinnedMem(size, align);
+    AllocScope scope;
+    return scope.onAlloc(*this, g_hostPinnedMem, NVCV_RESOURCE_MEM_HOST_PINNED, doAllocHostPinnedMem(size, align),
+                         size, align);
 }
 
 void IAllocator::freeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept
 {
+    AllocScope scope;
+    scope.onFree(*this, g_hostPinnedMem, NVCV_RESOURCE_MEM_HOST_PINNED, ptr, size, align);
     doFreeHostPinnedMem(ptr, size, align);
 }
 
@@ -105,11 +239,14 @@ void *IAllocator::allocCudaMem(int64_t size, int32_t align)
                         size);
     }
 
-    return doAllocCudaMem(size, align);
+    AllocScope scope;
+    return scope.onAlloc(*this, g_cudaMem, NVCV_RESOURCE_MEM_CUDA, doAllocCudaMem(size, align), size, align);
 }
 
 void IAllocator::freeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
 {
+    AllocScope scope;
+    scope.onFree(*this, g_cudaMem, NVCV_RESOURCE_MEM_CUDA, ptr, size, align);
     doFreeCudaMem(ptr, size, align);
 }
 
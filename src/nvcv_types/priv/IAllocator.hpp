@@ -82,6 +82,30 @@ void FreeHostObj(IAllocator &alloc, T *ptr) noexcept
 priv::IAllocator &GetAllocator(NVCVAllocatorHandle handle);
 priv::IAllocator &GetDefaultAllocator();
 
+struct AllocatorStats
+{
+    int64_t bytesInUse; // Bytes currently allocated.
+    int64_t peakBytes;  // Maximum number of bytes allocated at the same time.
+    int64_t numAllocs;  // Number of allocations done so far.
+};
+
+// Memory of the given type allocated through all allocators.
+AllocatorStats GetAllocatorStats(NVCVResourceType resType) noexcept;
+
+// Allocations done by the current thread while this is alive are considered
+// forwarded from an outer allocation, and aren't counted in the stats. Used by
+// allocators that sub-allocate memory obtained upfront, whose allocations are
+// counted when they're handed out.
+class ForwardedAllocScope
+{
+public:
+    ForwardedAllocScope() noexcept;
+    ~ForwardedAllocScope();
+
+    ForwardedAllocScope(const ForwardedAllocScope &)            = delete;
+    ForwardedAllocScope &operator=(const ForwardedAllocScope &) = delete;
+};
+
 template<>
 class CoreObjManager<NVCVAllocatorHandle> : public HandleManager<IAllocator>
 {
@@ -134,6 +134,17 @@ typename T::HandleType CreateCoreObject(ARGS &&...args)
     return h;
 }
 
+// getArgs(i) must return a std::tuple with the constructor arguments of the i-th object.
+template<class T, class GetArgs>
+void CreateCoreObjects(int32_t count, typename T::HandleType *handles, GetArgs &&getArgs)
+{
+    using H   = typename T::HandleType;
+    auto &mgr = GlobalContext().manager<H>();
+
+    mgr.template createMany<T>(count, handles, std::forward<GetArgs>(getArgs),
+                               [](H h, T *obj) { obj->setHandle(h); });
+}
+
 template<class HandleType>
 int CoreObjectDecRef(HandleType handle)
 {
@@ -142,6 +153,14 @@ int CoreObjectDecRef(HandleType handle)
     return mgr.decRef(handle);
 }
 
+template<class HandleType>
+void CoreObjectDecRefMany(int32_t count, const HandleType *handles, int *newRefCounts)
+{
+    auto &mgr = GlobalContext().manager<HandleType>();
+
+    mgr.decRefMany(count, handles, newRefCounts);
+}
+
 template<class HandleType>
 int CoreObjectIncRef(HandleType handle)
 {
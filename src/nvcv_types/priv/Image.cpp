@@ -193,25 +193,11 @@ void Image::exportData(NVCVImageData &data) const
 
 // ImageWrap implementation -------------------------------------------
 
-ImageWrapData::ImageWrapData(const NVCVImageData &data, NVCVImageDataCleanupFunc cleanup, void *ctxCleanup)
-    : m_cleanup(cleanup)
-    , m_ctxCleanup(ctxCleanup)
-{
-    doValidateData(data);
-
-    m_data = data;
-}
-
-ImageWrapData::~ImageWrapData()
-{
-    doCleanup();
-}
-
-void ImageWrapData::doValidateData(const NVCVImageData &data) const
+// Validates the properties that can be shared by several images: buffer type and format.
+static void ValidateImageDataType(const NVCVImageData &data)
 {
     ImageFormat format{data.format};
 
-    bool success = false;
     switch (data.bufferType)
     {
     case NVCV_IMAGE_BUFFER_STRIDED_CUDA:
@@ -220,29 +206,7 @@ void ImageWrapData::doValidateData(const NVCVImageData &data) const
             throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
                 << "Image buffer type PITCH_DEVICE not consistent with image format " << format;
         }
-
-        if (data.buffer.strided.numPlanes < 1)
-        {
-            throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
-                << "Number of planes must be >= 1, not " << data.buffer.strided.numPlanes;
-        }
-
-        for (int p = 0; p < data.buffer.strided.numPlanes; ++p)
-        {
-            const NVCVImagePlaneStrided &plane = data.buffer.strided.planes[p];
-            if (plane.width < 1 || plane.height < 1)
-            {
-                throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
-                    << "Plane #" << p << " must have dimensions >= 1x1, not " << plane.width << "x" << plane.height;
-            }
-
-            if (plane.basePtr == nullptr)
-            {
-                throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Plane #" << p << "'s base pointer must not be NULL";
-            }
-        }
-        success = true;
-        break;
+        return;
 
     case NVCV_IMAGE_BUFFER_STRIDED_HOST:
         throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
@@ -255,9 +219,79 @@ void ImageWrapData::doValidateData(const NVCVImageData &data) const
         throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Invalid wrapping of buffer type NONE";
     }
 
-    if (!success)
+    throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Image buffer type not supported";
+}
+
+static void ValidateImageBuffer(const NVCVImageData &data)
+{
+    NVCV_ASSERT(data.bufferType == NVCV_IMAGE_BUFFER_STRIDED_CUDA);
+
+    if (data.buffer.strided.numPlanes < 1)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+            << "Number of planes must be >= 1, not " << data.buffer.strided.numPlanes;
+    }
+
+    for (int p = 0; p < data.buffer.strided.numPlanes; ++p)
+    {
+        const NVCVImagePlaneStrided &plane = data.buffer.strided.planes[p];
+        if (plane.width < 1 || plane.height < 1)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                << "Plane #" << p << " must have dimensions >= 1x1, not " << plane.width << "x" << plane.height;
+        }
+
+        if (plane.basePtr == nullptr)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Plane #" << p << "'s base pointer must not be NULL";
+        }
+    }
+}
+
+ImageWrapData::ImageWrapData(const NVCVImageData &data, NVCVImageDataCleanupFunc cleanup, void *ctxCleanup,
+                             bool validate)
+    : m_cleanup(cleanup)
+    , m_ctxCleanup(ctxCleanup)
+{
+    if (validate)
+    {
+        ValidateImageDataType(data);
+        ValidateImageBuffer(data);
+    }
+
+    m_data = data;
+}
+
+ImageWrapData::~ImageWrapData()
+{
+    doCleanup();
+}
+
+void ImageWrapData::ValidateMany(int32_t count, const NVCVImageData *data)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    ValidateImageDataType(data[0]);
+
+    for (int32_t i = 0; i < count; ++i)
     {
-        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Image buffer type not supported";
+        if (i > 0 && (data[i].bufferType != data[0].bufferType || data[i].format != data[0].format))
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                << "Image #" << i << " must have the same buffer type and format as image #0";
+        }
+
+        try
+        {
+            ValidateImageBuffer(data[i]);
+        }
+        catch (Exception &e)
+        {
+            throw Exception(e.code()) << "Image #" << i << ": " << e.msg();
+        }
     }
 }
 
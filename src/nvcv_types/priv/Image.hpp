@@ -48,7 +48,9 @@ private:
 class ImageWrapData final : public CoreObjectBase<IImage>
 {
 public:
-    explicit ImageWrapData(const NVCVImageData &data, NVCVImageDataCleanupFunc cleanup, void *ctxCleanup);
+    // validate can be false if data was already validated by ValidateMany.
+    explicit ImageWrapData(const NVCVImageData &data, NVCVImageDataCleanupFunc cleanup, void *ctxCleanup,
+                           bool validate = true);
 
     ~ImageWrapData();
 
@@ -59,6 +61,10 @@ public:
 
     void exportData(NVCVImageData &data) const override;
 
+    // Validates the data of several images to be wrapped.
+    // They must all have the same buffer type and format.
+    static void ValidateMany(int32_t count, const NVCVImageData *data);
+
 private:
     NVCVImageData m_data;
 
@@ -66,8 +72,6 @@ private:
     void                    *m_ctxCleanup;
 
     void doCleanup() noexcept;
-
-    void doValidateData(const NVCVImageData &data) const;
 };
 
 } // namespace nvcv::priv
@@ -35,6 +35,9 @@ namespace nvcv::priv {
 
 // ImageBatchVarShape implementation -------------------------------------------
 
+// Dirty ranges separated by up to this many clean images are copied at once.
+static constexpr int32_t kDirtyMaxGap = 4096 / sizeof(NVCVImageBufferStrided);
+
 NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t capacity)
 {
     NVCVImageBatchVarShapeRequirements reqs;
@@ -44,6 +47,7 @@ NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t
     reqs.alignBytes = alignof(NVCVImageBufferStrided);
     reqs.alignBytes = std::lcm(alignof(NVCVImageHandle), reqs.alignBytes);
     reqs.alignBytes = std::lcm(alignof(NVCVImageFormat), reqs.alignBytes);
+    reqs.alignBytes = std::lcm(alignof(Size2D), reqs.alignBytes);
 
     reqs.alignBytes = util::RoundUpNextPowerOfTwo(reqs.alignBytes);
 
@@ -61,6 +65,7 @@ NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageFormat), reqs.alignBytes);
 
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageHandle), reqs.alignBytes);
+    AddBuffer(reqs.mem.hostMem, capacity * sizeof(Size2D), reqs.alignBytes);
 
     return reqs;
 }
@@ -68,18 +73,20 @@ NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t
 ImageBatchVarShape::ImageBatchVarShape(NVCVImageBatchVarShapeRequirements reqs, IAllocator &alloc)
     : m_alloc{alloc}
     , m_reqs{std::move(reqs)}
-    , m_dirtyStartingFromIndex(0)
+    , m_dirty(m_reqs.capacity, kDirtyMaxGap)
     , m_numImages(0)
-    , m_cacheMaxSize{Size2D{0,0}}
+    , m_firstFormatMismatch(m_reqs.capacity)
 {
     m_evPostFence     = nullptr;
     m_devImagesBuffer = m_hostImagesBuffer = nullptr;
     m_devFormatsBuffer = m_hostFormatsBuffer = nullptr;
     m_imgHandleBuffer                        = nullptr;
+    m_hostMaxSizeBuffer                      = nullptr;
 
     int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
     int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
     int64_t imgHandlesSize = m_reqs.capacity * sizeof(NVCVImageHandle);
+    int64_t maxSizesSize   = m_reqs.capacity * sizeof(Size2D);
 
     try
     {
@@ -100,6 +107,9 @@ ImageBatchVarShape::ImageBatchVarShape(NVCVImageBatchVarShapeRequirements reqs,
         m_imgHandleBuffer = static_cast<NVCVImageHandle *>(m_alloc->allocHostMem(imgHandlesSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_imgHandleBuffer != nullptr);
 
+        m_hostMaxSizeBuffer = static_cast<Size2D *>(m_alloc->allocHostMem(maxSizesSize, m_reqs.alignBytes));
+        NVCV_ASSERT(m_hostMaxSizeBuffer != nullptr);
+
         NVCV_CHECK_THROW(cudaEventCreateWithFlags(&m_evPostFence, cudaEventDisableTiming));
     }
     catch (...)
@@ -116,6 +126,7 @@ ImageBatchVarShape::ImageBatchVarShape(NVCVImageBatchVarShapeRequirements reqs,
         m_alloc->freeHostMem(m_hostFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
 
         m_alloc->freeHostMem(m_imgHandleBuffer, imgHandlesSize, m_reqs.alignBytes);
+        m_alloc->freeHostMem(m_hostMaxSizeBuffer, maxSizesSize, m_reqs.alignBytes);
         throw;
     }
 }
@@ -128,6 +139,7 @@ ImageBatchVarShape::~ImageBatchVarShape()
     int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
     int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
     int64_t imgHandlesSize = m_reqs.capacity * sizeof(NVCVImageHandle);
+    int64_t maxSizesSize   = m_reqs.capacity * sizeof(Size2D);
 
     m_alloc->freeCudaMem(m_devImagesBuffer, bufImagesSize, m_reqs.alignBytes);
     m_alloc->freeHostMem(m_hostImagesBuffer, bufImagesSize, m_reqs.alignBytes);
@@ -136,6 +148,7 @@ ImageBatchVarShape::~ImageBatchVarShape()
     m_alloc->freeHostMem(m_hostFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
 
     m_alloc->freeHostMem(m_imgHandleBuffer, imgHandlesSize, m_reqs.alignBytes);
+    m_alloc->freeHostMem(m_hostMaxSizeBuffer, maxSizesSize, m_reqs.alignBytes);
 
     NVCV_CHECK_LOG(cudaEventDestroy(m_evPostFence));
 }
@@ -157,59 +170,24 @@ int32_t ImageBatchVarShape::numImages() const
 
 Size2D ImageBatchVarShape::maxSize() const
 {
-    doUpdateCache();
-    return *m_cacheMaxSize;
+    return m_numImages == 0 ? Size2D{0, 0} : m_hostMaxSizeBuffer[m_numImages - 1];
 }
 
 ImageFormat ImageBatchVarShape::uniqueFormat() const
 {
-    doUpdateCache();
-    return *m_cacheUniqueFormat;
-}
-
-SharedCoreObj<IAllocator> ImageBatchVarShape::alloc() const
-{
-    return m_alloc;
-}
-
-void ImageBatchVarShape::doUpdateCache() const
-{
-    if (m_cacheMaxSize && m_cacheUniqueFormat)
+    if (m_numImages == 0 || m_firstFormatMismatch < m_numImages)
     {
-        return;
+        return ImageFormat{NVCV_IMAGE_FORMAT_NONE};
     }
-
-    if (!m_cacheMaxSize)
-    {
-        m_cacheMaxSize = Size2D{0, 0};
-    }
-
-    for (int i = 0; i < m_numImages; ++i)
+    else
     {
-        if (m_cacheMaxSize)
-        {
-            // first plane has the image size
-            m_cacheMaxSize->w = std::max(m_cacheMaxSize->w, m_hostImagesBuffer[i].planes[0].width);
-            m_cacheMaxSize->h = std::max(m_cacheMaxSize->h, m_hostImagesBuffer[i].planes[0].height);
-        }
-
-        constexpr ImageFormat fmt_none = ImageFormat{NVCV_IMAGE_FORMAT_NONE};
-
-        if (!m_cacheUniqueFormat)
-        {
-            m_cacheUniqueFormat = ImageFormat{m_hostFormatsBuffer[i]};
-        }
-        else if (*m_cacheUniqueFormat != fmt_none && *m_cacheUniqueFormat != ImageFormat{m_hostFormatsBuffer[i]})
-        {
-            *m_cacheUniqueFormat = fmt_none;
-        }
+        return ImageFormat{m_hostFormatsBuffer[0]};
     }
+}
 
-    if (!m_cacheUniqueFormat)
-    {
-        NVCV_ASSERT(m_numImages == 0);
-        m_cacheUniqueFormat = ImageFormat{NVCV_IMAGE_FORMAT_NONE};
-    }
+SharedCoreObj<IAllocator> ImageBatchVarShape::alloc() const
+{
+    return m_alloc;
 }
 
 void ImageBatchVarShape::exportData(CUstream stream, NVCVImageBatchData &data) const
@@ -222,35 +200,36 @@ void ImageBatchVarShape::exportData(CUstream stream, NVCVImageBatchData &data) c
     buf.formatList                           = m_devFormatsBuffer;
     buf.hostFormatList                       = m_hostFormatsBuffer;
 
-    NVCV_ASSERT(m_dirtyStartingFromIndex <= m_numImages);
+    NVCV_ASSERT(m_dirty.bounds().end <= m_numImages);
 
-    if (m_dirtyStartingFromIndex < m_numImages)
+    if (!m_dirty.empty())
     {
         NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, m_evPostFence));
 
-        NVCV_CHECK_THROW(cudaMemcpyAsync(
-            m_devImagesBuffer + m_dirtyStartingFromIndex, m_hostImagesBuffer + m_dirtyStartingFromIndex,
-            (m_numImages - m_dirtyStartingFromIndex) * sizeof(*m_devImagesBuffer), cudaMemcpyHostToDevice, stream));
+        m_dirty.forEachRange(
+            [this, stream](int32_t begin, int32_t end)
+            {
+                NVCV_CHECK_THROW(cudaMemcpyAsync(m_devImagesBuffer + begin, m_hostImagesBuffer + begin,
+                                                 (end - begin) * sizeof(*m_devImagesBuffer), cudaMemcpyHostToDevice,
+                                                 stream));
 
-        NVCV_CHECK_THROW(cudaMemcpyAsync(
-            m_devFormatsBuffer + m_dirtyStartingFromIndex, m_hostFormatsBuffer + m_dirtyStartingFromIndex,
-            (m_numImages - m_dirtyStartingFromIndex) * sizeof(*m_devFormatsBuffer), cudaMemcpyHostToDevice, stream));
+                NVCV_CHECK_THROW(cudaMemcpyAsync(m_devFormatsBuffer + begin, m_hostFormatsBuffer + begin,
+                                                 (end - begin) * sizeof(*m_devFormatsBuffer), cudaMemcpyHostToDevice,
+                                                 stream));
+            });
 
         // Signal that we finished reading from m_hostBuffer
         NVCV_CHECK_THROW(cudaEventRecord(m_evPostFence, stream));
 
         // up to m_numImages, we're all good
-        m_dirtyStartingFromIndex = m_numImages;
+        m_dirty.clear();
     }
 
-    doUpdateCache();
-
-    NVCV_ASSERT(m_cacheMaxSize);
-    buf.maxWidth  = m_cacheMaxSize->w;
-    buf.maxHeight = m_cacheMaxSize->h;
+    Size2D maxSize = this->maxSize();
+    buf.maxWidth   = maxSize.w;
+    buf.maxHeight  = maxSize.h;
 
-    NVCV_ASSERT(m_cacheUniqueFormat);
-    buf.uniqueFormat = m_cacheUniqueFormat->value();
+    buf.uniqueFormat = this->uniqueFormat().value();
 }
 
 void ImageBatchVarShape::pushImages(const NVCVImageHandle *images, int32_t numImages)
@@ -283,7 +262,7 @@ void ImageBatchVarShape::pushImages(const NVCVImageHandle *images, int32_t numIm
     }
     catch (...)
     {
-        m_numImages = oldNumImages;
+        doTruncate(oldNumImages);
         throw;
     }
 }
@@ -317,7 +296,7 @@ void ImageBatchVarShape::pushImages(NVCVPushImageFunc cbPushImage, void *ctxCall
     }
     catch (...)
     {
-        m_numImages = oldNumImages;
+        doTruncate(oldNumImages);
         throw;
     }
 }
@@ -345,30 +324,42 @@ void ImageBatchVarShape::doPushImage(NVCVImageHandle imgHandle)
     m_hostImagesBuffer[m_numImages]  = imgData.buffer.strided;
     m_hostFormatsBuffer[m_numImages] = imgData.format;
     m_imgHandleBuffer[m_numImages]   = imgHandle;
+    m_dirty.mark(m_numImages, m_numImages + 1);
 
     Size2D imgSize = img.size();
 
-    ++m_numImages;
-
-    if (m_numImages == 1)
+    if (m_numImages == 0)
     {
-        m_cacheMaxSize      = imgSize;
-        m_cacheUniqueFormat = ImageFormat{imgData.format};
+        m_hostMaxSizeBuffer[0] = imgSize;
     }
     else
     {
-        // Only update max size if data is valid
-        if (m_cacheMaxSize)
-        {
-            m_cacheMaxSize->w = std::max(m_cacheMaxSize->w, imgSize.w);
-            m_cacheMaxSize->h = std::max(m_cacheMaxSize->h, imgSize.h);
-        }
+        const Size2D &prevMaxSize = m_hostMaxSizeBuffer[m_numImages - 1];
+
+        m_hostMaxSizeBuffer[m_numImages] = {std::max(prevMaxSize.w, imgSize.w), std::max(prevMaxSize.h, imgSize.h)};
 
-        if (m_cacheUniqueFormat && *m_cacheUniqueFormat != ImageFormat{imgData.format})
+        if (m_firstFormatMismatch > m_numImages && imgData.format != m_hostFormatsBuffer[0])
         {
-            m_cacheUniqueFormat = ImageFormat{NVCV_IMAGE_FORMAT_NONE};
+            m_firstFormatMismatch = m_numImages;
         }
     }
+
+    ++m_numImages;
+}
+
+void ImageBatchVarShape::doTruncate(int32_t numImages)
+{
+    NVCV_ASSERT(0 <= numImages && numImages <= m_numImages);
+
+    m_numImages = numImages;
+    m_dirty.truncate(m_numImages);
+
+    // The max sizes of the remaining images are still valid, but the
+    // mismatching format might have been removed.
+    if (m_firstFormatMismatch >= m_numImages)
+    {
+        m_firstFormatMismatch = m_reqs.capacity;
+    }
 }
 
 void ImageBatchVarShape::popImages(int32_t numImages)
@@ -391,21 +382,7 @@ void ImageBatchVarShape::popImages(int32_t numImages)
             CoreObjectDecRef(m_imgHandleBuffer[i]);
     }
 
-    m_numImages -= numImages;
-
-    if (m_dirtyStartingFromIndex > m_numImages)
-    {
-        m_dirtyStartingFromIndex = m_numImages;
-    }
-
-    // Removing images invalidates size.
-    m_cacheMaxSize = std::nullopt;
-    // It *does not* always invalidate m_cacheUniqueFormat, though.
-    // But if we're now empty, yeah, we reset it.
-    if (m_numImages == 0)
-    {
-        m_cacheUniqueFormat = std::nullopt;
-    }
+    doTruncate(m_numImages - numImages);
 }
 
 void ImageBatchVarShape::getImages(int32_t begIndex, NVCVImageHandle *outImages, int32_t numImages) const
@@ -434,10 +411,9 @@ void ImageBatchVarShape::clear()
             m_imgHandleBuffer[i] = nullptr;
         }
     }
-    m_numImages              = 0;
-    m_dirtyStartingFromIndex = 0;
-    m_cacheMaxSize           = {0, 0};
-    m_cacheUniqueFormat      = std::nullopt;
+    m_dirty.clear();
+    m_numImages           = 0;
+    m_firstFormatMismatch = m_reqs.capacity;
 }
 
 } // namespace nvcv::priv
@@ -18,6 +18,7 @@
 #ifndef NVCV_CORE_PRIV_IMAGEBATCHVARSHAPE_HPP
 #define NVCV_CORE_PRIV_IMAGEBATCHVARSHAPE_HPP
 
+#include "DirtyRangeSet.hpp"
 #include "IAllocator.hpp"
 #include "IImageBatch.hpp"
 #include "SharedCoreObj.hpp"
@@ -59,7 +60,8 @@ private:
     SharedCoreObj<IAllocator>          m_alloc;
     NVCVImageBatchVarShapeRequirements m_reqs;
 
-    mutable int32_t m_dirtyStartingFromIndex;
+    // Images whose host descriptors weren't copied to the device yet.
+    mutable DirtyRangeSet m_dirty;
 
     int32_t                 m_numImages;
     NVCVImageBufferStrided *m_hostImagesBuffer;
@@ -70,12 +72,15 @@ private:
 
     NVCVImageHandle *m_imgHandleBuffer;
 
-    // Max width/height up to m_numImages.
-    // If nullopt, must be recalculated from the beginning.
-    mutable std::optional<Size2D>      m_cacheMaxSize;
-    mutable std::optional<ImageFormat> m_cacheUniqueFormat;
+    // Images are only pushed to and popped from the end of the batch, so the
+    // aggregates are kept as prefixes, updated in O(1) per pushed/popped image.
 
-    void doUpdateCache() const;
+    // m_hostMaxSizeBuffer[i] is the max width/height of images [0,i].
+    Size2D *m_hostMaxSizeBuffer;
+
+    // Index of the first image whose format differs from the first image's,
+    // or capacity if all images have the same format.
+    int32_t m_firstFormatMismatch;
 
     // TODO: must be retrieved from the resource allocator;
     cudaEvent_t m_evPostFence;
@@ -83,6 +88,9 @@ private:
     // Assumes there's enough space for image.
     // Does not update dirty count
     void doPushImage(NVCVImageHandle imgHandle);
+
+    // Drops the images past numImages, without releasing them.
+    void doTruncate(int32_t numImages);
 };
 
 } // namespace nvcv::priv
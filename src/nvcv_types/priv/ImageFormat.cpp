@@ -22,6 +22,7 @@
 #include "DataLayout.hpp"
 #include "DataType.hpp"
 #include "Exception.hpp"
+#include "LookupTable.hpp"
 
 #include <math.h>
 #include <util/Assert.h>
@@ -446,63 +447,67 @@ constexpr uint32_t FCC(char a, char b, char c, char d)
 #endif
 }
 
-#define FCC_IF(model, css, type, swizzle, ...)                                                   \
-    ImageFormat                                                                                  \
-    {                                                                                            \
-        NVCV_COLOR_MODEL_##model, NVCV_COLOR_SPEC_UNDEFINED, NVCV_CSS_##css, NVCV_MEM_LAYOUT_PL, \
-            NVCV_DATA_KIND_##type, NVCV_SWIZZLE_##swizzle, __VA_ARGS__                           \
-    }
+#define FCC_IF(model, css, type, swizzle, P0, P1, P2) \
+    NVCV_DETAIL_MAKE_FMT(model, UNDEFINED, css, PL, type, swizzle, ASSOCIATED, P0, P1, P2, 0, 0, 0, UNSPECIFIED, U)
 
-#define FCC_BAYER_IF(pattern, type, swizzle, ...)                                                                \
-    ImageFormat                                                                                                  \
-    {                                                                                                            \
-        NVCV_RAW_BAYER_##pattern, NVCV_MEM_LAYOUT_PL, NVCV_DATA_KIND_##type, NVCV_SWIZZLE_##swizzle, __VA_ARGS__ \
-    }
+#define FCC_BAYER_IF(pattern, type, swizzle, P0)                                                  \
+    NVCV_DETAIL_MAKE_RAW_FORMAT1(NVCV_RAW_BAYER_##pattern, NVCV_MEM_LAYOUT_PL, NVCV_DATA_KIND_##type, \
+                                 NVCV_SWIZZLE_##swizzle, NVCV_ALPHA_ASSOCIATED, NVCV_PACKING_##P0)
+
+struct FourCCFormat
+{
+    uint32_t        fourcc;
+    NVCVImageFormat format;
+};
 
 // clang-format off
-// Using vector b/c we want to preserve ordering and it's probably faster than using std::map
-// due to cache locality.
-const std::vector<std::pair<uint32_t, ImageFormat>> g_FourCC =
+// When a format has several fourcc codes, the first one is returned by ImageFormat::fourCC.
+constexpr FourCCFormat g_FourCC[] =
 {
-    { FCC('R','G','B','1'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, NVCV_PACKING_X3Y3Z2) },         // RGB332
-    { FCC('R','4','4','4'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, NVCV_PACKING_b4X4Y4Z4) },       // RGB444
-    { FCC('R','G','B','0'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, NVCV_PACKING_b1X5Y5Z5) },       // RGB555
-    { FCC('R','G','B','P'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, NVCV_PACKING_X5Y6Z5) },         // RGB565
-    { FCC('R','G','B','Q'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, NVCV_PACKING_X5Y5b1Z5) },       // RGB555X
-    { FCC('R','G','B','R'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, NVCV_PACKING_X5Y6Z5) },         // RGB565X
-    { FCC('B','G','R','3'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, NVCV_PACKING_X8_Y8_Z8) },       // BGR24
-    { FCC('R','G','B','3'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, NVCV_PACKING_X8_Y8_Z8) },       // RGB24
-    { FCC('B','G','R','4'), FCC_IF(RGB, 444, UNSIGNED, ZYXW, NVCV_PACKING_X8_Y8_Z8_W8) },    // BGR24
-    { FCC('R','G','B','4'), FCC_IF(RGB, 444, UNSIGNED, XYZW, NVCV_PACKING_X8_Y8_Z8_W8) },    // RGB24
-
-    { FCC('B','A','8','1'), FCC_BAYER_IF(BGGR, UNSIGNED, X000, NVCV_PACKING_X8) },           // SBGGR8
-
-    { FCC('A','Y','U','V'), FCC_IF(YCbCr, 444, UNSIGNED, YZWX, NVCV_PACKING_X8_Y8_Z8_W8) },
-    { FCC('A','Y','U','V'), FCC_IF(YCbCr, 444, UNSIGNED, YZWX, NVCV_PACKING_X8_Y8_Z8_W8) },
-
-    { FCC('G','R','A','Y'), FCC_IF(YCbCr, 444, UNSIGNED, X000, NVCV_PACKING_X8) },
-    { FCC('Y','8',' ',' '), FCC_IF(YCbCr, 444, UNSIGNED, X000, NVCV_PACKING_X8) },
-    { FCC('Y','8','0','0'), FCC_IF(YCbCr, 444, UNSIGNED, X000, NVCV_PACKING_X8) },
-    { FCC('Y','1','6',' '), FCC_IF(YCbCr, 444, UNSIGNED, X000, NVCV_PACKING_X16) },
-
-    { FCC('U','Y','V','Y'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, NVCV_PACKING_Y8_X8__Z8_X8) },
-    { FCC('Y','U','Y','2'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, NVCV_PACKING_X8_Y8__X8_Z8) },
-    { FCC('Y','U','Y','V'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, NVCV_PACKING_X8_Y8__X8_Z8) },
-    { FCC('Y','U','N','V'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, NVCV_PACKING_X8_Y8__X8_Z8) },
-    { FCC('Y','V','Y','U'), FCC_IF(YCbCr, 422, UNSIGNED, XZY1, NVCV_PACKING_X8_Y8__X8_Z8) },
-
-    { FCC('I','4','2','0'), FCC_IF(YCbCr, 420, UNSIGNED, XYZ0, NVCV_PACKING_X8, NVCV_PACKING_X8, NVCV_PACKING_X8) },
-    { FCC('I','Y','U','V'), FCC_IF(YCbCr, 420, UNSIGNED, XYZ0, NVCV_PACKING_X8, NVCV_PACKING_X8, NVCV_PACKING_X8) },
-
-    { FCC('N','V','1','2'), FCC_IF(YCbCr, 420, UNSIGNED, XYZ0, NVCV_PACKING_X8, NVCV_PACKING_X8_Y8) },
-    { FCC('N','V','2','1'), FCC_IF(YCbCr, 420, UNSIGNED, XZY0, NVCV_PACKING_X8, NVCV_PACKING_X8_Y8) },
-
-    { FCC('Y','V','1','2'), FCC_IF(YCbCr, 420, UNSIGNED, XZY0, NVCV_PACKING_X8, NVCV_PACKING_X8, NVCV_PACKING_X8) },
-    { FCC('Y','V','1','6'), FCC_IF(YCbCr, 422, UNSIGNED, XZY0, NVCV_PACKING_X8, NVCV_PACKING_X8, NVCV_PACKING_X8) },
+    { FCC('R','G','B','1'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, X3Y3Z2, 0, 0) },      // RGB332
+    { FCC('R','4','4','4'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, b4X4Y4Z4, 0, 0) },    // RGB444
+    { FCC('R','G','B','0'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, b1X5Y5Z5, 0, 0) },    // RGB555
+    { FCC('R','G','B','P'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, X5Y6Z5, 0, 0) },      // RGB565
+    { FCC('R','G','B','Q'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, X5Y5b1Z5, 0, 0) },    // RGB555X
+    { FCC('R','G','B','R'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, X5Y6Z5, 0, 0) },      // RGB565X
+    { FCC('B','G','R','3'), FCC_IF(RGB, 444, UNSIGNED, ZYX1, X8_Y8_Z8, 0, 0) },    // BGR24
+    { FCC('R','G','B','3'), FCC_IF(RGB, 444, UNSIGNED, XYZ1, X8_Y8_Z8, 0, 0) },    // RGB24
+    { FCC('B','G','R','4'), FCC_IF(RGB, 444, UNSIGNED, ZYXW, X8_Y8_Z8_W8, 0, 0) }, // BGR24
+    { FCC('R','G','B','4'), FCC_IF(RGB, 444, UNSIGNED, XYZW, X8_Y8_Z8_W8, 0, 0) }, // RGB24
+
+    { FCC('B','A','8','1'), FCC_BAYER_IF(BGGR, UNSIGNED, X000, X8) },              // SBGGR8
+
+    { FCC('A','Y','U','V'), FCC_IF(YCbCr, 444, UNSIGNED, YZWX, X8_Y8_Z8_W8, 0, 0) },
+    { FCC('A','Y','U','V'), FCC_IF(YCbCr, 444, UNSIGNED, YZWX, X8_Y8_Z8_W8, 0, 0) },
+
+    { FCC('G','R','A','Y'), FCC_IF(YCbCr, 444, UNSIGNED, X000, X8, 0, 0) },
+    { FCC('Y','8',' ',' '), FCC_IF(YCbCr, 444, UNSIGNED, X000, X8, 0, 0) },
+    { FCC('Y','8','0','0'), FCC_IF(YCbCr, 444, UNSIGNED, X000, X8, 0, 0) },
+    { FCC('Y','1','6',' '), FCC_IF(YCbCr, 444, UNSIGNED, X000, X16, 0, 0) },
+
+    { FCC('U','Y','V','Y'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, Y8_X8__Z8_X8, 0, 0) },
+    { FCC('Y','U','Y','2'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, X8_Y8__X8_Z8, 0, 0) },
+    { FCC('Y','U','Y','V'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, X8_Y8__X8_Z8, 0, 0) },
+    { FCC('Y','U','N','V'), FCC_IF(YCbCr, 422, UNSIGNED, XYZ1, X8_Y8__X8_Z8, 0, 0) },
+    { FCC('Y','V','Y','U'), FCC_IF(YCbCr, 422, UNSIGNED, XZY1, X8_Y8__X8_Z8, 0, 0) },
+
+    { FCC('I','4','2','0'), FCC_IF(YCbCr, 420, UNSIGNED, XYZ0, X8, X8, X8) },
+    { FCC('I','Y','U','V'), FCC_IF(YCbCr, 420, UNSIGNED, XYZ0, X8, X8, X8) },
+
+    { FCC('N','V','1','2'), FCC_IF(YCbCr, 420, UNSIGNED, XYZ0, X8, X8_Y8, 0) },
+    { FCC('N','V','2','1'), FCC_IF(YCbCr, 420, UNSIGNED, XZY0, X8, X8_Y8, 0) },
+
+    { FCC('Y','V','1','2'), FCC_IF(YCbCr, 420, UNSIGNED, XZY0, X8, X8, X8) },
+    { FCC('Y','V','1','6'), FCC_IF(YCbCr, 422, UNSIGNED, XZY0, X8, X8, X8) },
 };
 // clang-format on
 
 #undef FCC_IF
+#undef FCC_BAYER_IF
+
+// Tables for both directions are sorted at compile time, lookups are binary searches.
+constexpr auto g_FourCCToFormat = MakeLookupTable(g_FourCC, &FourCCFormat::fourcc, &FourCCFormat::format);
+constexpr auto g_FormatToFourCC = MakeLookupTable(g_FourCC, &FourCCFormat::format, &FourCCFormat::fourcc);
 
 } // namespace
 
@@ -517,19 +522,16 @@ ImageFormat ImageFormat::FromFourCC(uint32_t fourcc, ColorSpec colorSpec, NVCVMe
     }
     fourcc = *reinterpret_cast<uint32_t *>(tmp);
 
-    for (auto &p : g_FourCC)
+    if (const NVCVImageFormat *fmt = g_FourCCToFormat.find(fourcc))
     {
-        if (p.first == fourcc)
-        {
-            ImageFormat newFmt = p.second;
+        ImageFormat newFmt{*fmt};
 
-            if (NeedsColorspec(p.second.colorModel()))
-            {
-                newFmt = newFmt.colorSpec(colorSpec);
-            }
-
-            return newFmt.memLayout(memLayout);
+        if (NeedsColorspec(newFmt.colorModel()))
+        {
+            newFmt = newFmt.colorSpec(colorSpec);
         }
+
+        return newFmt.memLayout(memLayout);
     }
 
     throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
@@ -564,7 +566,7 @@ int ImageFormat::planeBPP(int plane) const noexcept
 
 NVCVSwizzle ImageFormat::swizzle() const noexcept
 {
-    return static_cast<NVCVSwizzle>(ExtractBitfield(m_format, 0, 6));
+    return nvcv::detail::ImageFormatSwizzle(m_format);
 }
 
 NVCVColorModel ImageFormat::colorModel() const noexcept
@@ -631,7 +633,7 @@ ColorSpec ImageFormat::colorSpec() const noexcept
 
 NVCVMemLayout ImageFormat::memLayout() const noexcept
 {
-    return static_cast<NVCVMemLayout>(ExtractBitfield(m_format, 12, 3));
+    return nvcv::detail::ImageFormatMemLayout(m_format);
 }
 
 ColorFormat ImageFormat::colorFormat() const noexcept
@@ -681,13 +683,12 @@ int ImageFormat::planeRowAlignment(int plane) const noexcept
 
 int ImageFormat::numPlanes() const noexcept
 {
-    return (this->planeNumChannels(0) != 0 ? 1 : 0) + (this->planeNumChannels(1) != 0 ? 1 : 0)
-         + (this->planeNumChannels(2) != 0 ? 1 : 0) + (this->planeNumChannels(3) != 0 ? 1 : 0);
+    return nvcv::detail::ImageFormatNumPlanes(m_format);
 }
 
 NVCVAlphaType ImageFormat::alphaType() const noexcept
 {
-    return static_cast<NVCVAlphaType>(ExtractBitfield(m_format, 6, 1));
+    return nvcv::detail::ImageFormatAlphaType(m_format);
 }
 
 ImageFormat ImageFormat::alphaType(NVCVAlphaType newAlphaType) const
@@ -965,12 +966,9 @@ uint32_t ImageFormat::fourCC() const
     // normalize
     ImageFormat fmtNorm = this->colorSpec(NVCV_COLOR_SPEC_UNDEFINED).memLayout(NVCV_MEM_LAYOUT_PL);
 
-    for (auto &p : g_FourCC)
+    if (const uint32_t *fourcc = g_FormatToFourCC.find(fmtNorm.value()))
     {
-        if (p.second == fmtNorm)
-        {
-            return p.first;
-        }
+        return *fourcc;
     }
 
     throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
@@ -1215,70 +1213,90 @@ ImageFormat UpdateColorSpec(ImageFormat fmt, ColorSpec source)
     return fmt.colorSpec(cspec);
 }
 
-std::ostream &operator<<(std::ostream &out, ImageFormat fmt)
+namespace {
+
+struct FormatName
 {
-    switch (fmt.value())
-    {
-#define NVCV_ENUM(E) \
-    case E:          \
-        return out << #E;
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NONE);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_U8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_U8_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_S8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_U16);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_S16);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_S16_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_U32);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_S32);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8_ER);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8_ER_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16_ER);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16_ER_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12_ER);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12_ER_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24_ER);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24_ER_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBA8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_BGR8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_BGRA8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_F32);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_F64);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_2S16);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_2S16_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_2F32);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_C64);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_2C64);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_C128);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_2C128);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY_ER);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY_ER_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV_ER);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV_ER_BL);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8_1U_U8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8_7U_U8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBA8_3U_U16);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBA8_3POS3D_U32);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8_3D_F32);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_YCCK8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_CMYK8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_HSV8);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBAf32);
-        NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBAf32p);
+    NVCVImageFormat format;
+    const char     *name;
+};
+
+constexpr FormatName g_FormatNames[] = {
+#define NVCV_ENUM(E) {E, #E}
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NONE),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_U8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_U8_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_S8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_U16),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_S16),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_S16_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_U32),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_S32),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8_ER),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y8_ER_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16_ER),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_Y16_ER_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12_ER),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV12_ER_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24_ER),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_NV24_ER_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBA8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_BGR8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_BGRA8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_F32),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_F64),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_2S16),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_2S16_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_2F32),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_C64),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_2C64),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_C128),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_2C128),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY_ER),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_UYVY_ER_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV_ER),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_YUYV_ER_BL),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8_1U_U8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8_7U_U8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBA8_3U_U16),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBA8_3POS3D_U32),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGB8_3D_F32),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_YCCK8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_CMYK8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_HSV8),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBAf32),
+    NVCV_ENUM(NVCV_IMAGE_FORMAT_RGBAf32p),
 #undef NVCV_ENUM
+};
+
+constexpr auto g_FormatToName = MakeLookupTable(g_FormatNames, &FormatName::format, &FormatName::name);
+
+} // namespace
+
+const char *GetPredefinedName(ImageFormat fmt) noexcept
+{
+    const char *const *name = g_FormatToName.find(fmt.value());
+    return name ? *name : nullptr;
+}
+
+std::ostream &operator<<(std::ostream &out, ImageFormat fmt)
+{
+    if (const char *name = GetPredefinedName(fmt))
+    {
+        return out << name;
     }
 
     out << "NVCVImageFormat(" << fmt.colorModel() << ",";
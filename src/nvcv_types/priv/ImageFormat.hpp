@@ -24,6 +24,7 @@
 #include "Size.hpp"
 
 #include <nvcv/ImageFormat.h>
+#include <nvcv/detail/FormatDecode.hpp>
 #include <util/StaticVector.hpp>
 
 #include <array>
@@ -136,6 +137,9 @@ private:
     NVCVImageFormat m_format;
 };
 
+// Returns the name of a predefined image format, or NULL if it isn't one.
+const char *GetPredefinedName(ImageFormat fmt) noexcept;
+
 std::ostream &operator<<(std::ostream &out, ImageFormat format);
 
 constexpr NVCVImageFormat ImageFormat::value() const noexcept
@@ -155,65 +159,12 @@ constexpr bool ImageFormat::operator!=(ImageFormat that) const noexcept
 
 constexpr NVCVPacking ImageFormat::planePacking(int plane) const noexcept
 {
-    // |11 10 09 08|05 04|03 02 01 00|
-    // |  ENC(BPP) |#CH-1|   PACK    |
-
-    auto decode = [](uint32_t plane, uint32_t isPlanar, uint32_t value, int chlen, int packlen, int bpplen)
-    {
-        uint32_t bpp;
-        uint32_t nch;
-        uint32_t pack;
-        if (isPlanar)
-        {
-            bpp  = ExtractBitfield(value, packlen + chlen, bpplen);
-            nch  = ExtractBitfield(value, packlen, chlen);
-            pack = ExtractBitfield(value, 0, packlen);
-        }
-        else
-        {
-            bpp  = 0;
-            nch  = 0;
-            pack = 0;
-        }
-
-        // if we keep using bpp==0 for 8-bit, since the 4th plane doesn't
-        // have a channel count nor packing, the corresponding NVCVPacking
-        // would be equal to NVCV_PACKING_0. To avoid it, we don't allow
-        // 4th plane to have 128bpp, and we use 128bpp representation (7) to denote 8-bit.
-        if (plane == 3 && packlen == 0 && bpp == 0b111)
-        {
-            // encoding for NVCV_PACKING_X8
-            bpp  = 0;
-            pack = 4;
-        }
-
-        return SetBitfield(bpp, 6, 4) | SetBitfield(nch, 4, 2) | SetBitfield(pack, 0, 4);
-    };
-
-    uint32_t isPlanar = ExtractBitfield(m_format, 7, 1);
-    switch (plane)
-    {
-    case 0:
-        return (NVCVPacking)decode(plane, 1, ExtractBitfield(m_format, 35, 9), 2, 3, 4);
-
-    case 1:
-        return (NVCVPacking)decode(plane, isPlanar, ExtractBitfield(m_format, 44, 7), 1, 3, 3);
-
-    case 2:
-        return (NVCVPacking)decode(plane, isPlanar, ExtractBitfield(m_format, 51, 7), 1, 3, 3);
-
-    case 3:
-        return (NVCVPacking)decode(plane, isPlanar, ExtractBitfield(m_format, 58, 3), 0, 0, 3);
-
-    default:
-        return NVCV_PACKING_0;
-    }
+    return nvcv::detail::ImageFormatPlanePacking(m_format, plane);
 }
 
 constexpr NVCVDataKind ImageFormat::dataKind() const noexcept
 {
-    // signed -> unsigned is defined behavior
-    return (NVCVDataKind)ExtractBitfield(m_format, 61, 3);
+    return nvcv::detail::ImageFormatDataKind(m_format);
 }
 
 bool HasSameDataLayout(ImageFormat a, ImageFormat b) noexcept;
@@ -18,114 +18,284 @@
 #ifndef NVCV_PRIV_CORE_LOCK_FREE_STACK_HPP
 #define NVCV_PRIV_CORE_LOCK_FREE_STACK_HPP
 
+#include <util/Assert.h>
+
 #include <atomic>
 #include <cassert>
-#include <stack>
+#include <cstdint>
+#include <type_traits>
 
 namespace nvcv::priv {
 
 template<class T>
 constexpr bool IsForwardListNode = std::is_convertible_v<decltype(std::declval<T>().next), T *>;
 
-template<class Node, std::enable_if_t<IsForwardListNode<Node>, int> = 0>
+/** How the stack's head is protected against the ABA problem in pop().
+ *
+ * TAGGED: the head pointer is stored together with a counter that is incremented on
+ *         every modification, so that a CAS against a head that was popped and pushed
+ *         back in the meantime fails. The pointer and counter are packed in 64 bits,
+ *         a 32-bit counter on 32-bit platforms and a 16-bit counter in the unused upper
+ *         bits of 48-bit user-space addresses on x86-64 and aarch64. Pushing a node
+ *         whose address uses the counter bits aborts the process.
+ * LOCKED: the head's lowest bit is used as a lock while popping, concurrent poppers
+ *         spin until it's released. Used where pointers don't leave room for a counter.
+ */
+enum class LockFreeStackHead
+{
+    TAGGED,
+    LOCKED
+};
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)
+constexpr LockFreeStackHead kDefaultLockFreeStackHead = LockFreeStackHead::TAGGED;
+#else
+constexpr LockFreeStackHead kDefaultLockFreeStackHead
+    = sizeof(void *) == 4 ? LockFreeStackHead::TAGGED : LockFreeStackHead::LOCKED;
+#endif
+
+/** Intrusive lock-free stack.
+ *
+ * Nodes are linked by their `next` member. push operations have release semantics and
+ * pop operations acquire semantics, so whatever was written to a node before pushing it
+ * is visible to the thread that pops it.
+ *
+ * pop() and popList() may read the `next` member of a node that was concurrently popped
+ * by another thread, so nodes must not be deallocated while the stack is in use.
+ */
+template<class Node, LockFreeStackHead Head = kDefaultLockFreeStackHead,
+         std::enable_if_t<IsForwardListNode<Node>, int> = 0>
 class LockFreeStack
 {
 public:
     Node *pop() noexcept
     {
-        // Lock the stack's head so that we can pop current head and set the
-        // new one to curhead->next atomically below.
-        for (;;)
+        if constexpr (Head == LockFreeStackHead::TAGGED)
         {
-            Node *head = doGetUnlocked(m_head.load(std::memory_order_relaxed));
-            if (!head)
+            Word head = m_head.load(std::memory_order_acquire);
+            for (;;)
             {
-                return nullptr;
-            }
+                Node *node = doGetPtr(head);
+                if (!node)
+                {
+                    return nullptr;
+                }
 
-            if (m_head.compare_exchange_weak(head, doGetLocked(head), std::memory_order_relaxed,
-                                             std::memory_order_release))
+                // If node was popped (and maybe pushed back) by someone else in the
+                // meantime, the head's tag changed and the exchange fails.
+                Node *next = node->next;
+                if (m_head.compare_exchange_weak(head, doMakeHead(next, head), std::memory_order_acquire,
+                                                 std::memory_order_acquire))
+                {
+                    return node;
+                }
+            }
+        }
+        else
+        {
+            // Lock the stack's head so that we can pop current head and set the
+            // new one to curhead->next atomically below.
+            Word head;
+            for (;;)
             {
-                break;
+                head = doGetUnlocked(m_head.load(std::memory_order_relaxed));
+                if (!head)
+                {
+                    return nullptr;
+                }
+
+                if (m_head.compare_exchange_weak(head, doGetLocked(head), std::memory_order_acquire,
+                                                 std::memory_order_relaxed))
+                {
+                    break;
+                }
             }
+
+            // Nobody else can change the head while it's locked, unlock it
+            // setting it to oldHead->next.
+            Node *node = doGetPtr(head);
+            m_head.store(doMakeHead(node->next, head), std::memory_order_release);
+            return node;
         }
+    }
 
-        // Set the newHead to oldHead->next and return oldHead
-        Node *oldHead, *newHead;
-        do
+    /** Pops up to maxCount nodes at once
+     *
+     * @param maxCount Maximum number of nodes to pop, must be > 0.
+     * @param count    Receives the number of nodes popped.
+     *
+     * @return The popped nodes as a list terminated by nullptr, in stack order.
+     */
+    Node *popList(int maxCount, int &count) noexcept
+    {
+        assert(maxCount > 0);
+
+        Node *first, *last;
+        if constexpr (Head == LockFreeStackHead::TAGGED)
         {
-            oldHead = m_head.load(std::memory_order_relaxed);
-            assert(doGetLocked(oldHead)); // must have been locked above
+            // Nodes below the head only change after being popped, which changes
+            // the head's tag. If the exchange succeeds, the walked list is the
+            // one we took.
+            Word head = m_head.load(std::memory_order_acquire);
+            for (;;)
+            {
+                first = doGetPtr(head);
+                if (!first)
+                {
+                    count = 0;
+                    return nullptr;
+                }
+
+                last  = first;
+                count = 1;
+                while (count < maxCount && last->next)
+                {
+                    last = last->next;
+                    ++count;
+                }
+
+                if (m_head.compare_exchange_weak(head, doMakeHead(last->next, head), std::memory_order_acquire,
+                                                 std::memory_order_acquire))
+                {
+                    break;
+                }
+            }
+        }
+        else
+        {
+            // Lock the stack's head, as in pop(). While locked, nobody else
+            // can change the list, so it's safe to walk it.
+            Word head;
+            for (;;)
+            {
+                head = doGetUnlocked(m_head.load(std::memory_order_relaxed));
+                if (!head)
+                {
+                    count = 0;
+                    return nullptr;
+                }
 
-            newHead = doGetUnlocked(oldHead)->next;
+                if (m_head.compare_exchange_weak(head, doGetLocked(head), std::memory_order_acquire,
+                                                 std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+
+            first = last = doGetPtr(head);
+            count        = 1;
+            while (count < maxCount && last->next)
+            {
+                last = last->next;
+                ++count;
+            }
+
+            // Unlock the stack setting its new head
+            m_head.store(doMakeHead(last->next, head), std::memory_order_release);
         }
-        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_relaxed, std::memory_order_release));
 
-        return doGetUnlocked(oldHead);
+        last->next = nullptr;
+        return first;
     }
 
     void push(Node *newNode) noexcept
     {
-        Node *oldHead;
-        do
-        {
-            oldHead       = doGetUnlocked(m_head.load(std::memory_order_relaxed));
-            newNode->next = oldHead;
-        }
-        while (!m_head.compare_exchange_weak(oldHead, newNode, std::memory_order_relaxed, std::memory_order_release));
+        pushStack(newNode, newNode);
     }
 
     Node *release() noexcept
     {
-        Node *h = m_head.load(std::memory_order_relaxed);
-        while (!m_head.compare_exchange_weak(h, nullptr, std::memory_order_relaxed, std::memory_order_release))
+        Word head = doGetUnlocked(m_head.load(std::memory_order_relaxed));
+        while (!m_head.compare_exchange_weak(head, doMakeHead(nullptr, head), std::memory_order_acquire,
+                                             std::memory_order_relaxed))
         {
+            head = doGetUnlocked(head);
         }
 
-        return h;
+        return doGetPtr(head);
     }
 
     void pushStack(Node *newHead, Node *last) noexcept
     {
-        Node *oldHead;
+        Word oldHead = doGetUnlocked(m_head.load(std::memory_order_relaxed));
         do
         {
-            oldHead    = doGetUnlocked(m_head.load(std::memory_order_relaxed));
-            last->next = oldHead;
+            oldHead    = doGetUnlocked(oldHead);
+            last->next = doGetPtr(oldHead);
         }
-        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_relaxed, std::memory_order_release));
+        while (!m_head.compare_exchange_weak(oldHead, doMakeHead(newHead, oldHead), std::memory_order_release,
+                                             std::memory_order_relaxed));
     }
 
     Node *top() const
     {
-        return doGetUnlocked(m_head.load());
+        return doGetPtr(doGetUnlocked(m_head.load(std::memory_order_acquire)));
     }
 
     void clear()
     {
-        m_head = nullptr;
+        release();
     }
 
     bool empty() const
     {
-        return m_head == nullptr;
+        return top() == nullptr;
     }
 
 private:
-    std::atomic<Node *> m_head = nullptr;
+    using Word = uint64_t;
+
+    static_assert(std::atomic<Word>::is_always_lock_free);
+
+    // Tagged heads keep the pointer in the lower bits and the tag above them
+    static constexpr int  kTagShift = sizeof(void *) == 4 ? 32 : 48;
+    static constexpr Word kPtrMask  = Head == LockFreeStackHead::TAGGED ? (Word(1) << kTagShift) - 1 : ~Word(0);
+
+    std::atomic<Word> m_head = 0;
+
+    static Node *doGetPtr(Word head)
+    {
+        return reinterpret_cast<Node *>(static_cast<uintptr_t>(head & kPtrMask));
+    }
 
-    template<typename T>
-    static T *doGetUnlocked(T *maybe_locked)
+    // Returns a head pointing to node, with the tag following the one in prevHead
+    static Word doMakeHead(Node *node, Word prevHead)
     {
-        static_assert(alignof(Node) >= 2);
-        return reinterpret_cast<T *>(reinterpret_cast<intptr_t>(maybe_locked) & -2);
+        Word ptr = reinterpret_cast<uintptr_t>(node);
+        if constexpr (Head == LockFreeStackHead::TAGGED)
+        {
+            // Checked in release builds too: with pointer tagging (e.g. aarch64 TBI/MTE) or
+            // 5-level paging, addresses use the tag bits and the stack would be corrupted.
+            if ((ptr & ~kPtrMask) != 0)
+            {
+                NvCVAssert(NVCV_SOURCE_FILE_NAME, NVCV_SOURCE_FILE_LINENO,
+                           "Node address doesn't leave room for the lock-free stack tag");
+            }
+            return ptr | (((prevHead >> kTagShift) + 1) << kTagShift);
+        }
+        else
+        {
+            return ptr;
+        }
+    }
+
+    static Word doGetUnlocked(Word head)
+    {
+        if constexpr (Head == LockFreeStackHead::LOCKED)
+        {
+            static_assert(alignof(Node) >= 2);
+            return head & ~Word(1);
+        }
+        else
+        {
+            return head;
+        }
     }
 
-    template<typename T>
-    static T *doGetLocked(T *maybe_unlocked)
+    static Word doGetLocked(Word head)
     {
-        static_assert(alignof(Node) >= 2);
-        return reinterpret_cast<T *>(reinterpret_cast<intptr_t>(maybe_unlocked) | 1);
+        static_assert(Head == LockFreeStackHead::LOCKED && alignof(Node) >= 2);
+        return head | 1;
     }
 };
 
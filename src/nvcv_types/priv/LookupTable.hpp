@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_FORMAT_PRIV_LOOKUP_TABLE_HPP
+#define NVCV_FORMAT_PRIV_LOOKUP_TABLE_HPP
+
+#include <cstddef>
+
+namespace nvcv::priv {
+
+/** Key/value table sorted at compile time and searched with a binary search.
+ *
+ * Entries with equivalent keys keep the order they were given in, and
+ * lookups return the first of them.
+ */
+template<class K, class V, size_t N>
+class LookupTable
+{
+public:
+    struct Entry
+    {
+        K key;
+        V value;
+    };
+
+    template<class T>
+    constexpr LookupTable(const T (&items)[N], K T::*key, V T::*value)
+        : m_entries{}
+    {
+        // Stable insertion sort, N is small and this only runs at compile time.
+        for (size_t i = 0; i < N; ++i)
+        {
+            Entry  e = {items[i].*key, items[i].*value};
+            size_t j = i;
+            for (; j > 0 && e.key < m_entries[j - 1].key; --j)
+            {
+                m_entries[j] = m_entries[j - 1];
+            }
+            m_entries[j] = e;
+        }
+    }
+
+    constexpr const V *find(K key) const noexcept
+    {
+        size_t first = 0, count = N;
+        while (count > 0)
+        {
+            size_t half = count / 2;
+            if (m_entries[first + half].key < key)
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+
+        return first < N && !(key < m_entries[first].key) ? &m_entries[first].value : nullptr;
+    }
+
+    constexpr size_t size() const noexcept
+    {
+        return N;
+    }
+
+    constexpr const Entry *begin() const noexcept
+    {
+        return m_entries;
+    }
+
+    constexpr const Entry *end() const noexcept
+    {
+        return m_entries + N;
+    }
+
+private:
+    Entry m_entries[N];
+};
+
+// Builds a LookupTable from an array of structs, given which members are the key and the value.
+template<class T, size_t N, class K, class V>
+constexpr LookupTable<K, V, N> MakeLookupTable(const T (&items)[N], K T::*key, V T::*value)
+{
+    return LookupTable<K, V, N>(items, key, value);
+}
+
+} // namespace nvcv::priv
+
+#endif // NVCV_FORMAT_PRIV_LOOKUP_TABLE_HPP
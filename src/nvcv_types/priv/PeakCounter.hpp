@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PRIV_CORE_PEAK_COUNTER_HPP
+#define NVCV_PRIV_CORE_PEAK_COUNTER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace nvcv::priv {
+
+/** A counter that also remembers the highest value it reached.
+ *
+ * It's meant for statistics that stay enabled in production, so all
+ * operations are relaxed. The peak is only written when a new maximum is
+ * reached, which is rare once the counter reaches its steady state.
+ */
+class PeakCounter
+{
+public:
+    int64_t add(int64_t n) noexcept
+    {
+        int64_t value = m_value.fetch_add(n, std::memory_order_relaxed) + n;
+
+        int64_t peak = m_peak.load(std::memory_order_relaxed);
+        while (value > peak && !m_peak.compare_exchange_weak(peak, value, std::memory_order_relaxed))
+        {
+        }
+        return value;
+    }
+
+    int64_t sub(int64_t n) noexcept
+    {
+        return m_value.fetch_sub(n, std::memory_order_relaxed) - n;
+    }
+
+    int64_t value() const noexcept
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    int64_t peak() const noexcept
+    {
+        return m_peak.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<int64_t> m_value{0};
+    std::atomic<int64_t> m_peak{0};
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_PRIV_CORE_PEAK_COUNTER_HPP
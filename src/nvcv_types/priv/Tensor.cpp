@@ -23,6 +23,7 @@
 #include "Requirements.hpp"
 #include "TensorData.hpp"
 #include "TensorLayout.hpp"
+#include "TensorRequirementsCache.hpp"
 #include "TensorShape.hpp"
 
 #include <cuda_runtime.h>
@@ -91,8 +92,39 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t numImages, Size2D imgSiz
     return CalcRequirements(layout.rank, shape, dtype, layout, userBaseAlign, userRowAlign);
 }
 
+TensorRequirementsCache &Tensor::RequirementsCache()
+{
+    static TensorRequirementsCache cache;
+    return cache;
+}
+
 NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *shape, const DataType &dtype,
                                                 NVCVTensorLayout layout, int32_t userBaseAlign, int32_t userRowAlign)
+{
+    int dev;
+    NVCV_CHECK_THROW(cudaGetDevice(&dev));
+
+    // Invalid ranks are reported by doCalcRequirements
+    if (rank <= 0 || rank > NVCV_TENSOR_MAX_RANK)
+    {
+        return doCalcRequirements(dev, rank, shape, dtype, layout, userBaseAlign, userRowAlign);
+    }
+
+    TensorRequirementsCache &cache = RequirementsCache();
+
+    auto key = TensorRequirementsCache::MakeKey(rank, shape, dtype.value(), layout, dev, userBaseAlign, userRowAlign);
+
+    NVCVTensorRequirements reqs;
+    if (!cache.lookup(key, reqs))
+    {
+        reqs = doCalcRequirements(dev, rank, shape, dtype, layout, userBaseAlign, userRowAlign);
+        cache.insert(key, reqs);
+    }
+    return reqs;
+}
+
+NVCVTensorRequirements Tensor::doCalcRequirements(int dev, int32_t rank, const int64_t *shape, const DataType &dtype,
+                                                  NVCVTensorLayout layout, int32_t userBaseAlign, int32_t userRowAlign)
 {
     NVCVTensorRequirements reqs;
 
@@ -115,9 +147,6 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
 
     reqs.mem = {};
 
-    int dev;
-    NVCV_CHECK_THROW(cudaGetDevice(&dev));
-
     // Calculate row pitch alignment
     int rowAlign;
     {
@@ -188,20 +217,49 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
     return reqs;
 }
 
-Tensor::Tensor(NVCVTensorRequirements reqs, IAllocator &alloc)
+Tensor::Tensor(NVCVTensorRequirements reqs, IAllocator &alloc, NVCVResourceType target)
     : m_alloc{alloc}
     , m_reqs{std::move(reqs)}
+    , m_target{target}
 {
-    // Assuming reqs are already validated during its creation
+    // Assuming reqs are already validated during its creation.
+    // The buffer layout doesn't depend on the target, only where it gets allocated.
 
     int64_t bufSize = CalcTotalSizeBytes(m_reqs.mem.cudaMem);
-    m_memBuffer     = m_alloc->allocCudaMem(bufSize, m_reqs.alignBytes);
+    switch (m_target)
+    {
+    case NVCV_RESOURCE_MEM_CUDA:
+        m_memBuffer = m_alloc->allocCudaMem(bufSize, m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST:
+        m_memBuffer = m_alloc->allocHostMem(bufSize, m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        m_memBuffer = m_alloc->allocHostPinnedMem(bufSize, m_reqs.alignBytes);
+        break;
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Unknown Resource type " << m_target;
+    }
     NVCV_ASSERT(m_memBuffer != nullptr);
 }
 
 Tensor::~Tensor()
 {
-    m_alloc->freeCudaMem(m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.cudaMem), m_reqs.alignBytes);
+    int64_t bufSize = CalcTotalSizeBytes(m_reqs.mem.cudaMem);
+    switch (m_target)
+    {
+    case NVCV_RESOURCE_MEM_CUDA:
+        m_alloc->freeCudaMem(m_memBuffer, bufSize, m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST:
+        m_alloc->freeHostMem(m_memBuffer, bufSize, m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        m_alloc->freeHostPinnedMem(m_memBuffer, bufSize, m_reqs.alignBytes);
+        break;
+    default:
+        break;
+    }
 }
 
 int32_t Tensor::rank() const
@@ -231,7 +289,8 @@ SharedCoreObj<IAllocator> Tensor::alloc() const
 
 void Tensor::exportData(NVCVTensorData &data) const
 {
-    data.bufferType = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+    data.bufferType
+        = m_target == NVCV_RESOURCE_MEM_CUDA ? NVCV_TENSOR_BUFFER_STRIDED_CUDA : NVCV_TENSOR_BUFFER_STRIDED_HOST;
 
     data.dtype  = m_reqs.dtype;
     data.layout = m_reqs.layout;
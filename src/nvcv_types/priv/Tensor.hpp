@@ -26,10 +26,12 @@
 
 namespace nvcv::priv {
 
+class TensorRequirementsCache;
+
 class Tensor final : public CoreObjectBase<ITensor>
 {
 public:
-    explicit Tensor(NVCVTensorRequirements reqs, IAllocator &alloc);
+    explicit Tensor(NVCVTensorRequirements reqs, IAllocator &alloc, NVCVResourceType target = NVCV_RESOURCE_MEM_CUDA);
     ~Tensor();
 
     static NVCVTensorRequirements CalcRequirements(int32_t numImages, Size2D imgSize, ImageFormat fmt,
@@ -37,6 +39,9 @@ public:
     static NVCVTensorRequirements CalcRequirements(int rank, const int64_t *shape, const DataType &dtype,
                                                    NVCVTensorLayout layout, int32_t baseAlign, int32_t rowAlign);
 
+    // Memoizes the results of CalcRequirements.
+    static TensorRequirementsCache &RequirementsCache();
+
     int32_t        rank() const override;
     const int64_t *shape() const override;
 
@@ -51,8 +56,12 @@ public:
 private:
     SharedCoreObj<IAllocator> m_alloc;
     NVCVTensorRequirements    m_reqs;
+    NVCVResourceType          m_target;
 
     void *m_memBuffer;
+
+    static NVCVTensorRequirements doCalcRequirements(int dev, int rank, const int64_t *shape, const DataType &dtype,
+                                                     NVCVTensorLayout layout, int32_t baseAlign, int32_t rowAlign);
 };
 
 } // namespace nvcv::priv
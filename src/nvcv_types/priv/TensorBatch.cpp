@@ -25,11 +25,14 @@
 
 namespace nvcv::priv {
 
+// Dirty ranges separated by up to this many clean elements are copied at once,
+// copying ~4kB more is cheaper than issuing another copy.
+static constexpr int32_t kDirtyMaxGap = 4096 / sizeof(TensorBatch::BatchElement);
+
 TensorBatch::TensorBatch(const NVCVTensorBatchRequirements &reqs, IAllocator &alloc)
     : m_alloc(alloc)
     , m_reqs(reqs)
-    , m_dirtyBegin(0)
-    , m_dirtyEnd(0)
+    , m_dirty(reqs.capacity, kDirtyMaxGap)
     , m_dtype(NVCV_DATA_TYPE_NONE)
     , m_layout(NVCV_TENSOR_LAYOUT_MAKE(""))
     , m_rank(-1)
@@ -111,32 +114,37 @@ void TensorBatch::cleanUp()
 
 void TensorBatch::exportData(CUstream stream, NVCVTensorBatchData &data)
 {
-    if (m_dirtyBegin < m_dirtyEnd)
+    if (!m_dirty.empty())
     {
         // Block until the previous call to exportData finishes the buffer copy.
         NVCV_CHECK_THROW(cudaEventSynchronize(m_evPostFence));
 
-        for (auto i = m_dirtyBegin; i < m_dirtyEnd; ++i)
-        {
-            auto          &t = ToStaticRef<ITensor>(m_Tensors[i]);
-            NVCVTensorData tdata;
-            t.exportData(tdata);
-            auto &element = m_pinnedTensorsBuffer[i];
-            element.data  = tdata.buffer.strided.basePtr;
-            for (int d = 0; d < tdata.rank; ++d)
+        m_dirty.forEachRange(
+            [this, stream](int32_t begin, int32_t end)
             {
-                element.shape[d]  = tdata.shape[d];
-                element.stride[d] = tdata.buffer.strided.strides[d];
-            }
-        }
-
-        int64_t copySize = (m_dirtyEnd - m_dirtyBegin) * sizeof(BatchElement);
-        NVCV_CHECK_THROW(cudaMemcpyAsync(m_devTensorsBuffer + m_dirtyBegin, m_pinnedTensorsBuffer + m_dirtyBegin,
-                                         copySize, cudaMemcpyHostToDevice, stream));
+                // Clean tensors in merged gaps are refreshed too, they're still valid.
+                for (auto i = begin; i < end; ++i)
+                {
+                    auto          &t = ToStaticRef<ITensor>(m_Tensors[i]);
+                    NVCVTensorData tdata;
+                    t.exportData(tdata);
+                    auto &element = m_pinnedTensorsBuffer[i];
+                    element.data  = tdata.buffer.strided.basePtr;
+                    for (int d = 0; d < tdata.rank; ++d)
+                    {
+                        element.shape[d]  = tdata.shape[d];
+                        element.stride[d] = tdata.buffer.strided.strides[d];
+                    }
+                }
+
+                int64_t copySize = (end - begin) * sizeof(BatchElement);
+                NVCV_CHECK_THROW(cudaMemcpyAsync(m_devTensorsBuffer + begin, m_pinnedTensorsBuffer + begin, copySize,
+                                                 cudaMemcpyHostToDevice, stream));
+            });
 
         // Signal the buffer copy is finished.
         NVCV_CHECK_THROW(cudaEventRecord(m_evPostFence, stream));
-        m_dirtyBegin = m_dirtyEnd;
+        m_dirty.clear();
     }
     NVCVTensorBatchBuffer buffer;
     buffer.strided  = NVCVTensorBatchBufferStrided{m_devTensorsBuffer};
@@ -198,6 +206,17 @@ void TensorBatch::pushTensors(const NVCVTensorHandle *tensors, int32_t numTensor
             << "Adding " << numTensors << " tensors to a tensor batch would exceed its capacity (" << capacity()
             << ") by " << m_numTensors + numTensors - capacity();
     }
+    // Checked before the batch properties are set from the first tensor, so they aren't left
+    // in an inconsistent state if it's rejected.
+    for (int32_t i = 0; i < numTensors; ++i)
+    {
+        NVCVTensorData tdata;
+        ToStaticRef<ITensor>(tensors[i]).exportData(tdata);
+        if (tdata.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Only cuda-accessible tensors can be added to a tensor batch.");
+        }
+    }
     setLayoutAndDType(tensors, numTensors);
     validateTensors(tensors, numTensors);
     for (int32_t i = 0; i < numTensors; ++i)
@@ -205,12 +224,8 @@ void TensorBatch::pushTensors(const NVCVTensorHandle *tensors, int32_t numTensor
         CoreObjectIncRef(tensors[i]);
         m_Tensors[m_numTensors + i] = tensors[i];
     }
-    if (m_dirtyEnd == m_dirtyBegin)
-    {
-        m_dirtyBegin = m_numTensors;
-    }
+    m_dirty.mark(m_numTensors, m_numTensors + numTensors);
     m_numTensors += numTensors;
-    m_dirtyEnd = m_numTensors;
 }
 
 void TensorBatch::popTensors(int32_t numTensors)
@@ -229,8 +244,7 @@ void TensorBatch::popTensors(int32_t numTensors)
         CoreObjectDecRef(m_Tensors[i]);
     }
     m_numTensors -= numTensors;
-    m_dirtyEnd   = std::min(m_dirtyEnd, m_numTensors);
-    m_dirtyBegin = std::min(m_dirtyBegin, m_dirtyEnd);
+    m_dirty.truncate(m_numTensors);
     if (m_numTensors == 0)
     {
         m_dtype  = NVCV_DATA_TYPE_NONE;
@@ -275,16 +289,7 @@ void TensorBatch::setTensors(int32_t index, const NVCVTensorHandle *tensors, int
         CoreObjectIncRef(tensors[idx]);
         m_Tensors[idx + index] = tensors[idx];
     }
-    if (m_dirtyBegin != m_dirtyEnd)
-    {
-        m_dirtyBegin = std::min(m_dirtyBegin, index);
-        m_dirtyEnd   = std::max(m_dirtyEnd, index + numTensors);
-    }
-    else
-    {
-        m_dirtyBegin = index;
-        m_dirtyEnd   = m_dirtyBegin + numTensors;
-    }
+    m_dirty.mark(index, index + numTensors);
 }
 
 SharedCoreObj<IAllocator> TensorBatch::alloc() const
@@ -328,9 +333,8 @@ void TensorBatch::clear()
     {
         CoreObjectDecRef(m_Tensors[i]);
     }
+    m_dirty.clear();
     m_numTensors = 0;
-    m_dirtyBegin = 0;
-    m_dirtyEnd   = 0;
     m_dtype      = NVCV_DATA_TYPE_NONE;
     m_layout     = NVCV_TENSOR_LAYOUT_MAKE("");
     m_rank       = -1;
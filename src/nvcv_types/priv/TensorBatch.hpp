@@ -19,6 +19,7 @@
 #define NVCV_CORE_PRIV_TENSORBATCH_HPP
 
 #include "DataType.hpp"
+#include "DirtyRangeSet.hpp"
 #include "IAllocator.hpp"
 #include "ITensorBatch.hpp"
 #include "SharedCoreObj.hpp"
@@ -70,17 +71,16 @@ private:
     SharedCoreObj<IAllocator>   m_alloc;
     NVCVTensorBatchRequirements m_reqs;
 
-    // Dirty begin and end describe a range containing all the tensors that have been modified
-    // since the previous exportData call and thus should be updated in the exported buffer.
-    int32_t m_dirtyBegin;
-    int32_t m_dirtyEnd;
+    // Tensors that have been modified since the previous exportData call
+    // and thus should be updated in the exported buffer.
+    DirtyRangeSet m_dirty;
 
     int32_t m_numTensors = 0;
 
     NVCVTensorHandle              *m_Tensors; // host buffer for tensor handles
     // Pinned buffer for the tensor data descriptors
     // It's updated every time the user updates the tensor batch.
-    // Changes are tracked with the m_dirty flags.
+    // Changes are tracked with m_dirty.
     NVCVTensorBatchElementStrided *m_pinnedTensorsBuffer;
     // Device buffer for the tensor data descriptors.
     // It's updated and returned when the exportData method is called.
@@ -23,6 +23,7 @@
 
 #include <nvcv/TensorLayout.h>
 
+#include <algorithm>
 #include <sstream>
 
 namespace nvcv::priv {
@@ -316,8 +317,9 @@ void ReshapeTensorData(NVCVTensorData &tensor_data, int new_rank, const int64_t
 
     // Check strides ------------
 
-    // right now is the only option supported
-    assert(tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA);
+    // right now strided buffers are the only option supported
+    assert(tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA
+           || tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST);
 
     // Collapses non-strided dimensions into groups
     // Example 1:
@@ -348,4 +350,69 @@ void ReshapeTensorData(NVCVTensorData &tensor_data, int new_rank, const int64_t
     for (int d = 0; d < tensor_data.rank; d++) tensor_data.shape[d] = new_shape[d];
 }
 
+void SliceTensorData(NVCVTensorData &tensor_data, int rank, const int64_t *begin, const int64_t *end,
+                     const int64_t *step)
+{
+    if (rank != tensor_data.rank)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+            << "Number of slice dimensions " << rank << " must be equal to the tensor rank " << tensor_data.rank;
+    }
+
+    if (begin == nullptr || end == nullptr)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Slice begin and end must not be NULL");
+    }
+
+    // right now strided buffers are the only option supported
+    assert(tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA
+           || tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST);
+
+    NVCVTensorBufferStrided &buffer = tensor_data.buffer.strided;
+
+    // Packed dimensions must stay packed, so they can only be sliced with unit step.
+    int firstPacked = IsChannelLast(tensor_data.layout) ? std::max(0, rank - 2) : rank - 1;
+
+    int64_t offset = 0;
+    int64_t new_shape[NVCV_TENSOR_MAX_RANK];
+
+    for (int d = 0; d < rank; ++d)
+    {
+        int64_t s = step ? step[d] : 1;
+
+        if (begin[d] < 0 || begin[d] >= end[d] || end[d] > tensor_data.shape[d])
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                << "Slice [" << begin[d] << ", " << end[d] << ") of dimension " << d
+                << " must be a non-empty range within [0, " << tensor_data.shape[d] << ")";
+        }
+
+        if (s < 1)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                << "Slice step of dimension " << d << " must be >= 1, not " << s;
+        }
+
+        new_shape[d] = (end[d] - begin[d] + s - 1) / s;
+
+        if (d >= firstPacked && s != 1 && new_shape[d] > 1)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                << "Dimension " << d << " is packed, it can't be sliced with step " << s;
+        }
+
+        offset += begin[d] * buffer.strides[d];
+    }
+
+    for (int d = 0; d < rank; ++d)
+    {
+        tensor_data.shape[d] = new_shape[d];
+        if (step)
+        {
+            buffer.strides[d] *= step[d];
+        }
+    }
+    buffer.basePtr += offset;
+}
+
 } // namespace nvcv::priv
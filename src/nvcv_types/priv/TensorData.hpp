@@ -33,6 +33,11 @@ void FillTensorData(IImage &img, NVCVTensorData &data);
 void ReshapeTensorData(NVCVTensorData &tensor_data, int new_rank, const int64_t *new_shape,
                        NVCVTensorLayout new_layout);
 
+// Restricts the tensor data to the elements [begin, end) of each dimension, taking every
+// step-th element. step can be NULL, meaning unit step for all dimensions.
+void SliceTensorData(NVCVTensorData &tensor_data, int rank, const int64_t *begin, const int64_t *end,
+                     const int64_t *step);
+
 } // namespace nvcv::priv
 
 #endif // NVCV_CORE_PRIV_TENSORDATA_HPP
@@ -0,0 +1,244 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TensorRequirementsCache.hpp"
+
+#include <util/Assert.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace nvcv::priv {
+
+namespace {
+
+template<int N>
+void ToWords(const void *src, size_t size, uint64_t (&words)[N]) noexcept
+{
+    NVCV_ASSERT(size <= sizeof(words));
+    std::memset(words, 0, sizeof(words));
+    std::memcpy(words, src, size);
+}
+
+uint64_t Hash(const uint64_t *words, int count) noexcept
+{
+    // FNV-1a, on 64-bit words
+    uint64_t h = 14695981039346656037ull;
+    for (int i = 0; i < count; ++i)
+    {
+        h = (h ^ words[i]) * 1099511628211ull;
+    }
+    return h ^ (h >> 32);
+}
+
+} // namespace
+
+auto TensorRequirementsCache::MakeKey(int32_t rank, const int64_t *shape, NVCVDataType dtype,
+                                      const NVCVTensorLayout &layout, int32_t device, int32_t baseAlign,
+                                      int32_t rowAlign) noexcept -> Key
+{
+    NVCV_ASSERT(0 <= rank && rank <= NVCV_TENSOR_MAX_RANK);
+
+    Key key;
+    std::memset(&key, 0, sizeof(key));
+
+    std::copy_n(shape, rank, key.shape);
+    key.dtype     = dtype;
+    key.rank      = rank;
+    key.device    = device;
+    key.baseAlign = baseAlign;
+    key.rowAlign  = rowAlign;
+    key.layout    = layout;
+
+    return key;
+}
+
+TensorRequirementsCache::TensorRequirementsCache()
+{
+    for (Slot &slot : m_slots)
+    {
+        slot.seq.store(0, std::memory_order_relaxed);
+        for (auto &w : slot.key)
+        {
+            w.store(0, std::memory_order_relaxed);
+        }
+        for (auto &w : slot.value)
+        {
+            w.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool TensorRequirementsCache::lookup(const Key &key, NVCVTensorRequirements &reqs) noexcept
+{
+    if (!m_enabled.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    uint64_t keyWords[kKeyWords];
+    ToWords(&key, sizeof(key), keyWords);
+
+    Slot &slot = m_slots[Hash(keyWords, kKeyWords) & (kNumSlots - 1)];
+
+    uint32_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq & 1)
+    {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool match = true;
+    for (int i = 0; i < kKeyWords && match; ++i)
+    {
+        match = slot.key[i].load(std::memory_order_relaxed) == keyWords[i];
+    }
+
+    uint64_t valueWords[kValueWords];
+    if (match)
+    {
+        for (int i = 0; i < kValueWords; ++i)
+        {
+            valueWords[i] = slot.value[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    // Make sure the slot wasn't modified while we were reading it.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!match || slot.seq.load(std::memory_order_relaxed) != seq)
+    {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Value value;
+    std::memcpy(&value, valueWords, sizeof(value));
+
+    reqs.dtype      = key.dtype;
+    reqs.layout     = key.layout;
+    reqs.rank       = key.rank;
+    reqs.alignBytes = value.alignBytes;
+    std::copy_n(key.shape, key.rank, reqs.shape);
+    std::copy_n(value.strides, key.rank, reqs.strides);
+    reqs.mem                                        = {};
+    reqs.mem.cudaMem.numBlocks[value.log2BlockSize] = value.numBlocks;
+
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void TensorRequirementsCache::insert(const Key &key, const NVCVTensorRequirements &reqs) noexcept
+{
+    if (!m_enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    uint64_t keyWords[kKeyWords];
+    ToWords(&key, sizeof(key), keyWords);
+
+    Value value;
+    std::memset(&value, 0, sizeof(value));
+    std::copy_n(reqs.strides, reqs.rank, value.strides);
+    value.alignBytes = reqs.alignBytes;
+
+    for (int i = 0; i < NVCV_MAX_MEM_REQUIREMENTS_LOG2_BLOCK_SIZE; ++i)
+    {
+        if (reqs.mem.cudaMem.numBlocks[i] != 0)
+        {
+            if (value.numBlocks != 0)
+            {
+                return;
+            }
+            value.log2BlockSize = i;
+            value.numBlocks     = reqs.mem.cudaMem.numBlocks[i];
+        }
+    }
+
+    uint64_t valueWords[kValueWords];
+    ToWords(&value, sizeof(value), valueWords);
+
+    Slot &slot = m_slots[Hash(keyWords, kKeyWords) & (kNumSlots - 1)];
+
+    // Acquire the slot. If somebody else is writing to it, give up,
+    // the entry will be inserted next time.
+    uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+    if ((seq & 1) || !slot.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_relaxed))
+    {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (int i = 0; i < kKeyWords; ++i)
+    {
+        slot.key[i].store(keyWords[i], std::memory_order_relaxed);
+    }
+    for (int i = 0; i < kValueWords; ++i)
+    {
+        slot.value[i].store(valueWords[i], std::memory_order_relaxed);
+    }
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+}
+
+void TensorRequirementsCache::clear() noexcept
+{
+    for (Slot &slot : m_slots)
+    {
+        uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+        if ((seq & 1) || !slot.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_relaxed))
+        {
+            // Being written to, it'll be overwritten anyway.
+            continue;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        // A zero key can't match any real key, its rank is 0.
+        for (auto &w : slot.key)
+        {
+            w.store(0, std::memory_order_relaxed);
+        }
+
+        slot.seq.store(seq + 2, std::memory_order_release);
+    }
+}
+
+void TensorRequirementsCache::setEnabled(bool enabled) noexcept
+{
+    m_enabled.store(enabled, std::memory_order_relaxed);
+    if (!enabled)
+    {
+        this->clear();
+    }
+}
+
+bool TensorRequirementsCache::enabled() const noexcept
+{
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+int64_t TensorRequirementsCache::hits() const noexcept
+{
+    return m_hits.load(std::memory_order_relaxed);
+}
+
+int64_t TensorRequirementsCache::misses() const noexcept
+{
+    return m_misses.load(std::memory_order_relaxed);
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_TENSOR_REQUIREMENTS_CACHE_HPP
+#define NVCV_CORE_PRIV_TENSOR_REQUIREMENTS_CACHE_HPP
+
+#include <nvcv/Tensor.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace nvcv::priv {
+
+/** A fixed-size, lock-free memoization table for tensor requirements.
+ *
+ * It's direct-mapped: each key hashes to one slot, and a new entry simply replaces
+ * whatever was there. Each slot is guarded by a sequence lock. Readers never wait,
+ * a lookup that races with an update of the same slot is counted as a miss. Writers
+ * never wait either, an insertion into a slot being updated by another thread is dropped.
+ */
+class TensorRequirementsCache
+{
+public:
+    static constexpr int kNumSlots = 64; // must be a power of two
+
+    struct Key
+    {
+        int64_t          shape[NVCV_TENSOR_MAX_RANK];
+        NVCVDataType     dtype;
+        NVCVTensorLayout layout;
+        int32_t          rank;
+        int32_t          device;
+        int32_t          baseAlign;
+        int32_t          rowAlign;
+    };
+
+    // Fills in the key, making sure its padding bytes are zeroed
+    // so that keys can be compared bitwise.
+    static Key MakeKey(int32_t rank, const int64_t *shape, NVCVDataType dtype, const NVCVTensorLayout &layout,
+                       int32_t device, int32_t baseAlign, int32_t rowAlign) noexcept;
+
+    TensorRequirementsCache();
+
+    // Returns true and fills reqs in if key was found.
+    bool lookup(const Key &key, NVCVTensorRequirements &reqs) noexcept;
+
+    // reqs must have been calculated from key. Requirements with more
+    // than one kind of cuda memory block aren't cached.
+    void insert(const Key &key, const NVCVTensorRequirements &reqs) noexcept;
+
+    void clear() noexcept;
+
+    void setEnabled(bool enabled) noexcept;
+    bool enabled() const noexcept;
+
+    int64_t hits() const noexcept;
+    int64_t misses() const noexcept;
+
+private:
+    static constexpr int kKeyWords = (sizeof(Key) + 7) / 8;
+
+    // Only the parts of the requirements that aren't derived trivially from the key are stored.
+    // Tensors are allocated as one buffer, so only one entry of cudaMem.numBlocks is non-zero.
+    struct Value
+    {
+        int64_t strides[NVCV_TENSOR_MAX_RANK];
+        int64_t numBlocks;
+        int32_t log2BlockSize;
+        int32_t alignBytes;
+    };
+
+    static constexpr int kValueWords = (sizeof(Value) + 7) / 8;
+
+    struct alignas(64) Slot
+    {
+        // Odd while the slot is being written to.
+        std::atomic<uint32_t> seq;
+        std::atomic<uint64_t> key[kKeyWords];
+        std::atomic<uint64_t> value[kValueWords];
+    };
+
+    Slot m_slots[kNumSlots];
+
+    std::atomic<bool> m_enabled = true;
+
+    alignas(64) std::atomic<int64_t> m_hits = 0;
+    alignas(64) std::atomic<int64_t> m_misses = 0;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_TENSOR_REQUIREMENTS_CACHE_HPP
@@ -32,10 +32,22 @@
 
 namespace nvcv::priv {
 
-static void ValidateTensorBufferStrided(const NVCVTensorData &tdata)
+// Validates the properties that can be shared by several tensors.
+static void ValidateTensorProperties(const NVCVTensorData &tdata)
 {
-    NVCV_ASSERT(tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA);
+    if (tdata.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA && tdata.bufferType != NVCV_TENSOR_BUFFER_STRIDED_HOST)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Tensor buffer type must be strided, either cuda or host";
+    }
+
+    if (tdata.rank <= 0)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of dimensions must be >= 1, not %d", tdata.rank);
+    }
+}
 
+static void ValidateTensorBufferStrided(const NVCVTensorData &tdata)
+{
     const NVCVTensorBufferStrided &buffer = tdata.buffer.strided;
 
     if (buffer.basePtr == nullptr)
@@ -45,11 +57,6 @@ static void ValidateTensorBufferStrided(const NVCVTensorData &tdata)
 
     int rank = tdata.rank;
 
-    if (rank <= 0)
-    {
-        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of dimensions must be >= 1, not %d", rank);
-    }
-
     for (int i = 0; i < rank; ++i)
     {
         if (tdata.shape[i] < 1)
@@ -104,13 +111,49 @@ static void ValidateTensorBufferStrided(const NVCVTensorData &tdata)
     }
 }
 
+void TensorWrapDataStrided::ValidateMany(int32_t count, const NVCVTensorData *tdata)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    ValidateTensorProperties(tdata[0]);
+
+    for (int32_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            if (tdata[i].bufferType != tdata[0].bufferType || tdata[i].rank != tdata[0].rank
+                || tdata[i].dtype != tdata[0].dtype || tdata[i].layout != tdata[0].layout)
+            {
+                throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
+                    << "Tensor #" << i << " must have the same buffer type, rank, data type and layout as tensor #0";
+            }
+        }
+
+        try
+        {
+            ValidateTensorBufferStrided(tdata[i]);
+        }
+        catch (Exception &e)
+        {
+            throw Exception(e.code()) << "Tensor #" << i << ": " << e.msg();
+        }
+    }
+}
+
 TensorWrapDataStrided::TensorWrapDataStrided(const NVCVTensorData &tdata, NVCVTensorDataCleanupFunc cleanup,
-                                             void *ctxCleanup)
+                                             void *ctxCleanup, bool validate)
     : m_tdata(tdata)
     , m_cleanup(cleanup)
     , m_ctxCleanup(ctxCleanup)
 {
-    ValidateTensorBufferStrided(tdata);
+    if (validate)
+    {
+        ValidateTensorProperties(tdata);
+        ValidateTensorBufferStrided(tdata);
+    }
 }
 
 TensorWrapDataStrided::~TensorWrapDataStrided()
@@ -27,7 +27,9 @@ namespace nvcv::priv {
 class TensorWrapDataStrided final : public CoreObjectBase<ITensor>
 {
 public:
-    explicit TensorWrapDataStrided(const NVCVTensorData &tdata, NVCVTensorDataCleanupFunc cleanup, void *ctxCleanup);
+    // validate can be false if tdata was already validated by ValidateMany.
+    explicit TensorWrapDataStrided(const NVCVTensorData &tdata, NVCVTensorDataCleanupFunc cleanup, void *ctxCleanup,
+                                   bool validate = true);
     ~TensorWrapDataStrided();
 
     int32_t        rank() const override;
@@ -41,6 +43,10 @@ public:
 
     void exportData(NVCVTensorData &tdata) const override;
 
+    // Validates the data of several tensors to be wrapped.
+    // They must all have the same buffer type, rank, dtype and layout.
+    static void ValidateMany(int32_t count, const NVCVTensorData *tdata);
+
 private:
     NVCVTensorData m_tdata;
 
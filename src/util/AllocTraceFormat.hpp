@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_UTIL_ALLOC_TRACE_FORMAT_HPP
+#define NVCV_UTIL_ALLOC_TRACE_FORMAT_HPP
+
+#include <cstdint>
+
+namespace nvcv::util {
+
+/** Header of an allocation trace file.
+ *
+ * The file starts with this header, followed by a sequence of @ref AllocTraceRecord,
+ * in the order the events happened. All fields are stored in native byte order.
+ */
+struct AllocTraceHeader
+{
+    static constexpr char     MAGIC[8] = {'N', 'V', 'C', 'V', 'A', 'T', 'R', 'C'};
+    static constexpr uint32_t VERSION  = 1;
+
+    char     magic[8];
+    uint32_t version;
+    uint32_t recordSize; // sizeof(AllocTraceRecord)
+    int64_t  startTime;  // when the trace started, in ns since the epoch
+};
+
+static_assert(sizeof(AllocTraceHeader) == 24, "The file header must not have implicit padding");
+
+enum class AllocTraceOp : uint8_t
+{
+    ALLOC = 0,
+    FREE  = 1
+};
+
+/** One allocation or deallocation event. */
+struct AllocTraceRecord
+{
+    uint64_t     time;    // ns since the trace started
+    uint64_t     ptr;     // address of the buffer
+    int64_t      size;    // in bytes
+    int32_t      align;   // in bytes
+    uint16_t     thread;  // sequential id of the thread that did the operation
+    AllocTraceOp op;      // allocation or free
+    uint8_t      resType; // NVCVResourceType
+};
+
+static_assert(sizeof(AllocTraceRecord) == 32, "The trace records must not have implicit padding");
+
+} // namespace nvcv::util
+
+#endif // NVCV_UTIL_ALLOC_TRACE_FORMAT_HPP
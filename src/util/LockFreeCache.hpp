@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_UTIL_LOCK_FREE_CACHE_HPP
+#define NVCV_UTIL_LOCK_FREE_CACHE_HPP
+
+#include <nvcv_types/priv/LockFreeStack.hpp>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace nvcv::util {
+
+/** A cache that stores objects of type T, without locking on `get` and `put`.
+ *
+ * It has the same interface and LIFO order as `SimpleCache`, but the objects are kept in
+ * intrusive nodes linked in a lock-free stack. Nodes whose object was taken out are kept
+ * in a second lock-free stack for reuse.
+ *
+ * Nodes are allocated in blocks and are only freed when the cache is destroyed, so that a
+ * node being popped by one thread is never deallocated by another. A mutex is taken only
+ * when a new block of nodes is needed.
+ *
+ * @tparam T The type of items held in the cache
+ */
+template<typename T>
+class LockFreeCache
+{
+public:
+    LockFreeCache()                      = default;
+    LockFreeCache(const LockFreeCache &) = delete;
+    LockFreeCache &operator=(const LockFreeCache &) = delete;
+
+    std::optional<T> get()
+    {
+        Node *node = m_items.pop();
+        if (!node)
+            return std::nullopt;
+
+        std::optional<T> obj = std::move(node->payload);
+        node->payload.reset();
+        m_empty.push(node);
+        return obj;
+    }
+
+    template<typename CreateFunc>
+    T getOrCreate(CreateFunc &&create)
+    {
+        auto cached = get();
+        if (cached.has_value())
+            return std::move(cached).value();
+        else
+            return create();
+    }
+
+    void put(T &&payload)
+    {
+        emplace(std::move(payload));
+    }
+
+    template<typename... Args>
+    void emplace(Args &&...args)
+    {
+        Node *node = m_empty.pop();
+        if (!node)
+            node = allocateNodes();
+
+        try
+        {
+            node->payload.emplace(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_empty.push(node);
+            throw;
+        }
+
+        m_items.push(node);
+    }
+
+    /** Destroys the cached objects.
+     *
+     * The nodes are kept for reuse.
+     */
+    void purge()
+    {
+        while (Node *node = m_items.pop())
+        {
+            node->payload.reset();
+            m_empty.push(node);
+        }
+    }
+
+private:
+    struct Node
+    {
+        Node            *next = nullptr;
+        std::optional<T> payload;
+    };
+
+    static constexpr int kBlockSize = 64;
+
+    // Allocates a block of nodes, returns one of them and puts the others in the empty stack.
+    Node *allocateNodes()
+    {
+        std::unique_ptr<Node[]> block(new Node[kBlockSize]);
+        Node                   *nodes = block.get();
+
+        {
+            std::lock_guard lg(m_blocksLock);
+            m_blocks.push_back(std::move(block));
+        }
+
+        for (int i = 1; i < kBlockSize - 1; ++i)
+        {
+            nodes[i].next = &nodes[i + 1];
+        }
+        m_empty.pushStack(&nodes[1], &nodes[kBlockSize - 1]);
+
+        return &nodes[0];
+    }
+
+    priv::LockFreeStack<Node> m_items, m_empty;
+
+    std::mutex                           m_blocksLock;
+    std::vector<std::unique_ptr<Node[]>> m_blocks;
+};
+
+} // namespace nvcv::util
+
+#endif // NVCV_UTIL_LOCK_FREE_CACHE_HPP
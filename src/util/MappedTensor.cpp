@@ -0,0 +1,483 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MappedTensor.hpp"
+
+#include "CheckError.hpp"
+
+#include <cuda_runtime_api.h>
+#include <fcntl.h>
+#include <nvcv/TensorDataAccess.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace nvcv::util {
+
+namespace {
+
+constexpr int64_t kDefaultAlignment = 4096;
+
+// Size of the staging buffer used to copy tensors in cuda memory and to batch small writes.
+constexpr int64_t kStagingSize = 4 << 20;
+
+int64_t PageSize()
+{
+    static const int64_t size = sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+[[noreturn]] void ThrowSystemError(const char *what, const std::string &path, int err = errno)
+{
+    throw Exception(Status::ERROR_INTERNAL, "%s '%s' failed: %s", what, path.c_str(), std::strerror(err));
+}
+
+int ToMadvise(MappedTensor::Advice advice)
+{
+    switch (advice)
+    {
+    case MappedTensor::Advice::NORMAL:
+        return MADV_NORMAL;
+    case MappedTensor::Advice::SEQUENTIAL:
+        return MADV_SEQUENTIAL;
+    case MappedTensor::Advice::RANDOM:
+        return MADV_RANDOM;
+    case MappedTensor::Advice::WILLNEED:
+        return MADV_WILLNEED;
+    case MappedTensor::Advice::DONTNEED:
+        return MADV_DONTNEED;
+    }
+    throw Exception(Status::ERROR_INVALID_ARGUMENT, "Invalid access advice %d", static_cast<int>(advice));
+}
+
+// Writes the tensor contents packed, in runs of contiguous bytes.
+class PackedWriter
+{
+public:
+    PackedWriter(FILE *f, const std::string &path)
+        : m_file(f)
+        , m_path(path)
+    {
+        m_staging.reserve(kStagingSize);
+    }
+
+    void write(const Byte *src, int64_t size, bool fromCuda)
+    {
+        while (size > 0)
+        {
+            if (!fromCuda && m_staging.empty() && size >= kStagingSize)
+            {
+                // Large host runs go straight to the file
+                writeFile(src, size);
+                return;
+            }
+
+            int64_t chunk = std::min<int64_t>(size, kStagingSize - m_staging.size());
+            size_t  pos   = m_staging.size();
+            m_staging.resize(pos + chunk);
+            if (fromCuda)
+            {
+                NVCV_CHECK_THROW(cudaMemcpy(m_staging.data() + pos, src, chunk, cudaMemcpyDeviceToHost));
+            }
+            else
+            {
+                std::memcpy(m_staging.data() + pos, src, chunk);
+            }
+            if (static_cast<int64_t>(m_staging.size()) == kStagingSize)
+            {
+                flush();
+            }
+            src += chunk;
+            size -= chunk;
+        }
+    }
+
+    void flush()
+    {
+        writeFile(m_staging.data(), m_staging.size());
+        m_staging.clear();
+    }
+
+private:
+    FILE             *m_file;
+    const std::string m_path;
+    std::vector<Byte> m_staging;
+
+    void writeFile(const void *data, size_t size)
+    {
+        if (size > 0 && fwrite(data, 1, size, m_file) != size)
+        {
+            ThrowSystemError("Writing to", m_path);
+        }
+    }
+};
+
+} // namespace
+
+// Mapping ---------------------------------------
+
+class MappedTensor::Mapping
+{
+public:
+    explicit Mapping(const std::string &path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            ThrowSystemError("Opening", path);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            int err = errno;
+            ::close(fd);
+            ThrowSystemError("Querying", path, err);
+        }
+        m_size = st.st_size;
+
+        if (m_size < static_cast<int64_t>(sizeof(MappedTensorHeader)))
+        {
+            ::close(fd);
+            throw Exception(Status::ERROR_INVALID_ARGUMENT, "File '%s' is too small to be a tensor file",
+                            path.c_str());
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        m_base  = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        int err = errno;
+        ::close(fd);
+        if (m_base == MAP_FAILED)
+        {
+            ThrowSystemError("Mapping", path, err);
+        }
+
+        try
+        {
+            m_data = parse(path);
+        }
+        catch (...)
+        {
+            munmap(m_base, m_size);
+            throw;
+        }
+    }
+
+    ~Mapping()
+    {
+        munmap(m_base, m_size);
+    }
+
+    Mapping(const Mapping &)            = delete;
+    Mapping &operator=(const Mapping &) = delete;
+
+    const TensorDataStridedHost &data() const
+    {
+        return *m_data;
+    }
+
+    void advise(int advice, const Byte *begin, int64_t size)
+    {
+        // madvise needs a page-aligned address, extend the range to the beginning of the page.
+        uintptr_t addr    = reinterpret_cast<uintptr_t>(begin);
+        uintptr_t aligned = addr & ~static_cast<uintptr_t>(PageSize() - 1);
+        size += addr - aligned;
+
+        if (size > 0 && madvise(reinterpret_cast<void *>(aligned), size, advice) != 0)
+        {
+            int err = errno;
+            throw Exception(Status::ERROR_INTERNAL, "madvise failed: %s", std::strerror(err));
+        }
+    }
+
+private:
+    void   *m_base = nullptr;
+    int64_t m_size = 0;
+
+    Optional<TensorDataStridedHost> m_data;
+
+    TensorDataStridedHost parse(const std::string &path) const
+    {
+        MappedTensorHeader hdr;
+        std::memcpy(&hdr, m_base, sizeof(hdr));
+
+        auto fail = [&path](const char *reason)
+        {
+            return Exception(Status::ERROR_INVALID_ARGUMENT, "File '%s' isn't a valid tensor file: %s",
+                             path.c_str(), reason);
+        };
+
+        if (std::memcmp(hdr.magic, MappedTensorHeader::MAGIC, sizeof(hdr.magic)) != 0)
+        {
+            throw fail("bad magic number");
+        }
+        if (hdr.version != MappedTensorHeader::VERSION)
+        {
+            throw fail("unsupported version");
+        }
+        if (hdr.rank < 1 || hdr.rank > NVCV_TENSOR_MAX_RANK)
+        {
+            throw fail("invalid rank");
+        }
+        if (hdr.alignment <= 0 || (hdr.alignment & (hdr.alignment - 1)) != 0 || hdr.dataOffset % hdr.alignment != 0)
+        {
+            throw fail("invalid alignment");
+        }
+        if (hdr.dataOffset < static_cast<int64_t>(sizeof(hdr)) || hdr.dataSize < 0
+            || hdr.dataSize > m_size - hdr.dataOffset)
+        {
+            throw fail("contents out of bounds");
+        }
+        if (hdr.layout[NVCV_TENSOR_MAX_RANK] != '\0')
+        {
+            throw fail("invalid layout");
+        }
+
+        DataType dtype(static_cast<NVCVDataType>(hdr.dtype));
+        int64_t  elemSize = dtype.strideBytes();
+
+        // Offset past the last byte addressed by the tensor
+        int64_t end = elemSize;
+        for (int i = 0; i < hdr.rank; ++i)
+        {
+            if (hdr.shape[i] < 1 || hdr.strides[i] < 0)
+            {
+                throw fail("invalid shape or strides");
+            }
+
+            // Crafted headers must not be able to wrap around and pass the bounds check
+            int64_t extent;
+            if (__builtin_mul_overflow(hdr.shape[i] - 1, hdr.strides[i], &extent)
+                || __builtin_add_overflow(end, extent, &end))
+            {
+                throw fail("contents out of bounds");
+            }
+        }
+        if (end > hdr.dataSize)
+        {
+            throw fail("contents out of bounds");
+        }
+
+        TensorLayout layout = hdr.layout[0] == '\0' ? TENSOR_NONE : TensorLayout(hdr.layout);
+        if (layout != TENSOR_NONE && layout.rank() != hdr.rank)
+        {
+            throw fail("layout doesn't match the rank");
+        }
+
+        TensorDataStridedHost::Buffer buf;
+        std::copy(hdr.strides, hdr.strides + hdr.rank, buf.strides);
+        buf.basePtr = reinterpret_cast<NVCVByte *>(static_cast<Byte *>(m_base) + hdr.dataOffset);
+
+        return TensorDataStridedHost(TensorShape(hdr.shape, hdr.rank, layout), dtype, buf);
+    }
+};
+
+// MappedTensor ---------------------------------------
+
+MappedTensor::MappedTensor(const std::string &path)
+    : m_mapping(std::make_shared<Mapping>(path))
+{
+}
+
+const TensorDataStridedHost &MappedTensor::data() const
+{
+    return m_mapping->data();
+}
+
+int64_t MappedTensor::numSamples() const
+{
+    return data().shape(0);
+}
+
+Tensor MappedTensor::tensor() const
+{
+    // The cleanup callback holds a reference to the mapping until the tensor is destroyed
+    std::shared_ptr<Mapping> mapping = m_mapping;
+    return TensorWrapData(data(), [mapping](const TensorData &) mutable { mapping.reset(); });
+}
+
+ImageDataStridedHost MappedTensor::imageData(ImageFormat fmt, int64_t sample) const
+{
+    auto access = TensorDataAccessStridedImagePlanar::Create(data());
+    if (!access)
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Mapped tensor with layout '%s' isn't an image tensor",
+                        data().layout().begin());
+    }
+    if (sample < 0 || sample >= access->numSamples())
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Sample %ld out of range [0, %ld)", sample,
+                        static_cast<long>(access->numSamples()));
+    }
+    if (fmt.numPlanes() != access->numPlanes() || fmt.numChannels() != access->numChannels())
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT,
+                        "Image format with %d planes and %d channels doesn't match the tensor's %d planes and %d "
+                        "channels",
+                        fmt.numPlanes(), fmt.numChannels(), access->numPlanes(), access->numChannels());
+    }
+    if (access->rowStride() > INT32_MAX)
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Row stride %ld is too large for an image",
+                        static_cast<long>(access->rowStride()));
+    }
+
+    Byte *base = access->sampleData(sample);
+
+    ImageDataStridedHost::Buffer buf;
+    buf.numPlanes = access->numPlanes();
+    for (int p = 0; p < buf.numPlanes; ++p)
+    {
+        buf.planes[p].width     = access->numCols();
+        buf.planes[p].height    = access->numRows();
+        buf.planes[p].rowStride = access->rowStride();
+        buf.planes[p].basePtr   = reinterpret_cast<NVCVByte *>(access->planeData(p, base));
+    }
+    return ImageDataStridedHost(fmt, buf);
+}
+
+void MappedTensor::advise(Advice advice)
+{
+    const TensorDataStridedHost &d = data();
+    m_mapping->advise(ToMadvise(advice), d.basePtr(), d.shape(0) * d.stride(0));
+}
+
+void MappedTensor::advise(Advice advice, int64_t firstSample, int64_t numSamples)
+{
+    const TensorDataStridedHost &d = data();
+
+    firstSample = std::clamp<int64_t>(firstSample, 0, d.shape(0));
+    numSamples  = std::clamp<int64_t>(numSamples, 0, d.shape(0) - firstSample);
+
+    m_mapping->advise(ToMadvise(advice), d.basePtr() + firstSample * d.stride(0), numSamples * d.stride(0));
+}
+
+void MappedTensor::prefetch(int64_t firstSample, int64_t numSamples)
+{
+    advise(Advice::WILLNEED, firstSample, numSamples);
+}
+
+// Writer ---------------------------------------
+
+void WriteMappedTensor(const std::string &path, const TensorDataStrided &data, int64_t alignment)
+{
+    if (alignment == 0)
+    {
+        alignment = kDefaultAlignment;
+    }
+    if (alignment < 0 || (alignment & (alignment - 1)) != 0)
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Alignment must be a power of two, not %ld",
+                        static_cast<long>(alignment));
+    }
+
+    const bool fromCuda = data.cdata().bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+
+    const int     rank     = data.rank();
+    const int64_t elemSize = data.dtype().strideBytes();
+
+    MappedTensorHeader hdr = {};
+    std::memcpy(hdr.magic, MappedTensorHeader::MAGIC, sizeof(hdr.magic));
+    hdr.version = MappedTensorHeader::VERSION;
+    hdr.rank    = rank;
+    hdr.dtype   = static_cast<NVCVDataType>(data.dtype());
+    if (data.layout() != TENSOR_NONE)
+    {
+        std::copy(data.layout().begin(), data.layout().end(), hdr.layout);
+    }
+
+    // The contents are stored packed
+    int64_t stride = elemSize;
+    for (int i = rank - 1; i >= 0; --i)
+    {
+        hdr.shape[i]   = data.shape(i);
+        hdr.strides[i] = stride;
+        stride *= data.shape(i);
+    }
+    hdr.alignment  = alignment;
+    hdr.dataOffset = (sizeof(hdr) + alignment - 1) / alignment * alignment;
+    hdr.dataSize   = stride;
+
+    // Innermost dimensions that are already packed in the source are copied in one run
+    int     firstInRun = rank;
+    int64_t runSize    = elemSize;
+    while (firstInRun > 0 && data.stride(firstInRun - 1) == runSize)
+    {
+        --firstInRun;
+        runSize *= data.shape(firstInRun);
+    }
+
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f)
+    {
+        ThrowSystemError("Creating", path);
+    }
+
+    try
+    {
+        PackedWriter writer(f, path);
+
+        std::vector<Byte> head(hdr.dataOffset, Byte{0});
+        std::memcpy(head.data(), &hdr, sizeof(hdr));
+        writer.write(head.data(), head.size(), false);
+
+        // Iterate over the coordinates of the dimensions outside the run
+        int64_t coord[NVCV_TENSOR_MAX_RANK] = {};
+        while (true)
+        {
+            const Byte *src = data.basePtr();
+            for (int i = 0; i < firstInRun; ++i)
+            {
+                src += coord[i] * data.stride(i);
+            }
+            writer.write(src, runSize, fromCuda);
+
+            int i = firstInRun - 1;
+            for (; i >= 0; --i)
+            {
+                if (++coord[i] < data.shape(i))
+                {
+                    break;
+                }
+                coord[i] = 0;
+            }
+            if (i < 0)
+            {
+                break;
+            }
+        }
+        writer.flush();
+    }
+    catch (...)
+    {
+        fclose(f);
+        throw;
+    }
+
+    if (fclose(f) != 0)
+    {
+        ThrowSystemError("Closing", path);
+    }
+}
+
+} // namespace nvcv::util
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_UTIL_MAPPED_TENSOR_HPP
+#define NVCV_UTIL_MAPPED_TENSOR_HPP
+
+#include <nvcv/ImageData.hpp>
+#include <nvcv/ImageFormat.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/TensorData.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace nvcv::util {
+
+/** Header of a mapped tensor file.
+ *
+ * The file starts with this header, followed by padding up to `dataOffset`, where the tensor
+ * contents start. `dataOffset` is a multiple of `alignment`, so that the mapped contents
+ * keep the alignment they were written with. All fields are stored in native byte order.
+ */
+struct MappedTensorHeader
+{
+    static constexpr char     MAGIC[8] = {'N', 'V', 'C', 'V', 'T', 'E', 'N', 'S'};
+    static constexpr uint32_t VERSION  = 1;
+
+    char     magic[8];
+    uint32_t version;
+    int32_t  rank;
+    uint64_t dtype;                            // NVCVDataType
+    char     layout[NVCV_TENSOR_MAX_RANK + 1]; // '\0'-terminated, empty if no layout
+    int64_t  shape[NVCV_TENSOR_MAX_RANK];
+    int64_t  strides[NVCV_TENSOR_MAX_RANK]; // in bytes
+    int64_t  alignment;
+    int64_t  dataOffset; // from the beginning of the file
+    int64_t  dataSize;   // in bytes
+};
+
+static_assert(sizeof(MappedTensorHeader) == 24 + (NVCV_TENSOR_MAX_RANK + 1) + NVCV_TENSOR_MAX_RANK * 8 * 2 + 3 * 8,
+              "The file header must not have implicit padding");
+
+/** Writes tensor contents to a file that can later be mapped with @ref MappedTensor.
+ *
+ * The contents are stored packed, regardless of the strides of \p data. Tensors in cuda
+ * memory are copied to the host in chunks.
+ *
+ * @param path      Path of the file to be written, it's truncated if it exists.
+ * @param data      Contents to be written, either in host or in cuda memory.
+ * @param alignment Alignment in bytes of the contents in the file, must be a power of two.
+ *                  The contents are page-aligned if it's 0.
+ *
+ * @throw nvcv::Exception on invalid arguments or I/O errors.
+ */
+void WriteMappedTensor(const std::string &path, const TensorDataStrided &data, int64_t alignment = 0);
+
+/** A read-only tensor file mapped into host memory.
+ *
+ * The file is mapped with `mmap`, so its contents are paged in on demand and share the system page
+ * cache with other processes reading the same file. The contents can be exposed as a host tensor or
+ * as image data without copies.
+ *
+ * The mapping is kept alive as long as the object or any tensor returned by @ref tensor exists.
+ * Writing to the mapped contents is an error, the memory is mapped read-only.
+ *
+ * Example:
+ * @code{.cpp}
+ *   nvcv::util::MappedTensor file("frames.nvt");
+ *   file.advise(nvcv::util::MappedTensor::Advice::SEQUENTIAL);
+ *   for (int64_t i = 0; i < file.numSamples(); ++i)
+ *   {
+ *       file.prefetch(i + 1, 1);
+ *       nvcv::ImageDataStridedHost frame = file.imageData(nvcv::FMT_RGB8, i);
+ *       ...
+ *   }
+ * @endcode
+ */
+class MappedTensor
+{
+public:
+    /** Access pattern hints, passed to `madvise`. */
+    enum class Advice
+    {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILLNEED,
+        DONTNEED
+    };
+
+    /** Maps the given file.
+     *
+     * @throw nvcv::Exception if the file can't be mapped or isn't a valid tensor file.
+     */
+    explicit MappedTensor(const std::string &path);
+
+    const TensorDataStridedHost &data() const;
+
+    /** Number of samples, i.e. the extent of the outermost dimension. */
+    int64_t numSamples() const;
+
+    /** Wraps the mapped contents into a tensor.
+     *
+     * The tensor keeps the mapping alive, it can outlive this object.
+     */
+    Tensor tensor() const;
+
+    /** Returns the data of one sample of an image tensor.
+     *
+     * @param fmt    Format of the image, must match the tensor's channels and planes.
+     * @param sample Index of the sample.
+     *
+     * @throw nvcv::Exception with ERROR_INVALID_ARGUMENT if the tensor isn't an image tensor
+     *        compatible with \p fmt, or the sample is out of range.
+     */
+    ImageDataStridedHost imageData(ImageFormat fmt, int64_t sample = 0) const;
+
+    /** Gives the system a hint on how the whole contents will be accessed. */
+    void advise(Advice advice);
+
+    /** Gives the system a hint on how a range of samples will be accessed. */
+    void advise(Advice advice, int64_t firstSample, int64_t numSamples);
+
+    /** Asks the system to start reading the given samples in the background. */
+    void prefetch(int64_t firstSample, int64_t numSamples);
+
+private:
+    class Mapping;
+
+    std::shared_ptr<Mapping> m_mapping;
+};
+
+} // namespace nvcv::util
+
+#endif // NVCV_UTIL_MAPPED_TENSOR_HPP
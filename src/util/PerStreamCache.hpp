@@ -20,18 +20,19 @@
 
 #include "CheckError.hpp"
 #include "Event.hpp"
-#include "SimpleCache.hpp"
+#include "LockFreeCache.hpp"
 #include "StreamId.hpp"
 
 #include <cassert>
-#include <map>
+#include <cstdint>
 #include <mutex>
 #include <set>
 #include <unordered_map>
 
 namespace nvcv::util {
 
-class EventCache : public nvcv::util::SimpleCache<CudaEvent>
+// Events are recycled by every workspace acquire and release, so they're kept in a lock-free cache.
+class EventCache : public nvcv::util::LockFreeCache<CudaEvent>
 {
 public:
     CudaEvent get()
@@ -71,6 +72,9 @@ struct StreamCacheItem
 {
     StreamCacheItem *next = nullptr, *prev = nullptr;
 
+    // Links used by the size index, if it needs them
+    StreamCacheItem *binNext = nullptr, *binPrev = nullptr;
+
     mutable bool wasReady = false;
 
     Payload payload{};
@@ -159,7 +163,191 @@ private:
     size_t m_allocated = 0, m_free = 0;
 };
 
-template<typename Payload, typename Item = StreamCacheItem<Payload>>
+/** Finds cache items by payload size - the smallest sufficient one is tried first.
+ *
+ * Each insertion allocates a tree node and each lookup is logarithmic in the number of items.
+ */
+template<typename Item>
+class OrderedSizeIndex
+{
+public:
+    void insert(Item *item)
+    {
+        auto inserted = m_bySize.insert({item->payloadSize(), item});
+#ifdef NDEBUG
+        (void)inserted;
+#endif
+        assert(inserted.second);
+    }
+
+    /** Removes the item; the payload size is passed explicitly, since the payload may have been moved out. */
+    void remove(size_t payloadSize, Item *item) noexcept
+    {
+        size_t erased = m_bySize.erase({payloadSize, item});
+#ifdef NDEBUG
+        (void)erased;
+#endif
+        assert(erased == 1);
+    }
+
+    template<typename Predicate>
+    Item *find(size_t minSize, Predicate &&pred) const
+    {
+        for (auto it = m_bySize.lower_bound({minSize, nullptr}); it != m_bySize.end(); ++it)
+        {
+            if (pred(it->second->payload))
+                return it->second;
+        }
+        return nullptr;
+    }
+
+    bool empty() const
+    {
+        return m_bySize.empty();
+    }
+
+    size_t size() const
+    {
+        return m_bySize.size();
+    }
+
+    /** Removes all items, passing each of them to the callback. */
+    template<typename ItemCallback>
+    void clear(ItemCallback &&callback)
+    {
+        auto items = std::move(m_bySize);
+        m_bySize.clear();
+        for (auto &[size, item] : items) callback(item);
+    }
+
+private:
+    std::set<std::pair<size_t, Item *>> m_bySize;
+};
+
+/** Finds cache items by payload size, using segregated power-of-two size classes.
+ *
+ * The items are kept in intrusive lists, one per size class, along with a bitmap of non-empty classes.
+ * Insertion and removal are O(1) and don't allocate. A lookup checks the size class of the requested size
+ * and then goes straight to the next non-empty class - any item found there is large enough.
+ *
+ * Unlike OrderedSizeIndex, the item found is not necessarily the smallest sufficient one, but it's less than
+ * twice as large as the requested size whenever the size class of the request contains a suitable item.
+ */
+template<typename Item>
+class BinnedSizeIndex
+{
+public:
+    static constexpr int kNumBins = 64;
+
+    // Size class of a given size: sizes in [2^k, 2^(k+1)) go to bin k, 0 goes to bin 0.
+    static int BinOf(size_t size)
+    {
+        return 63 - __builtin_clzll(size | 1);
+    }
+
+    void insert(Item *item)
+    {
+        int b = BinOf(item->payloadSize());
+
+        assert(!item->binNext && !item->binPrev);
+        item->binNext = m_bins[b];
+        if (m_bins[b])
+            m_bins[b]->binPrev = item;
+        m_bins[b] = item;
+
+        m_nonEmpty |= uint64_t(1) << b;
+        m_size++;
+    }
+
+    /** Removes the item; the payload size is passed explicitly, since the payload may have been moved out. */
+    void remove(size_t payloadSize, Item *item) noexcept
+    {
+        int b = BinOf(payloadSize);
+
+        if (item->binPrev)
+            item->binPrev->binNext = item->binNext;
+        else
+        {
+            assert(m_bins[b] == item);
+            m_bins[b] = static_cast<Item *>(item->binNext);
+            if (!m_bins[b])
+                m_nonEmpty &= ~(uint64_t(1) << b);
+        }
+        if (item->binNext)
+            item->binNext->binPrev = item->binPrev;
+        item->binNext = item->binPrev = nullptr;
+
+        assert(m_size > 0);
+        m_size--;
+    }
+
+    template<typename Predicate>
+    Item *find(size_t minSize, Predicate &&pred) const
+    {
+        int b = BinOf(minSize);
+
+        // The items in the size class of the request may be too small
+        for (Item *item = m_bins[b]; item; item = static_cast<Item *>(item->binNext))
+        {
+            if (item->payloadSize() >= minSize && pred(item->payload))
+                return item;
+        }
+
+        // All items in the larger size classes are large enough
+        uint64_t mask = b + 1 < kNumBins ? m_nonEmpty & (~uint64_t(0) << (b + 1)) : 0;
+        while (mask)
+        {
+            int next = __builtin_ctzll(mask);
+            for (Item *item = m_bins[next]; item; item = static_cast<Item *>(item->binNext))
+            {
+                if (pred(item->payload))
+                    return item;
+            }
+            mask &= mask - 1;
+        }
+        return nullptr;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /** Removes all items, passing each of them to the callback. */
+    template<typename ItemCallback>
+    void clear(ItemCallback &&callback)
+    {
+        while (m_nonEmpty)
+        {
+            int b = __builtin_ctzll(m_nonEmpty);
+            while (Item *item = m_bins[b])
+            {
+                m_bins[b] = static_cast<Item *>(item->binNext);
+                item->binNext = item->binPrev = nullptr;
+                callback(item);
+            }
+            m_nonEmpty &= m_nonEmpty - 1;
+        }
+        m_size = 0;
+    }
+
+private:
+    Item    *m_bins[kNumBins] = {};
+    uint64_t m_nonEmpty       = 0;
+    size_t   m_size           = 0;
+};
+
+/** A cache of payloads used on a single stream, kept in the order in which they were put into the cache.
+ *
+ * @tparam SizeIndex The index used for finding the items by size, OrderedSizeIndex or BinnedSizeIndex.
+ */
+template<typename Payload, typename Item = StreamCacheItem<Payload>,
+         template<typename> class SizeIndex = OrderedSizeIndex>
 class StreamOrderedCache
 {
 public:
@@ -189,6 +377,11 @@ public:
         return m_bySize.empty();
     }
 
+    size_t size() const
+    {
+        return m_bySize.size();
+    }
+
     template<typename Predicate>
     std::optional<Payload> getIf(size_t minSize, Predicate &&pred);
 
@@ -206,19 +399,57 @@ private:
 
     StreamCacheItemAllocator<Payload, item_t> *m_itemAlloc;
 
-    std::set<std::pair<size_t, item_t *>> m_bySize;
+    SizeIndex<item_t> m_bySize;
 
     item_t *m_head = nullptr, *m_tail = nullptr;
 };
 
 } // namespace detail
 
-template<typename Payload, typename Item = detail::StreamCacheItem<Payload>>
+/** Statistics of a PerStreamCache */
+struct PerStreamCacheStats
+{
+    int64_t hits = 0, misses = 0;
+
+    // Number of payloads (and their total size) removed from the cache to stay within the byte budget
+    int64_t evictions = 0;
+    size_t  evictedBytes = 0;
+
+    // Number of payloads currently in the cache and their total size
+    size_t itemsCached = 0;
+    size_t bytesCached = 0;
+
+    // Largest total size of the payloads held by the cache at any time
+    size_t peakBytesCached = 0;
+};
+
+/** A cache of payloads that may still be in use on some stream.
+ *
+ * Payloads put into the cache with a pending `ready` event are kept in a per-stream cache, which can be used
+ * on the same stream right away; when ready, they're moved to the global cache which can be used anywhere.
+ *
+ * The total size of the cached payloads can be limited with a byte budget. When a `put` exceeds the budget,
+ * the ready payloads are evicted, least recently put first, until the cache fits. Payloads that are still
+ * in use are never waited for - they can be evicted by a later `put`, once they're ready.
+ *
+ * @tparam SizeIndex The index used for finding the payloads by size:
+ *                   detail::OrderedSizeIndex - finds the smallest sufficient payload (default),
+ *                   detail::BinnedSizeIndex  - O(1) insertion and removal, finds a payload in the
+ *                                              smallest non-empty power-of-two size class.
+ */
+template<typename Payload, typename Item = detail::StreamCacheItem<Payload>,
+         template<typename> class SizeIndex = detail::OrderedSizeIndex>
 class PerStreamCache
 {
-    using StreamOrderedCache = detail::StreamOrderedCache<Payload, Item>;
+    using StreamOrderedCache = detail::StreamOrderedCache<Payload, Item, SizeIndex>;
 
 public:
+    ~PerStreamCache()
+    {
+        m_perStreamCache.clear();
+        clearGlobal();
+    }
+
     template<typename Predicate>
     std::optional<Payload> getIf(size_t minSize, Predicate &&pred, std::optional<cudaStream_t> stream);
 
@@ -237,9 +468,33 @@ public:
     {
         std::lock_guard g(m_lock);
         for (auto &[k, v] : m_perStreamCache) v.waitAndPurge();
-        m_globalCache.clear();
+        clearGlobal();
+        m_stats.itemsCached = 0;
+        m_stats.bytesCached = 0;
     }
 
+    /** Sets the maximum total size of the cached payloads, evicting the ready ones that don't fit. */
+    void setByteBudget(size_t budget)
+    {
+        std::lock_guard g(m_lock);
+        m_byteBudget = budget;
+        trim();
+    }
+
+    size_t byteBudget() const
+    {
+        std::lock_guard g(m_lock);
+        return m_byteBudget;
+    }
+
+    PerStreamCacheStats stats() const
+    {
+        std::lock_guard g(m_lock);
+        return m_stats;
+    }
+
+    static constexpr size_t kUnlimited = ~size_t(0);
+
 private:
     template<typename Predicate>
     std::optional<Payload> tryGetPerStream(size_t minSize, Predicate &&pred, cudaStream_t stream);
@@ -247,15 +502,37 @@ private:
     template<typename Predicate>
     std::optional<Payload> tryGetGlobal(size_t minSize, Predicate &&pred);
 
+    void putGlobal(Payload &&payload);
+
+    void removeGlobal(size_t payloadSize, Item *item) noexcept;
+
+    void clearGlobal();
+
     int moveReadyToGlobal();
 
+    // Evicts the oldest ready payloads until the cache fits in the byte budget
+    void trim();
+
+    void onRemoved(size_t payloadSize)
+    {
+        assert(m_stats.itemsCached > 0 && m_stats.bytesCached >= payloadSize);
+        m_stats.itemsCached--;
+        m_stats.bytesCached -= payloadSize;
+    }
+
     detail::StreamCacheItemAllocator<Payload, Item> m_cacheItemAlloc;
 
     std::unordered_map<uint64_t, StreamOrderedCache> m_perStreamCache;
 
-    std::multimap<size_t, Payload> m_globalCache;
+    // The global cache is indexed by size; its items are also linked, with their `next` and `prev` fields,
+    // in the order in which they were put into it, from the oldest (m_globalHead) to the newest (m_globalTail).
+    SizeIndex<Item> m_globalCache;
+    Item           *m_globalHead = nullptr, *m_globalTail = nullptr;
+
+    size_t              m_byteBudget = kUnlimited;
+    PerStreamCacheStats m_stats;
 
-    std::mutex m_lock;
+    mutable std::mutex m_lock;
 };
 
 } // namespace nvcv::util
@@ -25,8 +25,8 @@
 namespace nvcv::util {
 namespace detail {
 
-template<typename Payload, typename Item>
-void StreamOrderedCache<Payload, Item>::waitAndPurge()
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void StreamOrderedCache<Payload, Item, SizeIndex>::waitAndPurge()
 {
     bool   ready  = false;
     size_t erased = 0;
@@ -49,12 +49,12 @@ void StreamOrderedCache<Payload, Item>::waitAndPurge()
     }
     assert(erased == m_bySize.size());
     m_head = nullptr;
-    m_bySize.clear();
+    m_bySize.clear([](item_t *) {});
 }
 
-template<typename Payload, typename Item>
+template<typename Payload, typename Item, template<typename> class SizeIndex>
 template<typename PayloadCallback>
-void StreamOrderedCache<Payload, Item>::removeAllReady(PayloadCallback callback)
+void StreamOrderedCache<Payload, Item, SizeIndex>::removeAllReady(PayloadCallback callback)
 {
     if (nvcv::util::IsCudaStreamIdHintUnambiguous())
     {
@@ -93,8 +93,8 @@ void StreamOrderedCache<Payload, Item>::removeAllReady(PayloadCallback callback)
     }
 }
 
-template<typename Payload, typename Item>
-auto StreamOrderedCache<Payload, Item>::findNewestReady() -> item_t *
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+auto StreamOrderedCache<Payload, Item, SizeIndex>::findNewestReady() -> item_t *
 {
     constexpr int kMaxItemsOnStack = 256;
     item_t       *tmp[kMaxItemsOnStack];
@@ -142,8 +142,8 @@ auto StreamOrderedCache<Payload, Item>::findNewestReady() -> item_t *
     return nullptr;
 }
 
-template<typename Payload, typename Item>
-void StreamOrderedCache<Payload, Item>::put(Payload &&payload)
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void StreamOrderedCache<Payload, Item, SizeIndex>::put(Payload &&payload)
 {
     item_t *item  = m_itemAlloc->allocate();
     item->payload = std::move(payload);
@@ -159,33 +159,24 @@ void StreamOrderedCache<Payload, Item>::put(Payload &&payload)
     }
 }
 
-template<typename Payload, typename Item>
+template<typename Payload, typename Item, template<typename> class SizeIndex>
 template<typename Predicate>
-std::optional<Payload> StreamOrderedCache<Payload, Item>::getIf(size_t minSize, Predicate &&pred)
+std::optional<Payload> StreamOrderedCache<Payload, Item, SizeIndex>::getIf(size_t minSize, Predicate &&pred)
 {
-    auto it = m_bySize.lower_bound({minSize, nullptr});
-    for (; it != m_bySize.end(); ++it)
-    {
-        auto *item = it->second;
-        if (pred(item->payload))
-        {
-            size_t  payloadSize = item->payloadSize();
-            Payload ret         = std::move(item->payload);
-            remove(payloadSize, item);
-            return ret;
-        }
-    }
-    return std::nullopt;
+    item_t *item = m_bySize.find(minSize, std::forward<Predicate>(pred));
+    if (!item)
+        return std::nullopt;
+
+    size_t  payloadSize = item->payloadSize();
+    Payload ret         = std::move(item->payload);
+    remove(payloadSize, item);
+    return ret;
 }
 
-template<typename Payload, typename Item>
-void StreamOrderedCache<Payload, Item>::insert(item_t *item)
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void StreamOrderedCache<Payload, Item, SizeIndex>::insert(item_t *item)
 {
-    auto inserted = m_bySize.insert({item->payloadSize(), item});
-#ifdef NDEBUG
-    (void)inserted;
-#endif
-    assert(inserted.second);
+    m_bySize.insert(item);
 
     if (!m_tail)
     {
@@ -201,8 +192,8 @@ void StreamOrderedCache<Payload, Item>::insert(item_t *item)
     }
 }
 
-template<typename Payload, typename Item>
-void StreamOrderedCache<Payload, Item>::remove(size_t payloadSize, item_t *item) noexcept
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void StreamOrderedCache<Payload, Item, SizeIndex>::remove(size_t payloadSize, item_t *item) noexcept
 {
     if (item == m_head)
         m_head = m_head->next;
@@ -215,48 +206,50 @@ void StreamOrderedCache<Payload, Item>::remove(size_t payloadSize, item_t *item)
         item->next->prev = item->prev;
     item->prev = item->next = nullptr;
 
-    size_t erased = m_bySize.erase({payloadSize, item});
-#ifdef NDEBUG
-    (void)erased;
-#endif
-    assert(erased == 1);
+    m_bySize.remove(payloadSize, item);
 
     m_itemAlloc->deallocate(item);
 }
 
 } // namespace detail
 
-template<typename Payload, typename Item>
+template<typename Payload, typename Item, template<typename> class SizeIndex>
 template<typename Predicate>
-std::optional<Payload> PerStreamCache<Payload, Item>::getIf(size_t minSize, Predicate &&pred,
-                                                            std::optional<cudaStream_t> stream)
+std::optional<Payload> PerStreamCache<Payload, Item, SizeIndex>::getIf(size_t minSize, Predicate &&pred,
+                                                                       std::optional<cudaStream_t> stream)
 {
     std::optional<Payload> ret;
 
     std::lock_guard guard(m_lock);
 
     if (stream)
-    {
         ret = tryGetPerStream(minSize, pred, *stream);
-        if (ret)
-            return ret;
-    }
 
-    do
+    if (!ret)
     {
-        ret = tryGetGlobal(minSize, pred);
-        if (ret)
-            return ret;
+        do
+        {
+            ret = tryGetGlobal(minSize, pred);
+        }
+        while (!ret && moveReadyToGlobal());
     }
-    while (moveReadyToGlobal());
 
-    return std::nullopt;
+    if (ret)
+    {
+        m_stats.hits++;
+        onRemoved(StreamCachePayloadSize(*ret));
+    }
+    else
+    {
+        m_stats.misses++;
+    }
+    return ret;
 }
 
-template<typename Payload, typename Item>
+template<typename Payload, typename Item, template<typename> class SizeIndex>
 template<typename Predicate>
-std::optional<Payload> PerStreamCache<Payload, Item>::tryGetPerStream(size_t size, Predicate &&pred,
-                                                                      cudaStream_t stream)
+std::optional<Payload> PerStreamCache<Payload, Item, SizeIndex>::tryGetPerStream(size_t size, Predicate &&pred,
+                                                                                 cudaStream_t stream)
 {
     uint64_t streamId = GetCudaStreamIdHint(stream);
     auto     it       = m_perStreamCache.find(streamId);
@@ -265,24 +258,80 @@ std::optional<Payload> PerStreamCache<Payload, Item>::tryGetPerStream(size_t siz
     return it->second.getIf(size, std::forward<Predicate>(pred));
 }
 
-template<typename Payload, typename Item>
+template<typename Payload, typename Item, template<typename> class SizeIndex>
 template<typename Predicate>
-std::optional<Payload> PerStreamCache<Payload, Item>::tryGetGlobal(size_t size, Predicate &&pred)
+std::optional<Payload> PerStreamCache<Payload, Item, SizeIndex>::tryGetGlobal(size_t size, Predicate &&pred)
+{
+    Item *item = m_globalCache.find(size, std::forward<Predicate>(pred));
+    if (!item)
+        return std::nullopt;
+
+    size_t  payloadSize = item->payloadSize();
+    Payload ret         = std::move(item->payload);
+    removeGlobal(payloadSize, item);
+    return ret;
+}
+
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void PerStreamCache<Payload, Item, SizeIndex>::putGlobal(Payload &&payload)
 {
-    for (auto it = m_globalCache.lower_bound(size); it != m_globalCache.end(); ++it)
+    Item *item    = m_cacheItemAlloc.allocate();
+    item->payload = std::move(payload);
+    payload       = {};
+    try
     {
-        if (pred(it->second))
-        {
-            Payload ret = std::move(it->second);
-            m_globalCache.erase(it);
-            return ret;
-        }
+        m_globalCache.insert(item);
+    }
+    catch (...)
+    {
+        m_cacheItemAlloc.deallocate(item);
+        throw;
+    }
+
+    if (m_globalTail)
+    {
+        m_globalTail->next = item;
+        item->prev         = m_globalTail;
+    }
+    else
+    {
+        m_globalHead = item;
     }
-    return std::nullopt;
+    m_globalTail = item;
 }
 
-template<typename Payload, typename Item>
-int PerStreamCache<Payload, Item>::moveReadyToGlobal()
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void PerStreamCache<Payload, Item, SizeIndex>::removeGlobal(size_t payloadSize, Item *item) noexcept
+{
+    m_globalCache.remove(payloadSize, item);
+
+    if (item == m_globalHead)
+        m_globalHead = static_cast<Item *>(item->next);
+    if (item == m_globalTail)
+        m_globalTail = static_cast<Item *>(item->prev);
+    if (item->prev)
+        item->prev->next = item->next;
+    if (item->next)
+        item->next->prev = item->prev;
+    item->prev = item->next = nullptr;
+
+    m_cacheItemAlloc.deallocate(item);
+}
+
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void PerStreamCache<Payload, Item, SizeIndex>::clearGlobal()
+{
+    m_globalCache.clear(
+        [this](Item *item)
+        {
+            item->prev = item->next = nullptr;
+            m_cacheItemAlloc.deallocate(item);
+        });
+    m_globalHead = m_globalTail = nullptr;
+}
+
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+int PerStreamCache<Payload, Item, SizeIndex>::moveReadyToGlobal()
 {
     int moved = 0;
     for (auto it = m_perStreamCache.begin(); it != m_perStreamCache.end();)
@@ -290,7 +339,7 @@ int PerStreamCache<Payload, Item>::moveReadyToGlobal()
         it->second.removeAllReady(
             [&](Payload &&payload)
             {
-                m_globalCache.emplace(StreamCachePayloadSize(payload), std::move(payload));
+                putGlobal(std::move(payload));
                 moved++;
             });
         if (it->second.empty())
@@ -301,11 +350,30 @@ int PerStreamCache<Payload, Item>::moveReadyToGlobal()
     return moved;
 }
 
-template<typename Payload, typename Item>
-void PerStreamCache<Payload, Item>::put(Payload &&payload, std::optional<cudaStream_t> stream)
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void PerStreamCache<Payload, Item, SizeIndex>::trim()
+{
+    if (m_stats.bytesCached <= m_byteBudget)
+        return;
+
+    moveReadyToGlobal();
+
+    while (m_stats.bytesCached > m_byteBudget && m_globalHead)
+    {
+        size_t payloadSize = m_globalHead->payloadSize();
+        removeGlobal(payloadSize, m_globalHead); // destroys the payload
+        onRemoved(payloadSize);
+        m_stats.evictions++;
+        m_stats.evictedBytes += payloadSize;
+    }
+}
+
+template<typename Payload, typename Item, template<typename> class SizeIndex>
+void PerStreamCache<Payload, Item, SizeIndex>::put(Payload &&payload, std::optional<cudaStream_t> stream)
 {
     cudaEvent_t readyEvent = StreamCachePayloadReady(payload);
     bool        per_stream = readyEvent != nullptr && cudaEventQuery(readyEvent) == cudaErrorNotReady;
+    size_t      size       = StreamCachePayloadSize(payload);
 
     std::lock_guard guard(m_lock);
 
@@ -320,9 +388,15 @@ void PerStreamCache<Payload, Item>::put(Payload &&payload, std::optional<cudaStr
     }
     else
     {
-        size_t size = StreamCachePayloadSize(payload);
-        m_globalCache.emplace(size, std::move(payload));
+        putGlobal(std::move(payload));
     }
+
+    m_stats.itemsCached++;
+    m_stats.bytesCached += size;
+    if (m_stats.bytesCached > m_stats.peakBytesCached)
+        m_stats.peakBytesCached = m_stats.bytesCached;
+
+    trim();
 }
 
 } // namespace nvcv::util
@@ -19,6 +19,7 @@ import numpy as np
 import cvcuda_util as util
 import threading
 import queue
+import time
 
 
 RNG = np.random.default_rng(0)
@@ -158,6 +159,105 @@ def test_op_resize_multithread():
         assert dst.shape == dst_shape
 
 
+@t.mark.skip(reason="benchmark, prints timings only")
+def test_op_resize_multithread_host_scaling():
+    # Small images, so that the host work of each call dominates. The GIL is released
+    # while the operator runs, threads feeding their own streams can overlap it.
+    src_shape = (1, 32, 48, 3)
+    dst_shape = (1, 16, 24, 3)
+    num_iters = 200
+
+    src = util.create_tensor(src_shape, np.uint8, "NHWC", max_random=255, rng=RNG)
+    ref = util.to_cpu_numpy_buffer(cvcuda.resize(src, dst_shape).cuda())
+
+    def run(num_threads):
+        streams = [cvcuda.Stream() for _ in range(num_threads)]
+        dsts = [cvcuda.Tensor(dst_shape, np.uint8, "NHWC") for _ in range(num_threads)]
+        start = threading.Barrier(num_threads + 1)
+
+        def thread_run(i):
+            start.wait()
+            for _ in range(num_iters):
+                cvcuda.resize_into(dsts[i], src, stream=streams[i])
+            streams[i].sync()
+
+        threads = [threading.Thread(target=thread_run, args=(i,)) for i in range(num_threads)]
+        for thread in threads:
+            thread.start()
+        start.wait()
+        begin = time.perf_counter()
+        for thread in threads:
+            thread.join()
+        elapsed = time.perf_counter() - begin
+
+        for dst in dsts:
+            assert np.array_equal(util.to_cpu_numpy_buffer(dst.cuda()), ref)
+
+        return num_threads * num_iters / elapsed
+
+    base = run(1)
+    print(f"resize with 1 thread: {base:.0f} calls/s")
+    for num_threads in (2, 4, 8):
+        rate = run(num_threads)
+        print(f"resize with {num_threads} threads: {rate:.0f} calls/s, {rate / base:.2f}x")
+
+
+def test_op_resize_many():
+    srcs = [
+        util.create_tensor((2, 16 + i, 23, 4), np.uint8, "NHWC", max_random=255, rng=RNG)
+        for i in range(4)
+    ]
+    shapes = [(2, 8 + i, 15, 4) for i in range(4)]
+    stream = cvcuda.Stream()
+
+    outs = cvcuda.resize_many(srcs, shapes, cvcuda.Interp.LINEAR, stream=stream)
+    assert len(outs) == len(srcs)
+    for src, out, shape in zip(srcs, outs, shapes):
+        ref = cvcuda.resize(src, shape, cvcuda.Interp.LINEAR, stream=stream)
+        assert out.shape == shape
+        assert out.layout == src.layout
+        assert out.dtype == src.dtype
+        assert np.array_equal(
+            util.to_cpu_numpy_buffer(out.cuda()), util.to_cpu_numpy_buffer(ref.cuda())
+        )
+
+    dsts = [cvcuda.Tensor(shape, np.uint8, "NHWC") for shape in shapes]
+    tmp = cvcuda.resize_many_into(dsts, srcs, stream=stream)
+    assert all(a is b for a, b in zip(tmp, dsts))
+
+    with t.raises(RuntimeError):
+        cvcuda.resize_many(srcs, shapes[:-1])
+    with t.raises(RuntimeError):
+        cvcuda.resize_many_into(dsts[:-1], srcs)
+
+
+@t.mark.skip(reason="benchmark, prints timings only")
+def test_op_resize_many_host_overhead():
+    # Per-image host cost of resizing small images one call at a time vs. in one call
+    num_images, num_iters = 64, 20
+    srcs = [cvcuda.Tensor((1, 32, 48, 3), np.uint8, "NHWC") for _ in range(num_images)]
+    dsts = [cvcuda.Tensor((1, 16, 24, 3), np.uint8, "NHWC") for _ in range(num_images)]
+    stream = cvcuda.Stream()
+
+    def per_image(fn):
+        fn()  # warm-up
+        stream.sync()
+        begin = time.perf_counter()
+        for _ in range(num_iters):
+            fn()
+        elapsed = time.perf_counter() - begin
+        stream.sync()
+        return elapsed / (num_iters * num_images) * 1e6
+
+    def one_by_one():
+        for dst, src in zip(dsts, srcs):
+            cvcuda.resize_into(dst, src, stream=stream)
+
+    before = per_image(one_by_one)
+    after = per_image(lambda: cvcuda.resize_many_into(dsts, srcs, stream=stream))
+    print(f"resize host time per image: {before:.2f} us one by one, {after:.2f} us with resize_many_into")
+
+
 def test_op_resize_user_stream_with_tensor():
     stream = cvcuda.Stream()
     src_shape = (5, 1080, 1920, 4)
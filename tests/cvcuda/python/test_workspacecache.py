@@ -0,0 +1,82 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import numpy as np
+import pytest as t
+
+
+KINDS = ("host", "pinned", "cuda")
+
+
+def run_op():
+    input = cvcuda.Tensor((2, 55, 55, 4), np.uint8, "NHWC")
+    cvcuda.pillowresize(input, (2, 31, 31, 4), cvcuda.Format.RGB8)
+    cvcuda.Stream.current.sync()
+
+
+def test_workspace_cache_stats():
+    run_op()
+    before = cvcuda.workspace_cache_stats()
+    assert set(before.keys()) == set(KINDS)
+
+    run_op()
+    after = cvcuda.workspace_cache_stats()
+    for kind in KINDS:
+        s = after[kind]
+        for key in (
+            "hits",
+            "misses",
+            "evictions",
+            "evicted_bytes",
+            "items_cached",
+            "bytes_cached",
+            "peak_bytes_cached",
+            "leased",
+        ):
+            assert s[key] >= 0
+        assert s["hits"] + s["misses"] >= before[kind]["hits"] + before[kind]["misses"]
+        assert s["peak_bytes_cached"] >= s["bytes_cached"]
+        assert s["leased"] == 0
+
+    # The second run reuses the memory cached by the first one
+    assert after["cuda"]["hits"] > before["cuda"]["hits"]
+
+
+def test_workspace_cache_budget():
+    try:
+        cvcuda.set_workspace_cache_budget(cuda=0)
+        assert cvcuda.workspace_cache_stats()["cuda"]["byte_budget"] == 0
+
+        run_op()
+        # The workspace was returned before the stream was synchronized, it might still
+        # be waiting in the per-stream cache. It's ready now, setting the budget again
+        # trims the cache.
+        cvcuda.set_workspace_cache_budget(cuda=0)
+        stats = cvcuda.workspace_cache_stats()["cuda"]
+        assert stats["bytes_cached"] == 0
+        assert stats["evictions"] > 0
+
+        # Other kinds are left unchanged
+        assert cvcuda.workspace_cache_stats()["host"]["byte_budget"] is None
+
+        with t.raises(ValueError):
+            cvcuda.set_workspace_cache_budget(cuda=-1)
+        with t.raises(ValueError):
+            cvcuda.set_workspace_cache_budget(gpu=0)
+    finally:
+        cvcuda.set_workspace_cache_budget(host=None, pinned=None, cuda=None)
+
+    assert cvcuda.workspace_cache_stats()["cuda"]["byte_budget"] is None
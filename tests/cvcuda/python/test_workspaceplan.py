@@ -0,0 +1,83 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import cvcuda
+import numpy as np
+import pytest as t
+
+
+def run_pipeline(input, stream):
+    small = cvcuda.pillowresize(
+        input, (2, 31, 31, 4), cvcuda.Format.RGB8, stream=stream
+    )
+    return cvcuda.pillowresize(
+        small, (2, 64, 80, 4), cvcuda.Format.RGB8, stream=stream
+    )
+
+
+def test_workspace_plan_records_stages():
+    stream = cvcuda.Stream()
+    input = cvcuda.Tensor((2, 55, 55, 4), np.uint8, "NHWC")
+
+    plan = cvcuda.WorkspacePlan(stream)
+    assert plan.num_stages == 0
+
+    with plan:
+        first = run_pipeline(input, stream)
+    assert plan.num_stages == 2
+
+    req = plan.requirements
+    assert set(req.keys()) == {"host", "pinned", "cuda"}
+    for size, alignment in req.values():
+        assert size % alignment == 0
+
+    # Subsequent runs reuse the same stages, served from a single workspace
+    for _ in range(3):
+        with plan as p:
+            assert p is plan
+            out = run_pipeline(input, stream)
+        assert plan.num_stages == 2
+        assert plan.requirements == req
+        assert out.shape == first.shape
+
+    plan.reset()
+    assert plan.num_stages == 0
+
+
+def test_workspace_plan_uses_current_stream():
+    input = cvcuda.Tensor((2, 55, 55, 4), np.uint8, "NHWC")
+    stream = cvcuda.Stream()
+
+    plan = cvcuda.WorkspacePlan()
+    with stream, plan:
+        run_pipeline(input, None)
+    assert plan.num_stages == 2
+
+    # Operators on other streams don't use the plan
+    other = cvcuda.Stream()
+    with stream, plan:
+        run_pipeline(input, other)
+    assert plan.num_stages == 2
+
+
+def test_workspace_plan_misuse():
+    plan = cvcuda.WorkspacePlan()
+    with plan:
+        with t.raises(RuntimeError):
+            plan.__enter__()
+        with t.raises(RuntimeError):
+            plan.reset()
+    with t.raises(RuntimeError):
+        plan.__exit__(None, None, None)
@@ -18,6 +18,10 @@
 #include "Definitions.hpp"
 
 #include <cvcuda/priv/WorkspaceAllocator.hpp>
+#include <cvcuda/priv/WorkspaceEstimator.hpp>
+
+#include <cstdint>
+#include <vector>
 
 #define EXPECT_PTR_EQ(a, b) EXPECT_EQ((const void *)(a), (const void *)(b))
 
@@ -201,3 +205,103 @@ TEST(WorkspaceMemAllocatorTest, Sync)
 
     ASSERT_EQ(cudaEventDestroy(wm.ready), cudaSuccess);
 }
+
+TEST(WorkspaceMemAllocatorTest, ScopeReusesMemory)
+{
+    alignas(64) char     base[64];
+    cvcuda::WorkspaceMem wm{};
+    wm.req  = {64, 64};
+    wm.data = base;
+
+    cvcuda::WorkspaceMemAllocator wa(wm);
+    EXPECT_PTR_EQ(wa.get<char>(8), base + 0);
+    {
+        cvcuda::WorkspaceScope scope(wa);
+        EXPECT_PTR_EQ(wa.get<double>(4), base + 8);
+        {
+            cvcuda::WorkspaceScope nested(wa);
+            EXPECT_PTR_EQ(wa.get<char>(16), base + 40);
+        }
+        EXPECT_EQ(wa.allocated(), 40);
+    }
+    EXPECT_EQ(wa.allocated(), 8);
+    EXPECT_EQ(wa.peak(), 56);
+
+    // Without the scopes, it wouldn't fit
+    {
+        cvcuda::WorkspaceScope scope(wa);
+        EXPECT_PTR_EQ(wa.get<int32_t>(14), base + 8);
+    }
+    EXPECT_EQ(wa.peak(), 64);
+
+    size_t mark = wa.mark();
+    wa.get<char>(4);
+    wa.rewind(0);
+    EXPECT_THROW(wa.rewind(mark + 4), std::logic_error);
+    EXPECT_FALSE(wa.tryRewind(mark + 4));
+    EXPECT_EQ(wa.allocated(), 0);
+}
+
+TEST(WorkspaceAllocatorTest, ScopeReusesMemoryForEachKind)
+{
+    alignas(64) char  base[64];
+    alignas(64) char  pinnedBase[64];
+    cvcuda::Workspace ws{};
+    ws.hostMem.req    = {64, 64};
+    ws.hostMem.data   = base;
+    ws.pinnedMem.req  = {64, 64};
+    ws.pinnedMem.data = pinnedBase;
+
+    cvcuda::WorkspaceAllocator wa(ws);
+    EXPECT_PTR_EQ(wa.getHost<char>(4), base);
+    {
+        cvcuda::WorkspaceScope scope(wa);
+        EXPECT_PTR_EQ(wa.getHost<double>(4), base + 8);
+        EXPECT_PTR_EQ(wa.getPinned<double>(8), pinnedBase);
+    }
+    EXPECT_PTR_EQ(wa.getHost<char>(1), base + 4);
+    EXPECT_PTR_EQ(wa.getPinned<float>(1), pinnedBase);
+}
+
+TEST(WorkspaceAllocatorTest, PeakEstimateIsEnoughForScopedAllocation)
+{
+    // A multi-phase operator: a persistent buffer, then two phases that never overlap in time.
+    auto run = [](auto &ws, auto &&getCuda)
+    {
+        getCuda(ws, 1000, 4);
+        {
+            cvcuda::WorkspaceScope phase(ws);
+            getCuda(ws, 40000, 4);
+            getCuda(ws, 3, 8);
+        }
+        {
+            cvcuda::WorkspaceScope phase(ws);
+            getCuda(ws, 20000, 16);
+            {
+                cvcuda::WorkspaceScope nested(ws);
+                getCuda(ws, 30000, 1);
+            }
+        }
+    };
+
+    cvcuda::WorkspaceEstimator est;
+    run(est, [](cvcuda::WorkspaceEstimator &e, size_t count, size_t align) { e.addCuda<char>(count, align); });
+
+    cvcuda::WorkspaceEstimator sumEst;
+    sumEst.addCuda(1000, 4).addCuda(40000, 4).addCuda<char>(3, 8).addCuda(20000, 16).addCuda(30000, 1);
+
+    EXPECT_LT(est.cudaMem.req.size, sumEst.cudaMem.req.size);
+    EXPECT_EQ(est.cudaMem.req.size, 1008 + 20000 + 30000);
+
+    std::vector<char> buffer(est.cudaMem.req.size + est.cudaMem.req.alignment);
+    uintptr_t         addr = reinterpret_cast<uintptr_t>(buffer.data());
+
+    cvcuda::Workspace ws{};
+    ws.cudaMem.req  = est.cudaMem.req;
+    ws.cudaMem.data = buffer.data() + (est.cudaMem.req.alignment - addr % est.cudaMem.req.alignment);
+
+    cvcuda::WorkspaceAllocator wa(ws);
+    EXPECT_NO_THROW(
+        run(wa, [](cvcuda::WorkspaceAllocator &a, size_t count, size_t align) { a.getCuda<char>(count, align); }));
+    EXPECT_EQ(wa.cudaMem.peak(), est.cudaMem.req.size);
+}
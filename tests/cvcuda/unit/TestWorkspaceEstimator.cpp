@@ -67,3 +67,89 @@ TEST(WorkspaceEstimatorTest, Add)
     EXPECT_EQ(est.cudaMem.req.size, 12);     // 3 chars, padding, 2 ints
     EXPECT_EQ(est.cudaMem.req.alignment, 4); // alignment for int32
 }
+
+TEST(WorkspaceMemEstimatorTest, ScopeComputesPeak)
+{
+    cvcuda::WorkspaceMemEstimator est(0, 1);
+
+    est.add(100); // lives throughout
+    {
+        cvcuda::WorkspaceScope phase1(est);
+        est.add(1000);
+    }
+    {
+        cvcuda::WorkspaceScope phase2(est);
+        est.add(3000);
+        {
+            cvcuda::WorkspaceScope nested(est);
+            est.add(500);
+        }
+        est.add(200);
+    }
+    {
+        cvcuda::WorkspaceScope phase3(est);
+        est.add(2000);
+    }
+    EXPECT_EQ(est.offset, 100);
+    EXPECT_EQ(est.req.size, 100 + 3000 + 500);
+
+    // Without scopes, all the entries add up
+    cvcuda::WorkspaceMemEstimator sum(0, 1);
+    sum.add(100).add(1000).add(3000).add(500).add(200).add(2000);
+    EXPECT_EQ(sum.req.size, 6800);
+}
+
+TEST(WorkspaceMemEstimatorTest, ScopeKeepsAlignment)
+{
+    cvcuda::WorkspaceMemEstimator est(0, 1);
+
+    est.add(3);
+    {
+        cvcuda::WorkspaceScope scope(est);
+        est.add<double>(2);
+    }
+    EXPECT_EQ(est.offset, 3);
+    EXPECT_EQ(est.req.size, 24);
+    EXPECT_EQ(est.req.alignment, 8);
+
+    est.add<int32_t>();
+    EXPECT_EQ(est.offset, 8);
+    EXPECT_EQ(est.req.size, 24);
+}
+
+TEST(WorkspaceMemEstimatorTest, RewindPastPositionThrows)
+{
+    cvcuda::WorkspaceMemEstimator est(0, 1);
+    est.add(10);
+    size_t mark = est.mark();
+    est.rewind(0);
+    EXPECT_THROW(est.rewind(mark), std::logic_error);
+    EXPECT_FALSE(est.tryRewind(mark));
+    EXPECT_EQ(est.offset, 0);
+}
+
+TEST(WorkspaceEstimatorTest, ScopeComputesPeakForEachKind)
+{
+    cvcuda::WorkspaceEstimator est;
+    est.hostMem.req.alignment   = 1;
+    est.pinnedMem.req.alignment = 1;
+    est.cudaMem.req.alignment   = 1;
+
+    est.addHost(10);
+    {
+        cvcuda::WorkspaceScope scope(est);
+        est.add(true, true, true, 100);
+    }
+    {
+        cvcuda::WorkspaceScope scope(est);
+        est.addPinned(50).addCuda(300);
+    }
+
+    EXPECT_EQ(est.hostMem.req.size, 110);
+    EXPECT_EQ(est.pinnedMem.req.size, 100);
+    EXPECT_EQ(est.cudaMem.req.size, 300);
+
+    EXPECT_EQ(est.hostMem.offset, 10);
+    EXPECT_EQ(est.pinnedMem.offset, 0);
+    EXPECT_EQ(est.cudaMem.offset, 0);
+}
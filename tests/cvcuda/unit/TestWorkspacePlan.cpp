@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/WorkspacePlan.hpp>
+#include <cvcuda/priv/WorkspaceAllocator.hpp>
+
+#define EXPECT_PTR_EQ(a, b) EXPECT_EQ((const void *)(a), (const void *)(b))
+
+namespace {
+
+cvcuda::WorkspaceRequirements MakeReq(size_t hostSize, size_t hostAlign, size_t pinnedSize, size_t pinnedAlign,
+                                      size_t cudaSize, size_t cudaAlign)
+{
+    return {
+        {  hostSize,   hostAlign},
+        {pinnedSize, pinnedAlign},
+        {  cudaSize,   cudaAlign}
+    };
+}
+
+} // namespace
+
+TEST(WorkspacePlanTest, EmptyPlan)
+{
+    cvcuda::WorkspacePlan plan;
+    EXPECT_EQ(plan.numStages(), 0);
+
+    cvcuda::WorkspaceRequirements req = plan.requirements();
+    EXPECT_EQ(req.hostMem.size, 0);
+    EXPECT_EQ(req.pinnedMem.size, 0);
+    EXPECT_EQ(req.cudaMem.size, 0);
+
+    EXPECT_THROW(plan.stageRequirements(0), nvcv::Exception);
+}
+
+TEST(WorkspacePlanTest, RequirementsAreMaxOverStages)
+{
+    cvcuda::WorkspacePlan plan;
+    EXPECT_EQ(plan.addStage(MakeReq(100, 8, 0, 0, 1000, 256)), 0);
+    EXPECT_EQ(plan.addStage(MakeReq(10, 16, 64, 64, 5000, 16)), 1);
+    EXPECT_EQ(plan.addStage(MakeReq(0, 0, 32, 4, 300, 512)), 2);
+    EXPECT_EQ(plan.numStages(), 3);
+
+    cvcuda::WorkspaceRequirements req = plan.requirements();
+    EXPECT_EQ(req.hostMem.size, 112);
+    EXPECT_EQ(req.hostMem.alignment, 16);
+    EXPECT_EQ(req.pinnedMem.size, 64);
+    EXPECT_EQ(req.pinnedMem.alignment, 64);
+    EXPECT_EQ(req.cudaMem.size, 5120);
+    EXPECT_EQ(req.cudaMem.alignment, 512);
+
+    // The sum is what separate workspaces would need
+    size_t sum = 1000 + 5000 + 300;
+    EXPECT_LT(req.cudaMem.size, sum);
+
+    plan.setStageRequirements(2, MakeReq(0, 0, 0, 0, 8000, 256));
+    EXPECT_EQ(plan.requirements().cudaMem.size, 8192);
+    EXPECT_EQ(plan.requirements().cudaMem.alignment, 256);
+
+    plan.clear();
+    EXPECT_EQ(plan.numStages(), 0);
+    EXPECT_EQ(plan.requirements().cudaMem.size, 0);
+}
+
+TEST(WorkspacePlanTest, AlignmentIsLeastCommonMultiple)
+{
+    cvcuda::WorkspacePlan plan;
+    plan.addStage(MakeReq(10, 12, 0, 0, 0, 0));
+    plan.addStage(MakeReq(20, 8, 0, 0, 0, 0));
+
+    cvcuda::WorkspaceRequirements req = plan.requirements();
+    EXPECT_EQ(req.hostMem.alignment, 24);
+    EXPECT_EQ(req.hostMem.size, 24);
+}
+
+TEST(WorkspacePlanTest, StageViews)
+{
+    cvcuda::WorkspacePlan plan;
+    plan.addStage(MakeReq(16, 8, 0, 0, 256, 64));
+    plan.addStage(MakeReq(64, 64, 32, 16, 128, 128));
+
+    cvcuda::WorkspaceRequirements req = plan.requirements();
+
+    alignas(128) char host[128], pinned[128], cuda[512];
+    cudaEvent_t       fakeEvent = reinterpret_cast<cudaEvent_t>(0x1234);
+
+    cvcuda::Workspace ws{
+        { req.hostMem,   host,   nullptr},
+        {req.pinnedMem, pinned,   nullptr},
+        {  req.cudaMem,   cuda, fakeEvent}
+    };
+
+    cvcuda::Workspace v0 = plan.stageView(ws, 0);
+    EXPECT_PTR_EQ(v0.hostMem.data, host);
+    EXPECT_EQ(v0.hostMem.req.size, 16);
+    EXPECT_PTR_EQ(v0.pinnedMem.data, nullptr);
+    EXPECT_EQ(v0.pinnedMem.req.size, 0);
+    EXPECT_PTR_EQ(v0.cudaMem.data, cuda);
+    EXPECT_EQ(v0.cudaMem.req.size, 256);
+    EXPECT_EQ(v0.cudaMem.ready, fakeEvent);
+
+    cvcuda::Workspace v1 = plan.stageView(ws, 1);
+    EXPECT_PTR_EQ(v1.hostMem.data, host);
+    EXPECT_EQ(v1.hostMem.req.alignment, 64);
+    EXPECT_PTR_EQ(v1.pinnedMem.data, pinned);
+    EXPECT_EQ(v1.pinnedMem.req.size, 32);
+    EXPECT_PTR_EQ(v1.cudaMem.data, cuda);
+
+    // The views can be used with a workspace allocator, as a regular workspace
+    {
+        cvcuda::WorkspaceAllocator wa(v1);
+        EXPECT_PTR_EQ(wa.getHost<char>(64), host);
+        EXPECT_THROW(wa.getHost<char>(1), nvcv::Exception);
+    }
+
+    EXPECT_THROW(plan.stageView(ws, 2), nvcv::Exception);
+    EXPECT_THROW(plan.stageView(ws, -1), nvcv::Exception);
+}
+
+TEST(WorkspacePlanTest, StageViewRejectsUnsuitableWorkspace)
+{
+    cvcuda::WorkspacePlan plan;
+    plan.addStage(MakeReq(0, 0, 0, 0, 256, 64));
+
+    alignas(64) char cuda[512];
+
+    cvcuda::Workspace tooSmall{};
+    tooSmall.cudaMem = {{128, 64}, cuda, nullptr};
+    EXPECT_FALSE(cvcuda::WorkspacePlan::Fits(tooSmall, plan.stageRequirements(0)));
+    EXPECT_THROW(plan.stageView(tooSmall, 0), nvcv::Exception);
+
+    cvcuda::Workspace misaligned{};
+    misaligned.cudaMem = {{300, 1}, cuda + 1, nullptr};
+    EXPECT_FALSE(cvcuda::WorkspacePlan::Fits(misaligned, plan.stageRequirements(0)));
+    EXPECT_THROW(plan.stageView(misaligned, 0), nvcv::Exception);
+
+    cvcuda::Workspace missing{};
+    EXPECT_FALSE(cvcuda::WorkspacePlan::Fits(missing, plan.stageRequirements(0)));
+
+    cvcuda::Workspace good{};
+    good.cudaMem = {{256, 64}, cuda, nullptr};
+    EXPECT_TRUE(cvcuda::WorkspacePlan::Fits(good, plan.stageRequirements(0)));
+    EXPECT_NO_THROW(plan.stageView(good, 0));
+}
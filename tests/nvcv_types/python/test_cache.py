@@ -0,0 +1,131 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import nvcv
+import numpy as np
+import pytest as t
+
+
+@t.fixture(autouse=True)
+def empty_cache():
+    nvcv.set_cache_limit()
+    nvcv.clear_cache()
+    yield
+    nvcv.set_cache_limit()
+    nvcv.clear_cache()
+
+
+def delta(before, after):
+    return {k: after[k] - before[k] for k in ("hits", "misses", "evictions")}
+
+
+def test_cache_stats_hits_and_misses():
+    before = nvcv.cache_stats()
+
+    tensor = nvcv.Tensor((16, 32), np.uint8)
+    buffer = tensor.cuda().__cuda_array_interface__["data"][0]
+    del tensor
+
+    assert delta(before, nvcv.cache_stats()) == {"hits": 0, "misses": 1, "evictions": 0}
+
+    tensor = nvcv.Tensor((16, 32), np.uint8)
+    assert tensor.cuda().__cuda_array_interface__["data"][0] == buffer
+
+    stats = nvcv.cache_stats()
+    assert delta(before, stats) == {"hits": 1, "misses": 1, "evictions": 0}
+    assert stats["items"] == nvcv.cache_size() == 1
+    assert stats["bytes"] >= 16 * 32
+
+
+def test_cache_item_limit_evicts_least_recently_used():
+    nvcv.set_cache_limit(items=2)
+
+    a = nvcv.Tensor((16, 16), np.uint8)
+    b = nvcv.Tensor((16, 32), np.uint8)
+    del a, b
+
+    # Reusing 'a' makes 'b' the least recently used item
+    a = nvcv.Tensor((16, 16), np.uint8)
+    del a
+
+    before = nvcv.cache_stats()
+    c = nvcv.Tensor((16, 64), np.uint8)
+    del c
+    assert nvcv.cache_size() == 2
+    assert delta(before, nvcv.cache_stats())["evictions"] == 1
+
+    before = nvcv.cache_stats()
+    a = nvcv.Tensor((16, 16), np.uint8)
+    assert delta(before, nvcv.cache_stats())["hits"] == 1
+    b = nvcv.Tensor((16, 32), np.uint8)
+    assert delta(before, nvcv.cache_stats())["misses"] == 1
+
+
+def test_cache_byte_limit():
+    tensor = nvcv.Tensor((256, 256), np.uint8)
+    size = nvcv.cache_stats()["bytes"]
+    assert size >= 256 * 256
+    del tensor
+
+    nvcv.set_cache_limit(bytes=size)
+
+    tensor = nvcv.Tensor((128, 256), np.uint8)
+    del tensor
+
+    stats = nvcv.cache_stats()
+    assert stats["bytes"] <= size
+    assert stats["items"] == 1
+    assert stats["evictions"] >= 1
+
+
+def test_cache_limit_keeps_items_in_use():
+    nvcv.set_cache_limit(items=1)
+
+    tensors = [nvcv.Tensor((8, i + 1), np.uint8) for i in range(3)]
+    assert nvcv.cache_size() == 3
+
+    del tensors
+    nvcv.set_cache_limit(items=1)
+    assert nvcv.cache_size() == 1
+
+    nvcv.set_cache_limit(items=0)
+    assert nvcv.cache_size() == 0
+    assert nvcv.cache_stats()["bytes"] == 0
+
+
+def test_cache_limit_invalid():
+    with t.raises(ValueError):
+        nvcv.set_cache_limit(bytes=-1)
+    with t.raises(ValueError):
+        nvcv.set_cache_limit(items=-1)
+
+
+def test_cache_reuse_with_many_items_alive():
+    # The free item is found even among lots of alive items with the same key
+    alive = [nvcv.Tensor((16, 16), np.uint8) for _ in range(2000)]
+    assert nvcv.cache_size() == 2000
+
+    before = nvcv.cache_stats()
+    for _ in range(2000):
+        tensor = nvcv.Tensor((16, 16), np.uint8)
+        del tensor
+
+    # Only the first one is created, the others reuse it
+    assert delta(before, nvcv.cache_stats()) == {
+        "hits": 1999,
+        "misses": 1,
+        "evictions": 0,
+    }
+    assert nvcv.cache_size() == 2001
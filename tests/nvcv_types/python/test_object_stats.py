@@ -0,0 +1,48 @@
+# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import nvcv
+import numpy as np
+
+
+def test_object_stats_keys():
+    stats = nvcv.object_stats()
+    for kind in ("images", "image_batches", "tensors", "tensor_batches", "arrays", "allocators"):
+        assert set(stats[kind]) == {"live", "peak", "capacity", "pool_growths"}
+        assert 0 <= stats[kind]["live"] <= stats[kind]["peak"]
+        assert stats[kind]["live"] <= stats[kind]["capacity"]
+    for kind in ("host_mem", "host_pinned_mem", "cuda_mem"):
+        assert set(stats[kind]) == {"bytes", "peak_bytes", "allocs"}
+        assert 0 <= stats[kind]["bytes"] <= stats[kind]["peak_bytes"]
+
+
+def test_object_stats_count_tensors():
+    nvcv.clear_cache()
+    before = nvcv.object_stats()
+
+    tensors = [nvcv.Tensor((16, 32 + i), np.uint8) for i in range(3)]
+    stats = nvcv.object_stats()
+    assert stats["tensors"]["live"] == before["tensors"]["live"] + 3
+    assert stats["tensors"]["peak"] >= before["tensors"]["live"] + 3
+    assert stats["cuda_mem"]["bytes"] >= before["cuda_mem"]["bytes"] + 3 * 16 * 32
+    assert stats["cuda_mem"]["allocs"] >= before["cuda_mem"]["allocs"] + 3
+
+    # Cached tensors are still alive until the cache is cleared
+    del tensors
+    nvcv.clear_cache()
+    stats = nvcv.object_stats()
+    assert stats["tensors"]["live"] == before["tensors"]["live"]
+    assert stats["cuda_mem"]["bytes"] == before["cuda_mem"]["bytes"]
@@ -17,6 +17,7 @@ import torch
 import nvcv
 import ctypes
 import pytest as t
+import threading
 
 
 def test_current_stream():
@@ -47,6 +48,36 @@ def test_nested_streams():
         assert stream1 is nvcv.cuda.Stream.current
 
 
+def test_current_stream_is_per_thread():
+    main_stream = nvcv.cuda.Stream()
+    ready = threading.Barrier(2)
+    seen = {}
+
+    def worker():
+        # Streams activated by other threads don't affect this one
+        ready.wait()
+        seen["initial"] = nvcv.cuda.Stream.current
+        stream = nvcv.cuda.Stream()
+        with stream:
+            seen["inside"] = nvcv.cuda.Stream.current is stream
+            ready.wait()
+            ready.wait()
+
+    thread = threading.Thread(target=worker)
+    thread.start()
+    with main_stream:
+        ready.wait()
+        # Worker is inside its own stream context now
+        ready.wait()
+        assert nvcv.cuda.Stream.current is main_stream
+        ready.wait()
+    thread.join()
+
+    assert seen["initial"] is nvcv.cuda.Stream.default
+    assert seen["inside"]
+    assert nvcv.cuda.Stream.current is nvcv.cuda.Stream.default
+
+
 def test_wrap_stream_voidp():
     stream = torch.cuda.Stream()
 
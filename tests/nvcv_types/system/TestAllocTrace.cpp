@@ -0,0 +1,349 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <alloctrace/AllocTrace.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/alloc/Allocator.hpp>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace trace = nvcv::alloctrace;
+
+namespace {
+
+// Temporary file removed when going out of scope
+class TempFile
+{
+public:
+    TempFile()
+    {
+        char name[] = "/tmp/nvcv_alloc_trace_XXXXXX";
+        int  fd     = mkstemp(name);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Cannot create temporary file");
+        }
+        close(fd);
+        m_path = name;
+    }
+
+    ~TempFile()
+    {
+        std::remove(m_path.c_str());
+    }
+
+    const std::string &path() const
+    {
+        return m_path;
+    }
+
+private:
+    std::string m_path;
+};
+
+trace::AllocTraceRecord Alloc(uint64_t ptr, int64_t size, int32_t align = 1,
+                              NVCVResourceType resType = NVCV_RESOURCE_MEM_HOST)
+{
+    return {0, ptr, size, align, 0, trace::AllocTraceOp::ALLOC, static_cast<uint8_t>(resType)};
+}
+
+trace::AllocTraceRecord Free(uint64_t ptr, int64_t size, int32_t align = 1,
+                             NVCVResourceType resType = NVCV_RESOURCE_MEM_HOST)
+{
+    return {0, ptr, size, align, 0, trace::AllocTraceOp::FREE, static_cast<uint8_t>(resType)};
+}
+
+} // namespace
+
+TEST(AllocTrace, records_allocations_of_traced_allocator)
+{
+    TempFile        file;
+    nvcv::Allocator alloc = trace::CreateHostOnlyAllocator();
+
+    void *host = nullptr, *pinned = nullptr, *cuda = nullptr;
+
+    alloc.setTraceFile(file.path().c_str());
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorAllocHostMemory(alloc.handle(), &host, 256, 64));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorAllocHostPinnedMemory(alloc.handle(), &pinned, 512, 256));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorAllocCudaMemory(alloc.handle(), &cuda, 1024, 256));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeCudaMemory(alloc.handle(), cuda, 1024, 256));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeHostMemory(alloc.handle(), host, 256, 64));
+    alloc.setTraceFile(nullptr);
+
+    // Not traced anymore
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeHostPinnedMemory(alloc.handle(), pinned, 512, 256));
+
+    std::vector<trace::AllocTraceRecord> records = trace::ReadAllocTrace(file.path());
+    ASSERT_EQ(5, records.size());
+
+    struct Expected
+    {
+        trace::AllocTraceOp op;
+        NVCVResourceType    resType;
+        void               *ptr;
+        int64_t             size;
+        int32_t             align;
+    };
+
+    const Expected expected[] = {
+        {trace::AllocTraceOp::ALLOC,        NVCV_RESOURCE_MEM_HOST,   host,  256,  64},
+        {trace::AllocTraceOp::ALLOC, NVCV_RESOURCE_MEM_HOST_PINNED, pinned,  512, 256},
+        {trace::AllocTraceOp::ALLOC,        NVCV_RESOURCE_MEM_CUDA,   cuda, 1024, 256},
+        { trace::AllocTraceOp::FREE,        NVCV_RESOURCE_MEM_CUDA,   cuda, 1024, 256},
+        { trace::AllocTraceOp::FREE,        NVCV_RESOURCE_MEM_HOST,   host,  256,  64},
+    };
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(expected[i].op, records[i].op) << i;
+        EXPECT_EQ(expected[i].resType, records[i].resType) << i;
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(expected[i].ptr), records[i].ptr) << i;
+        EXPECT_EQ(expected[i].size, records[i].size) << i;
+        EXPECT_EQ(expected[i].align, records[i].align) << i;
+        EXPECT_EQ(records[0].thread, records[i].thread) << i;
+        if (i > 0)
+        {
+            EXPECT_LE(records[i - 1].time, records[i].time) << i;
+        }
+    }
+}
+
+TEST(AllocTrace, forwarded_allocations_are_recorded_once)
+{
+    TempFile file;
+
+    // Resources that aren't customized are forwarded to the default allocator
+    nvcv::CustomAllocator<> alloc;
+    alloc.setTraceFile(file.path().c_str());
+
+    {
+        nvcv::Tensor tensor(nvcv::TensorShape({4, 16}, nvcv::TENSOR_NONE), nvcv::TYPE_U8, {}, alloc);
+    }
+
+    alloc.setTraceFile(nullptr);
+
+    std::vector<trace::AllocTraceRecord> records = trace::ReadAllocTrace(file.path());
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ(trace::AllocTraceOp::ALLOC, records[0].op);
+    EXPECT_EQ(trace::AllocTraceOp::FREE, records[1].op);
+    EXPECT_EQ(NVCV_RESOURCE_MEM_CUDA, records[0].resType);
+    EXPECT_EQ(records[0].ptr, records[1].ptr);
+    EXPECT_LE(4 * 16, records[0].size);
+}
+
+TEST(AllocTrace, default_allocator_can_be_traced)
+{
+    TempFile file;
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorSetTraceFile(nullptr, file.path().c_str()));
+    {
+        nvcv::Tensor tensor(nvcv::TensorShape({4, 16}, nvcv::TENSOR_NONE), nvcv::TYPE_U8);
+    }
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorSetTraceFile(nullptr, nullptr));
+
+    std::vector<trace::AllocTraceRecord> records = trace::ReadAllocTrace(file.path());
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ(NVCV_RESOURCE_MEM_CUDA, records[0].resType);
+    EXPECT_EQ(records[0].ptr, records[1].ptr);
+}
+
+TEST(AllocTrace, invalid_trace_file)
+{
+    NVCV_EXPECT_STATUS(NVCV_ERROR_INVALID_ARGUMENT,
+                       nvcvAllocatorSetTraceFile(nullptr, "/tmp/nvcv_dir_does_not_exist/trace"));
+
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, trace::ReadAllocTrace("/tmp/nvcv_trace_does_not_exist"));
+
+    TempFile file;
+    {
+        std::ofstream out(file.path(), std::ios::binary);
+        out << "not an allocation trace";
+    }
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, trace::ReadAllocTrace(file.path()));
+}
+
+TEST(AllocTrace, invalid_records_are_rejected)
+{
+    auto writeTrace = [](const std::string &path, const trace::AllocTraceRecord &rec)
+    {
+        trace::AllocTraceHeader hdr = {};
+        memcpy(hdr.magic, trace::AllocTraceHeader::MAGIC, sizeof(hdr.magic));
+        hdr.version    = trace::AllocTraceHeader::VERSION;
+        hdr.recordSize = sizeof(trace::AllocTraceRecord);
+
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char *>(&hdr), sizeof(hdr));
+        out.write(reinterpret_cast<const char *>(&rec), sizeof(rec));
+    };
+
+    TempFile file;
+
+    writeTrace(file.path(), Alloc(0x1000, 64, 16));
+    EXPECT_EQ(1, trace::ReadAllocTrace(file.path()).size());
+
+    writeTrace(file.path(), Alloc(0x1000, 64, 0));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, trace::ReadAllocTrace(file.path()));
+
+    writeTrace(file.path(), Free(0x1000, 64, -16));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, trace::ReadAllocTrace(file.path()));
+
+    writeTrace(file.path(), Alloc(0x1000, 64, 24));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, trace::ReadAllocTrace(file.path()));
+
+    writeTrace(file.path(), Alloc(0x1000, -1, 16));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, trace::ReadAllocTrace(file.path()));
+
+    writeTrace(file.path(), Alloc(0x1000, 64, 16, static_cast<NVCVResourceType>(NVCV_NUM_RESOURCE_TYPES)));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, trace::ReadAllocTrace(file.path()));
+}
+
+TEST(AllocTrace, incomplete_last_record_is_ignored)
+{
+    TempFile file;
+
+    nvcv::Allocator alloc = trace::CreateHostOnlyAllocator();
+    alloc.setTraceFile(file.path().c_str());
+    void *ptr = alloc.hostMem().alloc(64);
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeHostMemory(alloc.handle(), ptr, 64, 64));
+    alloc.setTraceFile(nullptr);
+
+    ASSERT_EQ(1, trace::ReadAllocTrace(file.path()).size());
+
+    ASSERT_EQ(0, truncate(file.path().c_str(), sizeof(trace::AllocTraceHeader) + sizeof(trace::AllocTraceRecord) - 1));
+    EXPECT_EQ(0, trace::ReadAllocTrace(file.path()).size());
+}
+
+TEST(AllocTrace, analyze_peaks_and_fragmentation)
+{
+    // The hole left by the first buffer is too small for the third one
+    std::vector<trace::AllocTraceRecord> records = {
+        Alloc(0x1000, 100), Alloc(0x2000, 100), Free(0x1000, 100), Alloc(0x3000, 150),
+        Free(0x4000, 10),   Free(0x3000, 150),
+    };
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        records[i].time = i * 1000;
+    }
+
+    trace::AllocTraceReport report = trace::AnalyzeAllocTrace(records);
+    EXPECT_EQ(5000, report.duration);
+    EXPECT_EQ(1, report.numThreads);
+
+    const trace::AllocTraceStats &s = report.resources[NVCV_RESOURCE_MEM_HOST];
+    EXPECT_EQ(3, s.numAllocs);
+    EXPECT_EQ(2, s.numFrees);
+    EXPECT_EQ(1, s.unmatchedFrees);
+    EXPECT_EQ(1, s.leakedAllocs);
+    EXPECT_EQ(100, s.leakedBytes);
+    EXPECT_EQ(350, s.totalBytes);
+    EXPECT_EQ(250, s.peakBytes);
+    EXPECT_EQ(2, s.peakAllocs);
+    EXPECT_EQ(350, s.peakFootprint);
+    EXPECT_DOUBLE_EQ(1 - 250.0 / 350, s.fragmentation);
+    EXPECT_DOUBLE_EQ(2000 * 1e-9, s.meanLifetime);
+    EXPECT_DOUBLE_EQ((128 + 128 + 256 - 350) / 350.0, s.pow2Waste);
+
+    ASSERT_EQ(2, s.sizeClasses.size());
+    EXPECT_EQ(100, s.sizeClasses[0].size);
+    EXPECT_EQ(2, s.sizeClasses[0].numAllocs);
+    EXPECT_EQ(2, s.sizeClasses[0].peakLive);
+    EXPECT_EQ(150, s.sizeClasses[1].size);
+    EXPECT_EQ(1, s.sizeClasses[1].numAllocs);
+    EXPECT_EQ(1, s.sizeClasses[1].peakLive);
+    EXPECT_EQ(0, s.sizeClassWaste);
+
+    EXPECT_EQ(0, report.resources[NVCV_RESOURCE_MEM_CUDA].numAllocs);
+    EXPECT_EQ(0, report.resources[NVCV_RESOURCE_MEM_CUDA].sizeClasses.size());
+}
+
+TEST(AllocTrace, analyze_reuses_coalesced_blocks)
+{
+    std::vector<trace::AllocTraceRecord> records = {
+        Alloc(0x1000, 100), Alloc(0x2000, 100), Alloc(0x3000, 100),
+        Free(0x1000, 100),  Free(0x2000, 100),  Alloc(0x4000, 200),
+    };
+
+    const trace::AllocTraceStats &s = trace::AnalyzeAllocTrace(records).resources[NVCV_RESOURCE_MEM_HOST];
+    EXPECT_EQ(300, s.peakBytes);
+    EXPECT_EQ(300, s.peakFootprint);
+    EXPECT_EQ(0, s.fragmentation);
+}
+
+TEST(AllocTrace, analyze_respects_alignment)
+{
+    std::vector<trace::AllocTraceRecord> records = {
+        Alloc(0x1000, 1, 1, NVCV_RESOURCE_MEM_CUDA),
+        Alloc(0x2000, 256, 256, NVCV_RESOURCE_MEM_CUDA),
+        Alloc(0x3000, 2, 2, NVCV_RESOURCE_MEM_CUDA),
+    };
+
+    const trace::AllocTraceStats &s = trace::AnalyzeAllocTrace(records).resources[NVCV_RESOURCE_MEM_CUDA];
+    // The third buffer fits in the padding before the second
+    EXPECT_EQ(512, s.peakFootprint);
+    EXPECT_EQ(259, s.peakBytes);
+}
+
+TEST(AllocTrace, analyze_limits_size_classes)
+{
+    std::vector<trace::AllocTraceRecord> records;
+    for (int i = 1; i <= 1000; ++i)
+    {
+        records.push_back(Alloc(i, i * 8));
+    }
+
+    const trace::AllocTraceStats &s = trace::AnalyzeAllocTrace(records, 4).resources[NVCV_RESOURCE_MEM_HOST];
+    ASSERT_EQ(4, s.sizeClasses.size());
+    EXPECT_EQ(8000, s.sizeClasses.back().size);
+
+    int64_t numAllocs = 0;
+    for (size_t i = 0; i < s.sizeClasses.size(); ++i)
+    {
+        numAllocs += s.sizeClasses[i].numAllocs;
+        EXPECT_EQ(s.sizeClasses[i].numAllocs, s.sizeClasses[i].peakLive);
+        if (i > 0)
+        {
+            EXPECT_LT(s.sizeClasses[i - 1].size, s.sizeClasses[i].size);
+        }
+    }
+    EXPECT_EQ(1000, numAllocs);
+    EXPECT_LT(s.sizeClassWaste, s.pow2Waste);
+}
+
+TEST(AllocTrace, replay_with_host_only_allocator)
+{
+    std::vector<trace::AllocTraceRecord> records = {
+        Alloc(0x1000, 1024, 256, NVCV_RESOURCE_MEM_CUDA),
+        Alloc(0x2000, 64, 64, NVCV_RESOURCE_MEM_HOST_PINNED),
+        Alloc(0x1000, 256, 64, NVCV_RESOURCE_MEM_HOST),
+        Free(0x1000, 1024, 256, NVCV_RESOURCE_MEM_CUDA),
+        Free(0x5000, 8, 8, NVCV_RESOURCE_MEM_HOST),
+    };
+
+    trace::AllocTraceReplay result = trace::ReplayAllocTrace(records, trace::CreateHostOnlyAllocator());
+    EXPECT_EQ(3, result.numAllocs);
+    EXPECT_EQ(1, result.numFrees);
+    EXPECT_EQ(1, result.skippedFrees);
+    EXPECT_EQ(2, result.leakedAllocs);
+    EXPECT_LE(0, result.elapsed);
+}
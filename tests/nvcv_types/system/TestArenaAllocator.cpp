@@ -0,0 +1,248 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv/Array.hpp>
+#include <nvcv/Config.h>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/Tensor.hpp>
+#include <nvcv/alloc/Allocator.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+// Blocks allocated by the parent allocator, all memory types are served from host memory
+struct Block
+{
+    void   *ptr;
+    int64_t size;
+    int32_t align;
+};
+
+std::vector<Block> g_blocks;
+int                g_numFrees;
+
+void *ParentAlloc(int64_t size, int32_t align)
+{
+    void *ptr = std::aligned_alloc(align, size);
+    g_blocks.push_back({ptr, size, align});
+    return ptr;
+}
+
+void ParentFree(void *ptr, int64_t, int32_t)
+{
+    ++g_numFrees;
+    std::free(ptr);
+}
+
+class ArenaAllocatorTests : public ::testing::Test
+{
+protected:
+    nvcv::Allocator parent = nvcv::CreateCustomAllocator(nvcv::CustomHostMemAllocator(&ParentAlloc, &ParentFree),
+                                                         nvcv::CustomHostPinnedMemAllocator(&ParentAlloc, &ParentFree),
+                                                         nvcv::CustomCudaMemAllocator(&ParentAlloc, &ParentFree));
+
+    void SetUp() override
+    {
+        g_blocks.clear();
+        g_numFrees = 0;
+    }
+
+    static bool IsInBlock(const void *ptr, int64_t size)
+    {
+        for (const Block &blk : g_blocks)
+        {
+            auto *base = static_cast<const std::byte *>(blk.ptr);
+            auto *p    = static_cast<const std::byte *>(ptr);
+            if (base <= p && p + size <= base + blk.size)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+TEST_F(ArenaAllocatorTests, one_allocation_per_memory_type)
+{
+    nvcv::TensorShape shape{{2, 17, 33, 3}, nvcv::TENSOR_NHWC};
+
+    nvcv::Requirements reqs;
+    for (int i = 0; i < 8; ++i)
+    {
+        reqs += nvcv::Requirements(nvcv::Tensor::CalcRequirements(shape, nvcv::TYPE_U8).mem);
+    }
+    reqs += nvcv::Requirements(nvcv::ImageBatchVarShape::CalcRequirements(10).mem);
+    reqs += nvcv::Requirements(nvcv::Array::CalcRequirements(100, nvcv::TYPE_F32).mem);
+
+    nvcv::ArenaAllocator arena(reqs, parent);
+
+    // cuda and host memory, the batch is the only one that needs host memory
+    ASSERT_EQ(2, g_blocks.size());
+
+    std::vector<nvcv::Tensor> tensors;
+    for (int i = 0; i < 8; ++i)
+    {
+        tensors.emplace_back(shape, nvcv::TYPE_U8, nvcv::MemAlignment{}, arena);
+
+        auto data = tensors.back().exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_TRUE(data);
+        EXPECT_TRUE(IsInBlock(data->basePtr(), data->stride(0) * data->shape(0)));
+    }
+    nvcv::ImageBatchVarShape batch(10, arena);
+    nvcv::Array              array(100, nvcv::TYPE_F32, 0, NVCV_RESOURCE_MEM_CUDA, arena);
+
+    auto arrayData = array.exportData<nvcv::ArrayDataCuda>();
+    ASSERT_TRUE(arrayData);
+    EXPECT_TRUE(IsInBlock(arrayData->basePtr(), arrayData->stride() * arrayData->capacity()));
+
+    EXPECT_EQ(2, g_blocks.size());
+
+    // The arena is full
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_OUT_OF_MEMORY, nvcv::Tensor(shape, nvcv::TYPE_U8, nvcv::MemAlignment{}, arena));
+}
+
+TEST_F(ArenaAllocatorTests, blocks_live_until_last_object_is_destroyed)
+{
+    nvcv::TensorShape shape{{4, 4}, "HW"};
+
+    nvcv::Requirements reqs;
+    reqs += nvcv::Requirements(nvcv::Tensor::CalcRequirements(shape, nvcv::TYPE_U8).mem);
+    reqs += nvcv::Requirements(nvcv::Tensor::CalcRequirements(shape, nvcv::TYPE_U8).mem);
+
+    nvcv::Tensor a, b;
+    {
+        nvcv::ArenaAllocator arena(reqs, parent);
+        a = nvcv::Tensor(shape, nvcv::TYPE_U8, nvcv::MemAlignment{}, arena);
+        b = nvcv::Tensor(shape, nvcv::TYPE_U8, nvcv::MemAlignment{}, arena);
+        EXPECT_EQ(3, arena.refCount());
+    }
+    ASSERT_EQ(1, g_blocks.size());
+
+    a.reset();
+    EXPECT_EQ(0, g_numFrees);
+
+    // Memory of destroyed objects isn't reused, but can still be written to
+    auto data = b.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(data);
+    std::fill_n(data->basePtr(), data->stride(0) * data->shape(0), nvcv::Byte{0xAB});
+
+    b.reset();
+    EXPECT_EQ(1, g_numFrees);
+}
+
+TEST_F(ArenaAllocatorTests, objects_fit_in_any_order)
+{
+    // Buffers with different alignments, summed in one order and constructed in the other
+    nvcv::TensorShape small{{3, 5}, "HW"};
+    nvcv::TensorShape large{{37, 100}, "HW"};
+    auto              align64   = nvcv::MemAlignment{}.baseAddr(64).rowAddr(1);
+    auto              align1024 = nvcv::MemAlignment{}.baseAddr(1024).rowAddr(1);
+
+    nvcv::Requirements reqs;
+    reqs += nvcv::Requirements(nvcv::Tensor::CalcRequirements(small, nvcv::TYPE_U8, align64).mem);
+    reqs += nvcv::Requirements(nvcv::Tensor::CalcRequirements(large, nvcv::TYPE_U8, align1024).mem);
+    reqs += nvcv::Requirements(nvcv::Tensor::CalcRequirements(small, nvcv::TYPE_U8, align64).mem);
+
+    nvcv::ArenaAllocator arena(reqs, parent);
+    ASSERT_EQ(1, g_blocks.size());
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(g_blocks[0].ptr) % 1024);
+
+    std::vector<std::pair<nvcv::Tensor, int>> tensors;
+    tensors.emplace_back(nvcv::Tensor(small, nvcv::TYPE_U8, align64, arena), 64);
+    tensors.emplace_back(nvcv::Tensor(small, nvcv::TYPE_U8, align64, arena), 64);
+    tensors.emplace_back(nvcv::Tensor(large, nvcv::TYPE_U8, align1024, arena), 1024);
+
+    for (const auto &[tensor, align] : tensors)
+    {
+        auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_TRUE(data);
+        EXPECT_TRUE(IsInBlock(data->basePtr(), data->stride(0) * data->shape(0)));
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(data->basePtr()) % align);
+    }
+
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_OUT_OF_MEMORY, nvcv::Tensor(small, nvcv::TYPE_U8, align64, arena));
+}
+
+TEST_F(ArenaAllocatorTests, host_tensors)
+{
+    nvcv::TensorShape shape{{8, 8}, "HW"};
+
+    // Tensor requirements are given in cuda memory, they must be moved to host memory
+    NVCVTensorRequirements tensorReqs = nvcv::Tensor::CalcRequirements(shape, nvcv::TYPE_U16);
+    int64_t                size       = 0;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvMemRequirementsCalcTotalSizeBytes(&tensorReqs.mem.cudaMem, &size));
+
+    nvcv::Requirements reqs;
+    reqs.hostMem().addBuffer(size, tensorReqs.alignBytes);
+
+    nvcv::ArenaAllocator arena(reqs, parent);
+    ASSERT_EQ(1, g_blocks.size());
+
+    nvcv::Tensor tensor(shape, nvcv::TYPE_U16, NVCV_RESOURCE_MEM_HOST, nvcv::MemAlignment{}, arena);
+    auto         data = tensor.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(g_blocks[0].ptr, data->basePtr());
+
+    // No room for cuda memory
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_OUT_OF_MEMORY, nvcv::Tensor(shape, nvcv::TYPE_U16, nvcv::MemAlignment{}, arena));
+}
+
+TEST_F(ArenaAllocatorTests, allocations_are_counted_once)
+{
+    nvcv::Requirements reqs;
+    reqs.hostMem().addBuffer(4096, 64);
+
+    NVCVObjectStats before;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvGetObjectStats(&before));
+
+    nvcv::ArenaAllocator arena(reqs, parent);
+
+    void *ptr = nullptr;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorAllocHostMemory(arena.handle(), &ptr, 1024, 64));
+    EXPECT_TRUE(IsInBlock(ptr, 1024));
+
+    NVCVObjectStats stats;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvGetObjectStats(&stats));
+    EXPECT_EQ(1024, stats.hostMem.bytesInUse - before.hostMem.bytesInUse);
+    EXPECT_EQ(1, stats.hostMem.numAllocs - before.hostMem.numAllocs);
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeHostMemory(arena.handle(), ptr, 1024, 64));
+}
+
+TEST_F(ArenaAllocatorTests, invalid_arguments)
+{
+    NVCVRequirements    reqs;
+    NVCVAllocatorHandle handle;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvRequirementsInit(&reqs));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructArena(nullptr, nullptr, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructArena(&reqs, nullptr, nullptr));
+
+    // Empty arena with the default allocator as parent
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorConstructArena(&reqs, nullptr, &handle));
+    void *ptr = nullptr;
+    EXPECT_EQ(NVCV_ERROR_OUT_OF_MEMORY, nvcvAllocatorAllocCudaMemory(handle, &ptr, 256, 256));
+    int newRefCount = -1;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorDecRef(handle, &newRefCount));
+    EXPECT_EQ(0, newRefCount);
+}
@@ -120,3 +120,150 @@ TYPED_TEST(ConfigTests, cant_change_limits_when_objects_are_alive)
 
     ASSERT_NO_THROW(SetMaxCount<TypeParam>(5));
 }
+
+TEST(ConfigHostMemPoolTests, can_toggle_pool_with_live_objects)
+{
+    // Image batches allocate their host buffers from the default allocator
+    nvcv::ImageBatchVarShape before(32);
+
+    ASSERT_NO_THROW(nvcv::cfg::SetMaxHostMemPoolSize(1 << 20));
+
+    std::vector<nvcv::ImageBatchVarShape> objs;
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_NO_THROW(objs.emplace_back(32 * (i + 1)));
+    }
+    before.reset();
+    objs.resize(5);
+
+    ASSERT_NO_THROW(nvcv::cfg::SetMaxHostMemPoolSize(-1));
+
+    objs.clear();
+    ASSERT_NO_THROW(objs.emplace_back(32));
+}
+
+template<class T>
+NVCVObjectCounts GetObjectCounts(const NVCVObjectStats &stats)
+{
+    if constexpr (std::is_same_v<nvcv::Image, T>)
+    {
+        return stats.images;
+    }
+    else if constexpr (std::is_same_v<nvcv::ImageBatch, T>)
+    {
+        return stats.imageBatches;
+    }
+    else if constexpr (std::is_same_v<nvcv::Allocator, T>)
+    {
+        return stats.allocators;
+    }
+    else if constexpr (std::is_same_v<nvcv::Tensor, T>)
+    {
+        return stats.tensors;
+    }
+    else
+    {
+        static_assert(sizeof(T) != 0 && "Invalid core object type");
+    }
+}
+
+TYPED_TEST(ConfigTests, object_stats_track_live_and_peak_counts)
+{
+    NVCVObjectCounts before = GetObjectCounts<TypeParam>(nvcv::cfg::GetObjectStats());
+
+    {
+        std::vector<TypeParam> objs;
+        for (int i = 0; i < 3; ++i)
+        {
+            objs.emplace_back(CreateObj<TypeParam>());
+        }
+
+        NVCVObjectCounts counts = GetObjectCounts<TypeParam>(nvcv::cfg::GetObjectStats());
+        EXPECT_EQ(before.liveCount + 3, counts.liveCount);
+        EXPECT_LE(before.liveCount + 3, counts.peakCount);
+        EXPECT_LE(counts.liveCount, counts.capacity);
+    }
+
+    NVCVObjectCounts after = GetObjectCounts<TypeParam>(nvcv::cfg::GetObjectStats());
+    EXPECT_EQ(before.liveCount, after.liveCount);
+    EXPECT_LE(before.liveCount + 3, after.peakCount);
+}
+
+TYPED_TEST(ConfigTests, object_stats_report_fixed_capacity)
+{
+    NVCVObjectCounts before = GetObjectCounts<TypeParam>(nvcv::cfg::GetObjectStats());
+
+    ASSERT_NO_THROW(SetMaxCount<TypeParam>(5));
+
+    NVCVObjectCounts counts = GetObjectCounts<TypeParam>(nvcv::cfg::GetObjectStats());
+    EXPECT_EQ(5, counts.capacity);
+    EXPECT_EQ(before.poolGrowths + 1, counts.poolGrowths);
+
+    // Setting the same limit again doesn't reallocate
+    ASSERT_NO_THROW(SetMaxCount<TypeParam>(5));
+    EXPECT_EQ(counts.poolGrowths, GetObjectCounts<TypeParam>(nvcv::cfg::GetObjectStats()).poolGrowths);
+
+    ASSERT_NO_THROW(SetMaxCount<TypeParam>(0));
+    EXPECT_EQ(0, GetObjectCounts<TypeParam>(nvcv::cfg::GetObjectStats()).capacity);
+    NVCV_ASSERT_STATUS(NVCV_ERROR_OUT_OF_MEMORY, CreateObj<TypeParam>());
+}
+
+TEST(ConfigObjectStatsTests, memory_counts_follow_allocations)
+{
+    nvcv::CustomAllocator<> alloc;
+
+    NVCVObjectStats before = nvcv::cfg::GetObjectStats();
+
+    void *ptr = alloc.hostMem().alloc(4096, 256);
+    ASSERT_NE(nullptr, ptr);
+
+    NVCVObjectStats stats = nvcv::cfg::GetObjectStats();
+    EXPECT_EQ(before.hostMem.bytesInUse + 4096, stats.hostMem.bytesInUse);
+    EXPECT_LE(before.hostMem.bytesInUse + 4096, stats.hostMem.peakBytes);
+    EXPECT_EQ(before.hostMem.numAllocs + 1, stats.hostMem.numAllocs);
+    EXPECT_EQ(before.cudaMem.bytesInUse, stats.cudaMem.bytesInUse);
+    EXPECT_EQ(before.hostPinnedMem.bytesInUse, stats.hostPinnedMem.bytesInUse);
+
+    alloc.hostMem().free(ptr, 4096, 256);
+
+    stats = nvcv::cfg::GetObjectStats();
+    EXPECT_EQ(before.hostMem.bytesInUse, stats.hostMem.bytesInUse);
+    EXPECT_EQ(before.hostMem.numAllocs + 1, stats.hostMem.numAllocs);
+}
+
+TEST(ConfigObjectStatsTests, forwarded_allocations_are_counted_once)
+{
+    // Resources that aren't customized are forwarded to the default allocator
+    nvcv::CustomAllocator<> alloc;
+
+    NVCVObjectStats before = nvcv::cfg::GetObjectStats();
+
+    void *ptr = nullptr;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorAllocHostMemory(alloc.handle(), &ptr, 4096, 256));
+
+    NVCVObjectStats stats = nvcv::cfg::GetObjectStats();
+    EXPECT_EQ(before.hostMem.bytesInUse + 4096, stats.hostMem.bytesInUse);
+    EXPECT_EQ(before.hostMem.numAllocs + 1, stats.hostMem.numAllocs);
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorFreeHostMemory(alloc.handle(), ptr, 4096, 256));
+    EXPECT_EQ(before.hostMem.bytesInUse, nvcv::cfg::GetObjectStats().hostMem.bytesInUse);
+}
+
+TEST(ConfigObjectStatsTests, tensor_memory_is_counted_as_cuda_memory)
+{
+    NVCVObjectStats before = nvcv::cfg::GetObjectStats();
+
+    nvcv::Tensor tensor(nvcv::TensorShape({32, 12, 4}, nvcv::TENSOR_NONE), nvcv::TYPE_U8);
+
+    NVCVObjectStats stats = nvcv::cfg::GetObjectStats();
+    EXPECT_LE(before.cudaMem.bytesInUse + 32 * 12 * 4, stats.cudaMem.bytesInUse);
+    EXPECT_EQ(before.tensors.liveCount + 1, stats.tensors.liveCount);
+
+    tensor.reset();
+    EXPECT_EQ(before.cudaMem.bytesInUse, nvcv::cfg::GetObjectStats().cudaMem.bytesInUse);
+}
+
+TEST(ConfigObjectStatsTests, null_output_is_invalid)
+{
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvGetObjectStats(nullptr));
+}
@@ -22,6 +22,8 @@
 #include <nvcv/DataType.hpp>
 #include <nvcv/ImageFormat.hpp>
 
+#include <random>
+
 namespace t    = ::testing;
 namespace test = nvcv::test;
 
@@ -374,3 +376,70 @@ TEST_P(DataTypeAlignmentTests, works)
     ASSERT_EQ(NVCV_SUCCESS, nvcvDataTypeGetAlignment(dtype, &testAlign));
     EXPECT_EQ(goldAlign, testAlign);
 }
+
+// Header-only queries ------------------------------------
+
+static_assert(nvcv::TYPE_U8.bitsPerPixel() == 8, "");
+static_assert(nvcv::TYPE_3U8.numChannels() == 3, "");
+static_assert(nvcv::TYPE_3U8.strideBytes() == 3, "");
+static_assert(nvcv::TYPE_2F32.packing() == nvcv::Packing::X32_Y32, "");
+static_assert(nvcv::TYPE_2F32.dataKind() == nvcv::DataKind::FLOAT, "");
+static_assert(nvcv::TYPE_2C128.bitsPerPixel() == 256, "");
+static_assert(nvcv::TYPE_4C64.strideBytes() == 32, "");
+static_assert(nvcv::DataType::ConstCreate(nvcv::DataKind::UNSIGNED, nvcv::Packing::X5Y6Z5).strideBytes() == 2, "");
+
+namespace {
+
+// Checks that header-only queries give the same results as the library
+void ExpectHeaderMatchesLibrary(NVCVDataType value)
+{
+    SCOPED_TRACE(value);
+
+    nvcv::DataType type{value};
+
+    NVCVPacking packing;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvDataTypeGetPacking(value, &packing));
+    EXPECT_EQ(packing, static_cast<NVCVPacking>(type.packing()));
+
+    NVCVDataKind dataKind;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvDataTypeGetDataKind(value, &dataKind));
+    EXPECT_EQ(dataKind, static_cast<NVCVDataKind>(type.dataKind()));
+
+    int32_t bpp;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvDataTypeGetBitsPerPixel(value, &bpp));
+    EXPECT_EQ(bpp, type.bitsPerPixel());
+
+    int32_t numChannels;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvDataTypeGetNumChannels(value, &numChannels));
+    EXPECT_EQ(numChannels, type.numChannels());
+
+    int32_t strideBytes;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvDataTypeGetStrideBytes(value, &strideBytes));
+    EXPECT_EQ(strideBytes, type.strideBytes());
+}
+
+} // namespace
+
+TEST_P(DataTypeTests, header_only_queries_match_library)
+{
+    const Params &p = GetParam();
+
+    ExpectHeaderMatchesLibrary(p.dtype);
+
+    nvcv::DataType type{p.dtype};
+    EXPECT_EQ(p.bpp, type.bitsPerPixel());
+    EXPECT_EQ(p.channels, type.numChannels());
+}
+
+TEST(DataTypeTests, header_only_queries_match_library_random)
+{
+    std::mt19937_64 rng(321);
+    for (int i = 0; i < 10000; ++i)
+    {
+        ExpectHeaderMatchesLibrary(rng());
+        if (HasFailure())
+        {
+            break;
+        }
+    }
+}
@@ -22,6 +22,8 @@
 
 #include <nvcv/Fwd.hpp>
 
+#include <vector>
+
 TEST(Image, smoke_create)
 {
     nvcv::Image img({163, 117}, nvcv::FMT_RGBA8);
@@ -269,6 +271,113 @@ TEST(ImageWrapData, smoke_cleanup)
     EXPECT_EQ(1, cleanupCalled) << "Cleanup must have been called when img got destroyed";
 }
 
+TEST(ImageWrapData, smoke_create_many)
+{
+    std::vector<nvcv::ImageData> data;
+    for (int i = 0; i < 100; ++i)
+    {
+        nvcv::ImageDataStridedCuda::Buffer buf;
+        buf.numPlanes           = 1;
+        buf.planes[0].width     = 10 + i;
+        buf.planes[0].height    = 20 + i;
+        buf.planes[0].rowStride = 190;
+        buf.planes[0].basePtr   = reinterpret_cast<NVCVByte *>(678 + i);
+        data.push_back(nvcv::ImageDataStridedCuda{nvcv::FMT_U8, buf});
+    }
+
+    std::vector<nvcv::Image> images = nvcv::ImageWrapDataMany(data.data(), data.size());
+    ASSERT_EQ(data.size(), images.size());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_NE(nullptr, images[i].handle());
+        EXPECT_EQ(nvcv::Size2D(10 + i, 20 + i), images[i].size());
+        EXPECT_EQ(nvcv::FMT_U8, images[i].format());
+
+        auto devdata = images[i].exportData<nvcv::ImageDataStridedCuda>();
+        ASSERT_NE(nvcv::NullOpt, devdata);
+        EXPECT_EQ(reinterpret_cast<NVCVByte *>(678 + i), devdata->plane(0).basePtr);
+    }
+
+    nvcv::ImageReleaseMany(images.data(), images.size());
+    for (const nvcv::Image &img : images)
+    {
+        EXPECT_EQ(nullptr, img.handle());
+    }
+}
+
+TEST(ImageWrapData, smoke_create_many_cleanup)
+{
+    NVCVImageData data[3] = {};
+    for (int i = 0; i < 3; ++i)
+    {
+        data[i].bufferType                        = NVCV_IMAGE_BUFFER_STRIDED_CUDA;
+        data[i].format                            = NVCV_IMAGE_FORMAT_U8;
+        data[i].buffer.strided.numPlanes          = 1;
+        data[i].buffer.strided.planes[0].width    = 16;
+        data[i].buffer.strided.planes[0].height   = 16;
+        data[i].buffer.strided.planes[0].rowStride = 16;
+        data[i].buffer.strided.planes[0].basePtr  = reinterpret_cast<NVCVByte *>(678);
+    }
+
+    int   cleanupCalled[3] = {};
+    void *ctx[3]           = {&cleanupCalled[0], &cleanupCalled[1], &cleanupCalled[2]};
+    auto  cleanup          = [](void *ctx, const NVCVImageData *)
+    {
+        ++*static_cast<int *>(ctx);
+    };
+
+    // Invalid element, no image must be created and no cleanup called
+    data[2].buffer.strided.planes[0].basePtr = nullptr;
+    NVCVImageHandle handles[3];
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageWrapDataConstructMany(3, data, cleanup, ctx, handles));
+
+    // Mismatched formats
+    data[2].buffer.strided.planes[0].basePtr = reinterpret_cast<NVCVByte *>(678);
+    data[1].format                           = NVCV_IMAGE_FORMAT_S8;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageWrapDataConstructMany(3, data, cleanup, ctx, handles));
+    EXPECT_EQ(0, cleanupCalled[0] + cleanupCalled[1] + cleanupCalled[2]);
+
+    data[1].format = NVCV_IMAGE_FORMAT_U8;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageWrapDataConstructMany(3, data, cleanup, ctx, handles));
+
+    int refCount;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageIncRef(handles[1], &refCount));
+    EXPECT_EQ(2, refCount);
+
+    int newRefCounts[3];
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageDecRefMany(3, handles, newRefCounts));
+    EXPECT_EQ(0, newRefCounts[0]);
+    EXPECT_EQ(1, newRefCounts[1]);
+    EXPECT_EQ(0, newRefCounts[2]);
+    EXPECT_EQ(1, cleanupCalled[0]);
+    EXPECT_EQ(0, cleanupCalled[1]);
+    EXPECT_EQ(1, cleanupCalled[2]);
+
+    // handles[0] is now invalid, processing stops there
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageDecRefMany(2, handles, nullptr));
+    EXPECT_EQ(0, cleanupCalled[1]);
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageDecRefMany(1, handles + 1, nullptr));
+    EXPECT_EQ(1, cleanupCalled[1]);
+
+    // The C++ version releases the images after an invalid one too
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageWrapDataConstructMany(3, data, cleanup, ctx, handles));
+    NVCVImageHandle          destroyed = handles[1];
+    std::vector<nvcv::Image> images;
+    for (NVCVImageHandle &h : handles)
+    {
+        images.emplace_back(std::move(h));
+    }
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageDecRef(destroyed, nullptr));
+
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ImageReleaseMany(images.data(), images.size()));
+    EXPECT_EQ(2, cleanupCalled[0]);
+    EXPECT_EQ(2, cleanupCalled[1]);
+    EXPECT_EQ(2, cleanupCalled[2]);
+    EXPECT_EQ(NVCV_SUCCESS, nvcvGetLastError());
+}
+
 TEST(ImageWrapData, smoke_mem_reqs)
 {
     nvcv::Image::Requirements reqs = nvcv::Image::CalcRequirements({512, 256}, nvcv::FMT_NV12);
@@ -20,6 +20,7 @@
 #include <common/ValueTests.hpp>
 #include <nvcv/ImageBatch.hpp>
 
+#include <chrono>
 #include <list>
 #include <random>
 
@@ -549,6 +550,179 @@ TEST(ImageBatchVarShape, get_overflow_index_in_handle)
               nvcvImageBatchVarShapeGetImages(batch.handle(), 1, outputHandles.data(), batch.capacity()));
 }
 
+TEST(ImageBatchVarShape, max_size_and_unique_format_follow_push_and_pop)
+{
+    nvcv::ImageBatchVarShape batch(64);
+
+    std::mt19937                  rng(42);
+    std::uniform_int_distribution rndSize(1, 64);
+    std::uniform_int_distribution rndCount(0, 8);
+
+    std::vector<nvcv::Image> gold;
+
+    auto check = [&]
+    {
+        nvcv::Size2D      maxSize = {0, 0};
+        nvcv::ImageFormat fmt     = gold.empty() ? nvcv::FMT_NONE : gold[0].format();
+        for (const nvcv::Image &img : gold)
+        {
+            maxSize.w = std::max(maxSize.w, img.size().w);
+            maxSize.h = std::max(maxSize.h, img.size().h);
+            if (img.format() != fmt)
+            {
+                fmt = nvcv::FMT_NONE;
+            }
+        }
+
+        ASSERT_EQ((int)gold.size(), batch.numImages());
+        EXPECT_EQ(maxSize, batch.maxSize());
+        EXPECT_EQ(fmt, batch.uniqueFormat());
+
+        auto devdata = batch.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(0);
+        ASSERT_NE(nvcv::NullOpt, devdata);
+        EXPECT_EQ(maxSize, devdata->maxSize());
+        EXPECT_EQ(fmt, devdata->uniqueFormat());
+    };
+
+    for (int iter = 0; iter < 200; ++iter)
+    {
+        if (rng() % 2)
+        {
+            int count = std::min<int>(rndCount(rng), batch.capacity() - gold.size());
+            for (int i = 0; i < count; ++i)
+            {
+                // Mostly the same format, so that the unique format comes and goes
+                gold.emplace_back(nvcv::Size2D{rndSize(rng) * 2, rndSize(rng) * 2},
+                                  rng() % 16 ? nvcv::FMT_NV12 : nvcv::FMT_RGBA8);
+                batch.pushBack(gold.back());
+            }
+        }
+        else
+        {
+            int count = std::min<int>(rndCount(rng), gold.size());
+            batch.popBack(count);
+            gold.erase(gold.end() - count, gold.end());
+        }
+
+        ASSERT_NO_FATAL_FAILURE(check());
+    }
+
+    // A push that fails midway leaves the batch as it was
+    std::vector<NVCVImageHandle> cbHandles;
+
+    auto cb = [&]() -> nvcv::Image
+    {
+        // Only the first image is larger than the current ones, the rest are kept tiny
+        nvcv::Image img(cbHandles.empty() ? nvcv::Size2D{256, 256} : nvcv::Size2D{2, 2}, nvcv::FMT_RGBA8);
+        cbHandles.push_back(img.handle());
+        return img;
+    };
+    auto *pcb = &cb;
+    auto  ccb = [](void *ctx) -> NVCVImageHandle
+    {
+        return nvcv::detail::GetImageHandleForPushBack((*decltype(pcb)(ctx))());
+    };
+
+    EXPECT_EQ(NVCV_ERROR_OVERFLOW, nvcvImageBatchVarShapePushImagesCallback(batch.handle(), ccb, pcb));
+    ASSERT_NO_FATAL_FAILURE(check());
+
+    for (auto imgHandle : cbHandles)
+    {
+        nvcvImageDecRef(imgHandle, nullptr);
+    }
+
+    batch.clear();
+    gold.clear();
+    ASSERT_NO_FATAL_FAILURE(check());
+}
+
+TEST(ImageBatchVarShape, slice)
+{
+    nvcv::ImageBatchVarShape batch(8);
+
+    std::vector<nvcv::Image> images;
+    for (int i = 0; i < 6; ++i)
+    {
+        images.emplace_back(nvcv::Size2D{16 + i * 2, 8 + i * 2}, i == 4 ? nvcv::FMT_U8 : nvcv::FMT_RGBA8);
+    }
+    batch.pushBack(images.begin(), images.end());
+
+    nvcv::ImageBatchVarShape sub = batch.slice(1, 3);
+    ASSERT_EQ(3, sub.numImages());
+    EXPECT_EQ(3, sub.capacity());
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(images[i + 1].handle(), sub[i].handle());
+    }
+    EXPECT_EQ((nvcv::Size2D{22, 14}), sub.maxSize());
+    EXPECT_EQ(nvcv::FMT_RGBA8, sub.uniqueFormat());
+
+    auto subdata = sub.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(0);
+    ASSERT_NE(nvcv::NullOpt, subdata);
+    EXPECT_EQ((nvcv::Size2D{22, 14}), subdata->maxSize());
+
+    // The slice holds its own references, the images outlive the parent batch
+    int refCount;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageRefCount(images[2].handle(), &refCount));
+    EXPECT_EQ(3, refCount);
+    batch.clear();
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageRefCount(images[2].handle(), &refCount));
+    EXPECT_EQ(2, refCount);
+    EXPECT_EQ(images[3].handle(), sub[2].handle());
+
+    EXPECT_EQ(0, sub.slice(3, 0).numImages());
+
+    NVCVImageBatchHandle out;
+    EXPECT_EQ(NVCV_ERROR_OVERFLOW, nvcvImageBatchVarShapeSlice(sub.handle(), 1, 3, &out));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeSlice(sub.handle(), -1, 1, &out));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeSlice(sub.handle(), 0, -1, &out));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeSlice(sub.handle(), 0, 1, nullptr));
+
+    // Failed slices don't leak references
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageRefCount(images[2].handle(), &refCount));
+    EXPECT_EQ(2, refCount);
+}
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(ImageBatchVarShape, DISABLED_benchmark_max_size_after_push_pop)
+{
+    // Operators query the max size and unique format at every call. Measure
+    // that when the batch is modified by one image between calls.
+    const int kIters = 10000;
+
+    nvcv::Image big({1920, 1080}, nvcv::FMT_RGB8);
+
+    for (int batchSize = 1; batchSize <= 4096; batchSize *= 4)
+    {
+        nvcv::ImageBatchVarShape batch(batchSize + 1);
+
+        std::vector<nvcv::Image> images;
+        for (int i = 0; i < batchSize; ++i)
+        {
+            images.emplace_back(nvcv::Size2D{64 + i % 7, 64 + i % 5}, nvcv::FMT_RGB8);
+        }
+        batch.pushBack(images.begin(), images.end());
+
+        int64_t sum = 0;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < kIters; ++i)
+        {
+            // Popping the current max is the worst case
+            batch.pushBack(big);
+            sum += batch.maxSize().w + batch.uniqueFormat().numPlanes();
+            batch.popBack();
+            sum += batch.maxSize().w + batch.uniqueFormat().numPlanes();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        EXPECT_EQ(kIters * (1920 + 64 + std::min(batchSize - 1, 6) + 2), sum);
+
+        std::cout << "batch size " << batchSize << ": "
+                  << std::chrono::duration<double, std::nano>(end - start).count() / kIters << "ns/iter" << std::endl;
+    }
+}
+
 TEST(ImageBatch, smoke_user_pointer)
 {
     nvcv::ImageBatchVarShape batch(3);
@@ -24,6 +24,10 @@
 #include <util/Compiler.hpp>
 #include <util/Size.hpp>
 
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <random>
 #include <unordered_set>
 
 namespace t    = ::testing;
@@ -2580,6 +2584,115 @@ TEST(ImageFormatFourCCTests, invalid_fourcc_returns_invalid_imageformat)
               nvcvMakeImageFormatFromFourCC(&fmt, FCC('R', 'O', 'D', 'S'), NVCV_COLOR_SPEC_BT601, NVCV_MEM_LAYOUT_PL));
 }
 
+// All fourcc codes supported by nvcvMakeImageFormatFromFourCC
+static const FCC g_KnownFourCC[] = {
+    FCC{'R', 'G', 'B', '1'},
+    FCC{'R', '4', '4', '4'},
+    FCC{'R', 'G', 'B', '0'},
+    FCC{'R', 'G', 'B', 'P'},
+    FCC{'R', 'G', 'B', 'Q'},
+    FCC{'R', 'G', 'B', 'R'},
+    FCC{'B', 'G', 'R', '3'},
+    FCC{'R', 'G', 'B', '3'},
+    FCC{'B', 'G', 'R', '4'},
+    FCC{'R', 'G', 'B', '4'},
+    FCC{'B', 'A', '8', '1'},
+    FCC{'A', 'Y', 'U', 'V'},
+    FCC{'G', 'R', 'A', 'Y'},
+    FCC{'Y', '8', ' ', ' '},
+    FCC{'Y', '8', '0', '0'},
+    FCC{'Y', '1', '6', ' '},
+    FCC{'U', 'Y', 'V', 'Y'},
+    FCC{'Y', 'U', 'Y', '2'},
+    FCC{'Y', 'U', 'Y', 'V'},
+    FCC{'Y', 'U', 'N', 'V'},
+    FCC{'Y', 'V', 'Y', 'U'},
+    FCC{'I', '4', '2', '0'},
+    FCC{'I', 'Y', 'U', 'V'},
+    FCC{'N', 'V', '1', '2'},
+    FCC{'N', 'V', '2', '1'},
+    FCC{'Y', 'V', '1', '2'},
+    FCC{'Y', 'V', '1', '6'},
+};
+
+TEST(ImageFormatFourCCTests, all_known_fourcc_round_trip)
+{
+    for (FCC fourcc : g_KnownFourCC)
+    {
+        NVCVImageFormat fmt;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvMakeImageFormatFromFourCC(&fmt, fourcc, NVCV_COLOR_SPEC_BT601, NVCV_MEM_LAYOUT_PL))
+            << fourcc;
+
+        // Codes are case insensitive
+        NVCVImageFormat fmtLower;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvMakeImageFormatFromFourCC(&fmtLower, fourcc | 0x20202020u, NVCV_COLOR_SPEC_BT601,
+                                                              NVCV_MEM_LAYOUT_PL))
+            << fourcc;
+        EXPECT_EQ(fmt, fmtLower) << fourcc;
+
+        // Formats with several codes give back the first one, which must map to the same format.
+        uint32_t back;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatToFourCC(fmt, &back)) << fourcc;
+
+        NVCVImageFormat fmtBack;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvMakeImageFormatFromFourCC(&fmtBack, back, NVCV_COLOR_SPEC_BT601, NVCV_MEM_LAYOUT_PL))
+            << fourcc;
+        EXPECT_EQ(fmt, fmtBack) << fourcc << " -> " << FCC{back};
+    }
+}
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(ImageFormatFourCCTests, DISABLED_benchmark_fourcc_lookup)
+{
+    const int kIters = 100000;
+
+    NVCVImageFormat formats[std::size(g_KnownFourCC)];
+
+    uint64_t sum   = 0;
+    auto     start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIters; ++i)
+    {
+        for (size_t j = 0; j < std::size(g_KnownFourCC); ++j)
+        {
+            nvcvMakeImageFormatFromFourCC(&formats[j], g_KnownFourCC[j], NVCV_COLOR_SPEC_BT709, NVCV_MEM_LAYOUT_PL);
+            sum += formats[j];
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "fourcc -> format: "
+              << std::chrono::duration<double, std::nano>(end - start).count() / kIters / std::size(g_KnownFourCC)
+              << "ns/call" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIters; ++i)
+    {
+        for (NVCVImageFormat fmt : formats)
+        {
+            uint32_t fourcc;
+            nvcvImageFormatToFourCC(fmt, &fourcc);
+            sum += fourcc;
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "format -> fourcc: "
+              << std::chrono::duration<double, std::nano>(end - start).count() / kIters / std::size(g_KnownFourCC)
+              << "ns/call" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIters; ++i)
+    {
+        sum += nvcvImageFormatGetName(NVCV_IMAGE_FORMAT_NV12)[0] + nvcvImageFormatGetName(NVCV_IMAGE_FORMAT_RGBA8)[0];
+    }
+    end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "predefined format name: "
+              << std::chrono::duration<double, std::nano>(end - start).count() / kIters / 2 << "ns/call" << std::endl;
+
+    EXPECT_NE(0u, sum);
+}
+
 class ImageFormatPlanePixelStrideBytesExecTests
     : public t::TestWithParam<std::tuple<test::Param<"fmt", NVCVImageFormat>, test::Param<"plane", int>,
                                          test::Param<"goldStrideBytes", int>>>
@@ -2613,3 +2726,104 @@ TEST_P(ImageFormatPlanePixelStrideBytesExecTests, works)
     ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetPlanePixelStrideBytes(dtype, plane, &testStride));
     EXPECT_EQ(goldStride, testStride);
 }
+
+// Header-only queries ------------------------------------
+
+// These are evaluated at compile time, without calling into the library
+static_assert(nvcv::FMT_NV12.numPlanes() == 2, "");
+static_assert(nvcv::FMT_RGBA8p.numPlanes() == 4, "");
+static_assert(nvcv::FMT_NONE.numPlanes() == 0, "");
+static_assert(nvcv::FMT_NV12.planePacking(1) == nvcv::Packing::X8_Y8, "");
+static_assert(nvcv::FMT_NV12.planePacking(2) == nvcv::Packing::NONE, "");
+static_assert(nvcv::FMT_RGB8.planeBitsPerPixel(0) == 24, "");
+static_assert(nvcv::FMT_RGB8.planeNumChannels(0) == 3, "");
+static_assert(nvcv::FMT_YUYV.planeNumChannels(0) == 3, "");
+static_assert(nvcv::FMT_YUYV.planeBitsPerPixel(0) == 16, "");
+static_assert(nvcv::FMT_YUYV.planePixelStrideBytes(0) == 2, "");
+static_assert(nvcv::FMT_NV12.planePixelStrideBytes(1) == 2, "");
+static_assert(nvcv::FMT_RGBf32.dataKind() == nvcv::DataKind::FLOAT, "");
+static_assert(nvcv::FMT_RGBf32.planePixelStrideBytes(0) == 12, "");
+static_assert(nvcv::FMT_U8_BL.memLayout() == nvcv::MemLayout::BLOCK_LINEAR, "");
+static_assert(nvcv::FMT_RGBA8.swizzle() == nvcv::Swizzle::S_XYZW, "");
+static_assert(nvcv::FMT_RGBA8.alphaType() == nvcv::AlphaType::ASSOCIATED, "");
+
+namespace {
+
+// Checks that header-only queries give the same results as the library
+void ExpectHeaderMatchesLibrary(NVCVImageFormat value)
+{
+    SCOPED_TRACE(value);
+
+    nvcv::ImageFormat fmt{value};
+
+    int32_t numPlanes;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetNumPlanes(value, &numPlanes));
+    EXPECT_EQ(numPlanes, fmt.numPlanes());
+
+    NVCVDataKind dataKind;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetDataKind(value, &dataKind));
+    EXPECT_EQ(dataKind, static_cast<NVCVDataKind>(fmt.dataKind()));
+
+    NVCVMemLayout memLayout;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetMemLayout(value, &memLayout));
+    EXPECT_EQ(memLayout, static_cast<NVCVMemLayout>(fmt.memLayout()));
+
+    NVCVSwizzle swizzle;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetSwizzle(value, &swizzle));
+    EXPECT_EQ(swizzle, static_cast<NVCVSwizzle>(fmt.swizzle()));
+
+    NVCVAlphaType alphaType;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetAlphaType(value, &alphaType));
+    EXPECT_EQ(alphaType, static_cast<NVCVAlphaType>(fmt.alphaType()));
+
+    for (int plane = -1; plane <= 4; ++plane)
+    {
+        SCOPED_TRACE(plane);
+
+        NVCVPacking packing;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetPlanePacking(value, plane, &packing));
+        EXPECT_EQ(packing, static_cast<NVCVPacking>(fmt.planePacking(plane)));
+
+        int32_t bpp;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetPlaneBitsPerPixel(value, plane, &bpp));
+        EXPECT_EQ(bpp, fmt.planeBitsPerPixel(plane));
+
+        int32_t numChannels;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetPlaneNumChannels(value, plane, &numChannels));
+        EXPECT_EQ(numChannels, fmt.planeNumChannels(plane));
+
+        int32_t strideBytes;
+        ASSERT_EQ(NVCV_SUCCESS, nvcvImageFormatGetPlanePixelStrideBytes(value, plane, &strideBytes));
+        EXPECT_EQ(strideBytes, fmt.planePixelStrideBytes(plane));
+    }
+}
+
+} // namespace
+
+TEST_P(ImageFormatTests, header_only_queries_match_library)
+{
+    const Params &p = GetParam();
+
+    ExpectHeaderMatchesLibrary(p.imgFormat);
+
+    nvcv::ImageFormat fmt{p.imgFormat};
+    EXPECT_EQ(p.planeCount, fmt.numPlanes());
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(p.planes[i].bpp, fmt.planeBitsPerPixel(i));
+        EXPECT_EQ(p.planes[i].channels, fmt.planeNumChannels(i));
+    }
+}
+
+TEST(ImageFormatTests, header_only_queries_match_library_random)
+{
+    std::mt19937_64 rng(123);
+    for (int i = 0; i < 10000; ++i)
+    {
+        ExpectHeaderMatchesLibrary(rng());
+        if (HasFailure())
+        {
+            break;
+        }
+    }
+}
@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv/Tensor.hpp>
+#include <unistd.h>
+#include <util/MappedTensor.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace util = nvcv::util;
+
+namespace {
+
+// Temporary file removed when going out of scope
+class TempFile
+{
+public:
+    TempFile()
+    {
+        char name[] = "/tmp/nvcv_mapped_tensor_XXXXXX";
+        int  fd     = mkstemp(name);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Cannot create temporary file");
+        }
+        close(fd);
+        m_path = name;
+    }
+
+    ~TempFile()
+    {
+        std::remove(m_path.c_str());
+    }
+
+    const std::string &path() const
+    {
+        return m_path;
+    }
+
+private:
+    std::string m_path;
+};
+
+// NHWC RGB8 tensor in host memory with padded rows, filled with a pattern
+struct HostImages
+{
+    static constexpr int N = 3, H = 5, W = 7, C = 3, ROW_STRIDE = 32;
+
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(N * H * ROW_STRIDE);
+
+    HostImages()
+    {
+        for (size_t i = 0; i < buffer.size(); ++i)
+        {
+            buffer[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+    }
+
+    nvcv::TensorDataStridedHost data()
+    {
+        nvcv::TensorDataStridedHost::Buffer buf;
+        buf.strides[0] = H * ROW_STRIDE;
+        buf.strides[1] = ROW_STRIDE;
+        buf.strides[2] = C;
+        buf.strides[3] = 1;
+        buf.basePtr    = reinterpret_cast<NVCVByte *>(buffer.data());
+        return nvcv::TensorDataStridedHost(nvcv::TensorShape{{N, H, W, C}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8, buf);
+    }
+
+    uint8_t at(int n, int y, int x, int c) const
+    {
+        return buffer[n * H * ROW_STRIDE + y * ROW_STRIDE + x * C + c];
+    }
+};
+
+} // namespace
+
+TEST(MappedTensor, round_trip)
+{
+    HostImages src;
+    TempFile   file;
+    ASSERT_NO_THROW(util::WriteMappedTensor(file.path(), src.data()));
+
+    util::MappedTensor mapped(file.path());
+
+    const nvcv::TensorDataStridedHost &data = mapped.data();
+    EXPECT_EQ(nvcv::TensorShape({HostImages::N, HostImages::H, HostImages::W, HostImages::C}, nvcv::TENSOR_NHWC),
+              data.shape());
+    EXPECT_EQ(nvcv::TYPE_U8, data.dtype());
+    EXPECT_EQ(HostImages::N, mapped.numSamples());
+
+    // Contents are stored packed, and page-aligned by default
+    EXPECT_EQ(1, data.stride(3));
+    EXPECT_EQ(HostImages::C, data.stride(2));
+    EXPECT_EQ(HostImages::W * HostImages::C, data.stride(1));
+    EXPECT_EQ(HostImages::H * HostImages::W * HostImages::C, data.stride(0));
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(data.basePtr()) % 4096);
+
+    for (int n = 0; n < HostImages::N; ++n)
+        for (int y = 0; y < HostImages::H; ++y)
+            for (int x = 0; x < HostImages::W; ++x)
+                for (int c = 0; c < HostImages::C; ++c)
+                {
+                    const nvcv::Byte *p
+                        = data.basePtr() + n * data.stride(0) + y * data.stride(1) + x * data.stride(2) + c;
+                    ASSERT_EQ(src.at(n, y, x, c), static_cast<uint8_t>(*p)) << n << ',' << y << ',' << x << ',' << c;
+                }
+}
+
+TEST(MappedTensor, custom_alignment)
+{
+    HostImages src;
+    TempFile   file;
+    ASSERT_NO_THROW(util::WriteMappedTensor(file.path(), src.data(), 512));
+
+    util::MappedTensorHeader hdr;
+    std::ifstream            in(file.path(), std::ios::binary);
+    ASSERT_TRUE(in.read(reinterpret_cast<char *>(&hdr), sizeof(hdr)));
+    EXPECT_EQ(512, hdr.alignment);
+    EXPECT_EQ(512, hdr.dataOffset);
+    EXPECT_EQ(HostImages::N * HostImages::H * HostImages::W * HostImages::C, hdr.dataSize);
+    EXPECT_STREQ("NHWC", hdr.layout);
+
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::WriteMappedTensor(file.path(), src.data(), 12));
+}
+
+TEST(MappedTensor, tensor_outlives_mapping)
+{
+    HostImages src;
+    TempFile   file;
+    util::WriteMappedTensor(file.path(), src.data());
+
+    nvcv::Tensor tensor;
+    {
+        util::MappedTensor mapped(file.path());
+        tensor = mapped.tensor();
+    }
+
+    auto data = tensor.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(nvcv::TENSOR_NHWC, tensor.layout());
+    EXPECT_EQ(src.at(2, 4, 6, 2), static_cast<uint8_t>(data->basePtr()[data->stride(0) * 3 - 1]));
+}
+
+TEST(MappedTensor, image_data)
+{
+    HostImages src;
+    TempFile   file;
+    util::WriteMappedTensor(file.path(), src.data());
+
+    util::MappedTensor mapped(file.path());
+
+    nvcv::ImageDataStridedHost img = mapped.imageData(nvcv::FMT_RGB8, 1);
+    EXPECT_EQ(nvcv::FMT_RGB8, img.format());
+    ASSERT_EQ(1, img.numPlanes());
+    EXPECT_EQ(HostImages::W, img.plane(0).width);
+    EXPECT_EQ(HostImages::H, img.plane(0).height);
+    EXPECT_EQ(HostImages::W * HostImages::C, img.plane(0).rowStride);
+    EXPECT_EQ(src.at(1, 2, 3, 1), img.plane(0).basePtr[2 * img.plane(0).rowStride + 3 * 3 + 1].value);
+
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, mapped.imageData(nvcv::FMT_RGBA8, 0));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, mapped.imageData(nvcv::FMT_RGB8p, 0));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, mapped.imageData(nvcv::FMT_RGB8, 3));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, mapped.imageData(nvcv::FMT_RGB8, -1));
+}
+
+TEST(MappedTensor, advise)
+{
+    HostImages src;
+    TempFile   file;
+    util::WriteMappedTensor(file.path(), src.data());
+
+    util::MappedTensor mapped(file.path());
+    EXPECT_NO_THROW(mapped.advise(util::MappedTensor::Advice::SEQUENTIAL));
+    EXPECT_NO_THROW(mapped.advise(util::MappedTensor::Advice::RANDOM, 1, 2));
+    EXPECT_NO_THROW(mapped.prefetch(1, 1));
+    // Ranges are clamped to the existing samples
+    EXPECT_NO_THROW(mapped.prefetch(2, 10));
+    EXPECT_NO_THROW(mapped.prefetch(5, 1));
+    EXPECT_NO_THROW(mapped.advise(util::MappedTensor::Advice::NORMAL));
+}
+
+TEST(MappedTensor, invalid_files)
+{
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INTERNAL, util::MappedTensor("/tmp/nvcv_mapped_tensor_does_not_exist"));
+
+    TempFile file;
+    {
+        std::ofstream out(file.path(), std::ios::binary);
+        out << "not a tensor";
+    }
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+
+    HostImages src;
+    util::WriteMappedTensor(file.path(), src.data());
+
+    util::MappedTensorHeader hdr;
+    {
+        std::ifstream in(file.path(), std::ios::binary);
+        in.read(reinterpret_cast<char *>(&hdr), sizeof(hdr));
+    }
+
+    auto writeHeader = [&](const util::MappedTensorHeader &h)
+    {
+        std::fstream io(file.path(), std::ios::binary | std::ios::in | std::ios::out);
+        io.write(reinterpret_cast<const char *>(&h), sizeof(h));
+    };
+
+    util::MappedTensorHeader bad = hdr;
+    bad.magic[0]                 = 'X';
+    writeHeader(bad);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+
+    bad         = hdr;
+    bad.version = 2;
+    writeHeader(bad);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+
+    bad          = hdr;
+    bad.shape[0] = 4;
+    writeHeader(bad);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+
+    bad      = hdr;
+    bad.rank = 3;
+    writeHeader(bad);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+
+    // Extents that overflow mustn't wrap around into bounds
+    bad            = hdr;
+    bad.shape[0]   = 2;
+    bad.strides[0] = std::numeric_limits<int64_t>::max();
+    writeHeader(bad);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+
+    bad            = hdr;
+    bad.shape[1]   = int64_t(1) << 32;
+    bad.strides[1] = int64_t(1) << 32;
+    writeHeader(bad);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+
+    // Truncated contents
+    writeHeader(hdr);
+    ASSERT_EQ(0, truncate(file.path().c_str(), hdr.dataOffset + hdr.dataSize - 1));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, util::MappedTensor(file.path()));
+}
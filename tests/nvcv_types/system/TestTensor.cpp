@@ -24,6 +24,8 @@
 #include <nvcv/TensorDataAccess.hpp>
 #include <nvcv/alloc/Allocator.hpp>
 
+#include <cstdlib>
+#include <cstring>
 #include <list>
 #include <random>
 #include <vector>
@@ -338,6 +340,348 @@ TEST(TensorWrapData, smoke_create)
               accessRef->sampleData(3, accessRef->planeData(1)));
 }
 
+TEST(TensorWrapData, smoke_create_many)
+{
+    std::vector<nvcv::TensorData> data;
+    for (int i = 0; i < 100; ++i)
+    {
+        NVCVTensorBufferStrided buf = {};
+        buf.strides[0]              = (i + 1) * 3 * 4;
+        buf.strides[1]              = 3 * 4;
+        buf.strides[2]              = 4;
+        buf.basePtr                 = reinterpret_cast<NVCVByte *>(0xDEADBEEF + i);
+
+        data.push_back(nvcv::TensorDataStridedCuda(nvcv::TensorShape{{10, i + 1, 3}, "HWC"}, nvcv::TYPE_F32, buf));
+    }
+
+    std::vector<nvcv::Tensor> tensors = nvcv::TensorWrapDataMany(data.data(), data.size());
+    ASSERT_EQ(data.size(), tensors.size());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_NE(nullptr, tensors[i].handle());
+        EXPECT_EQ((nvcv::TensorShape{{10, i + 1, 3}, "HWC"}), tensors[i].shape());
+        EXPECT_EQ(nvcv::TYPE_F32, tensors[i].dtype());
+
+        auto tdata = tensors[i].exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_NE(nvcv::NullOpt, tdata);
+        EXPECT_EQ(reinterpret_cast<NVCVByte *>(0xDEADBEEF + i), (NVCVByte *)tdata->basePtr());
+    }
+
+    nvcv::TensorReleaseMany(tensors.data(), tensors.size());
+    for (const nvcv::Tensor &t : tensors)
+    {
+        EXPECT_EQ(nullptr, t.handle());
+    }
+}
+
+TEST(TensorWrapData, smoke_create_many_cleanup)
+{
+    NVCVTensorData data[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        NVCVTensorBufferStrided buf = {};
+        buf.strides[0]              = 5;
+        buf.strides[1]              = 1;
+        buf.basePtr                 = reinterpret_cast<NVCVByte *>(0xDEADBEEF);
+
+        data[i] = nvcv::TensorDataStridedCuda(nvcv::TensorShape{{10, 5}, "HW"}, nvcv::TYPE_U8, buf).cdata();
+    }
+
+    int   cleanupCalled[3] = {};
+    void *ctx[3]           = {&cleanupCalled[0], &cleanupCalled[1], &cleanupCalled[2]};
+    auto  cleanup          = [](void *ctx, const NVCVTensorData *)
+    {
+        ++*static_cast<int *>(ctx);
+    };
+
+    NVCVTensorHandle handles[3];
+
+    // Invalid element, no tensor must be created and no cleanup called
+    data[2].buffer.strided.strides[0] = 4;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorWrapDataConstructMany(3, data, cleanup, ctx, handles));
+
+    // Mismatched data types
+    data[2].buffer.strided.strides[0] = 5;
+    data[1].dtype                     = NVCV_DATA_TYPE_S8;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorWrapDataConstructMany(3, data, cleanup, ctx, handles));
+    EXPECT_EQ(0, cleanupCalled[0] + cleanupCalled[1] + cleanupCalled[2]);
+
+    data[1].dtype = NVCV_DATA_TYPE_U8;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorWrapDataConstructMany(3, data, cleanup, ctx, handles));
+
+    int refCount;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorIncRef(handles[1], &refCount));
+    EXPECT_EQ(2, refCount);
+
+    int newRefCounts[3];
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorDecRefMany(3, handles, newRefCounts));
+    EXPECT_EQ(0, newRefCounts[0]);
+    EXPECT_EQ(1, newRefCounts[1]);
+    EXPECT_EQ(0, newRefCounts[2]);
+    EXPECT_EQ(1, cleanupCalled[0]);
+    EXPECT_EQ(0, cleanupCalled[1]);
+    EXPECT_EQ(1, cleanupCalled[2]);
+
+    // handles[0] is now invalid, processing stops there
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorDecRefMany(2, handles, nullptr));
+    EXPECT_EQ(0, cleanupCalled[1]);
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorDecRefMany(1, handles + 1, nullptr));
+    EXPECT_EQ(1, cleanupCalled[1]);
+
+    // The C++ version releases the tensors after an invalid one too
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorWrapDataConstructMany(3, data, cleanup, ctx, handles));
+    NVCVTensorHandle          destroyed = handles[1];
+    std::vector<nvcv::Tensor> tensors;
+    for (NVCVTensorHandle &h : handles)
+    {
+        tensors.emplace_back(std::move(h));
+    }
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorDecRef(destroyed, nullptr));
+
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, nvcv::TensorReleaseMany(tensors.data(), tensors.size()));
+    EXPECT_EQ(2, cleanupCalled[0]);
+    EXPECT_EQ(2, cleanupCalled[1]);
+    EXPECT_EQ(2, cleanupCalled[2]);
+    EXPECT_EQ(NVCV_SUCCESS, nvcvGetLastError());
+
+    EXPECT_EQ(NVCV_SUCCESS, nvcvTensorWrapDataConstructMany(0, nullptr, nullptr, nullptr, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorWrapDataConstructMany(-1, data, nullptr, nullptr, handles));
+}
+
+class TensorHostTests : public t::TestWithParam<test::Param<"target", NVCVResourceType>>
+{
+};
+
+NVCV_INSTANTIATE_TEST_SUITE_P(_, TensorHostTests,
+                              test::ValueList<NVCVResourceType>{NVCV_RESOURCE_MEM_HOST, NVCV_RESOURCE_MEM_HOST_PINNED});
+
+TEST_P(TensorHostTests, smoke_create)
+{
+    const NVCVResourceType PARAM_TARGET = GetParam();
+
+    nvcv::Tensor tensor(nvcv::TensorShape{{3, 17, 23, 4}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8, PARAM_TARGET);
+    ASSERT_NE(nullptr, tensor.handle());
+
+    EXPECT_EQ(nvcv::NullOpt, tensor.exportData<nvcv::TensorDataStridedCuda>());
+
+    auto hostdata = tensor.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, hostdata);
+    EXPECT_EQ(NVCV_TENSOR_BUFFER_STRIDED_HOST, hostdata->cdata().bufferType);
+    ASSERT_TRUE(tensor.exportData<nvcv::TensorDataStrided>());
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*hostdata);
+    ASSERT_TRUE(access);
+    EXPECT_EQ(3, access->numSamples());
+    EXPECT_EQ(17, access->numRows());
+    EXPECT_EQ(23, access->numCols());
+    EXPECT_EQ(4, access->numChannels());
+
+    // Contents must be directly accessible from host
+    for (int s = 0; s < access->numSamples(); ++s)
+    {
+        for (int y = 0; y < access->numRows(); ++y)
+        {
+            std::memset(access->rowData(y, access->sampleData(s)), s + y, access->numCols() * access->colStride());
+        }
+    }
+    EXPECT_EQ(2 + 5, static_cast<int>(*access->rowData(5, access->sampleData(2))));
+
+    // Wrapping the exported data doesn't change the buffer type
+    auto wrapped = nvcv::TensorWrapData(*hostdata);
+    auto wrapdata = wrapped.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, wrapdata);
+    EXPECT_EQ(hostdata->basePtr(), wrapdata->basePtr());
+
+    // Reshaping keeps it too
+    auto reshaped = tensor.reshape(nvcv::TensorShape{{3 * 17, 23 * 4}, "HW"});
+    auto reshdata = reshaped.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, reshdata);
+    EXPECT_EQ(hostdata->basePtr(), reshdata->basePtr());
+}
+
+TEST_P(TensorHostTests, smoke_create_allocator)
+{
+    const NVCVResourceType PARAM_TARGET = GetParam();
+
+    int64_t hostBufLen = 0, pinnedBufLen = 0, cudaBufLen = 0;
+
+    auto allocFn = [](int64_t &len)
+    {
+        return [&len](int64_t size, int32_t bufAlign)
+        {
+            len = size;
+            return std::aligned_alloc(bufAlign, (size + bufAlign - 1) / bufAlign * bufAlign);
+        };
+    };
+    auto freeFn = []
+    {
+        return [](void *ptr, int64_t, int32_t)
+        {
+            std::free(ptr);
+        };
+    };
+
+    nvcv::CustomAllocator myAlloc{
+        nvcv::CustomHostMemAllocator{allocFn(hostBufLen), freeFn()},
+        nvcv::CustomHostPinnedMemAllocator{allocFn(pinnedBufLen), freeFn()},
+        nvcv::CustomCudaMemAllocator{allocFn(cudaBufLen), freeFn()},
+    };
+
+    nvcv::Tensor::Requirements reqs
+        = nvcv::Tensor::CalcRequirements(nvcv::TensorShape{{7, 5}, "HW"}, nvcv::TYPE_F32, nvcv::MemAlignment{}.rowAddr(1));
+
+    {
+        nvcv::Tensor tensor(reqs, PARAM_TARGET, myAlloc);
+
+        auto hostdata = tensor.exportData<nvcv::TensorDataStridedHost>();
+        ASSERT_NE(nvcv::NullOpt, hostdata);
+        EXPECT_EQ(5 * 4, hostdata->stride(0));
+        EXPECT_EQ(4, hostdata->stride(1));
+    }
+
+    EXPECT_EQ(0, cudaBufLen);
+    if (PARAM_TARGET == NVCV_RESOURCE_MEM_HOST)
+    {
+        EXPECT_LE(7 * 5 * 4, hostBufLen);
+        EXPECT_EQ(0, pinnedBufLen);
+    }
+    else
+    {
+        EXPECT_LE(7 * 5 * 4, pinnedBufLen);
+        EXPECT_EQ(0, hostBufLen);
+    }
+}
+
+TEST(Tensor, construct_with_invalid_target)
+{
+    NVCVTensorRequirements reqs;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorCalcRequirementsForImages(1, 16, 16, NVCV_IMAGE_FORMAT_U8, 0, 0, &reqs));
+
+    NVCVTensorHandle handle;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvTensorConstructWithTarget(&reqs, nullptr, static_cast<NVCVResourceType>(-1), &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvTensorConstructWithTarget(nullptr, nullptr, NVCV_RESOURCE_MEM_HOST, &handle));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorConstructWithTarget(&reqs, nullptr, NVCV_RESOURCE_MEM_HOST, nullptr));
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorConstructWithTarget(&reqs, nullptr, NVCV_RESOURCE_MEM_CUDA, &handle));
+    nvcv::Tensor tensor(std::move(handle));
+    EXPECT_NE(nvcv::NullOpt, tensor.exportData<nvcv::TensorDataStridedCuda>());
+}
+
+TEST(TensorWrapData, smoke_create_host)
+{
+    std::vector<float> buffer(10 * 6 * 3);
+
+    NVCVTensorBufferStrided buf = {};
+    buf.strides[0]              = 6 * 3 * sizeof(float);
+    buf.strides[1]              = 3 * sizeof(float);
+    buf.strides[2]              = sizeof(float);
+    buf.basePtr                 = reinterpret_cast<NVCVByte *>(buffer.data());
+
+    nvcv::TensorDataStridedHost tdata(nvcv::TensorShape{{10, 5, 3}, "HWC"}, nvcv::TYPE_F32, buf);
+    EXPECT_EQ(NVCV_TENSOR_BUFFER_STRIDED_HOST, tdata.cdata().bufferType);
+    EXPECT_FALSE(tdata.IsCompatible<nvcv::TensorDataStridedCuda>());
+    EXPECT_THROW(nvcv::TensorDataStridedCuda{tdata.cdata()}, nvcv::Exception);
+
+    auto tensor = nvcv::TensorWrapData(tdata);
+
+    auto hostdata = tensor.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, hostdata);
+    EXPECT_EQ(reinterpret_cast<nvcv::Byte *>(buffer.data()), hostdata->basePtr());
+
+    auto access = nvcv::TensorDataAccessStridedImage::Create(*hostdata);
+    ASSERT_TRUE(access);
+    EXPECT_EQ(5, access->numCols());
+    EXPECT_EQ(6 * 3 * sizeof(float), access->rowStride());
+
+    // Strides are validated as for cuda buffers
+    NVCVTensorData bad = tdata.cdata();
+    bad.buffer.strided.strides[1] = 2 * sizeof(float);
+    NVCVTensorHandle handle;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorWrapDataConstruct(&bad, nullptr, nullptr, &handle));
+
+    // Host and cuda buffers can't be mixed when wrapping many
+    NVCVTensorData   many[2] = {tdata.cdata(), tdata.cdata()};
+    NVCVTensorHandle handles[2];
+    many[1].bufferType = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorWrapDataConstructMany(2, many, nullptr, nullptr, handles));
+}
+
+TEST(Tensor, smoke_slice)
+{
+    nvcv::Tensor tensor(nvcv::TensorShape{{6, 10, 12, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+    auto         tdata = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nvcv::NullOpt, tdata);
+
+    // Sub-batch with every other sample, cropped
+    nvcv::Tensor view = tensor.slice({1, 2, 3, 0}, {6, 9, 11, 3}, {2, 3, 1, 1});
+    EXPECT_EQ((nvcv::TensorShape{{3, 3, 8, 3}, nvcv::TENSOR_NHWC}), view.shape());
+    EXPECT_EQ(nvcv::TYPE_U8, view.dtype());
+
+    auto vdata = view.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nvcv::NullOpt, vdata);
+    EXPECT_EQ(tdata->basePtr() + 1 * tdata->stride(0) + 2 * tdata->stride(1) + 3 * tdata->stride(2), vdata->basePtr());
+    EXPECT_EQ(2 * tdata->stride(0), vdata->stride(0));
+    EXPECT_EQ(3 * tdata->stride(1), vdata->stride(1));
+    EXPECT_EQ(tdata->stride(2), vdata->stride(2));
+    EXPECT_EQ(tdata->stride(3), vdata->stride(3));
+
+    // The view keeps the tensor alive
+    int refCount;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorRefCount(tensor.handle(), &refCount));
+    EXPECT_EQ(2, refCount);
+    view.reset();
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorRefCount(tensor.handle(), &refCount));
+    EXPECT_EQ(1, refCount);
+
+    // Views of views, and of host tensors
+    nvcv::Tensor hostTensor(nvcv::TensorShape{{6, 10, 12, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8,
+                            NVCV_RESOURCE_MEM_HOST);
+    nvcv::Tensor sample = hostTensor.slice({4, 0, 0, 0}, {5, 10, 12, 3}).slice({0, 5, 6, 1}, {1, 6, 7, 2});
+    EXPECT_EQ((nvcv::TensorShape{{1, 1, 1, 1}, nvcv::TENSOR_NHWC}), sample.shape());
+    auto hdata = hostTensor.exportData<nvcv::TensorDataStridedHost>();
+    auto sdata = sample.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, sdata);
+    EXPECT_EQ(hdata->basePtr() + 4 * hdata->stride(0) + 5 * hdata->stride(1) + 6 * hdata->stride(2) + 1,
+              sdata->basePtr());
+}
+
+TEST(Tensor, slice_invalid)
+{
+    nvcv::Tensor tensor(nvcv::TensorShape{{6, 10, 12, 3}, nvcv::TENSOR_NHWC}, nvcv::TYPE_U8);
+
+    // Packed dimensions (W and C) can't be strided
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({0, 0, 0, 0}, {6, 10, 12, 3}, {1, 1, 2, 1}));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({0, 0, 0, 0}, {6, 10, 12, 3}, {1, 1, 1, 2}));
+    // ... unless only one element is taken
+    EXPECT_EQ((nvcv::TensorShape{{6, 10, 1, 3}, nvcv::TENSOR_NHWC}),
+              tensor.slice({0, 0, 4, 0}, {6, 10, 5, 3}, {1, 1, 2, 1}).shape());
+
+    // Empty or out of bounds ranges
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({0, 0, 0, 0}, {6, 10, 12, 4}));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({0, 5, 0, 0}, {6, 5, 12, 3}));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({-1, 0, 0, 0}, {6, 10, 12, 3}));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({0, 0, 0, 0}, {6, 10, 12, 3}, {0, 1, 1, 1}));
+
+    // Rank mismatch
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({0, 0, 0}, {6, 10, 12}));
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tensor.slice({0, 0, 0, 0}, {6, 10, 12, 3}, {1, 1}));
+
+    NVCVTensorHandle out;
+    int64_t          begin[4] = {0, 0, 0, 0}, end[4] = {6, 10, 12, 3};
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(tensor.handle(), 4, nullptr, end, nullptr, &out));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(tensor.handle(), 4, begin, end, nullptr, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorSlice(nullptr, 4, begin, end, nullptr, &out));
+
+    // No references are leaked by the failures
+    int refCount;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvTensorRefCount(tensor.handle(), &refCount));
+    EXPECT_EQ(1, refCount);
+}
+
 class TensorWrapImageTests
     : public t::TestWithParam<
           std::tuple<test::Param<"size", nvcv::Size2D>, test::Param<"format", nvcv::ImageFormat>,
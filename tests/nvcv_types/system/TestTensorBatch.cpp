@@ -159,6 +159,16 @@ TEST(TensorBatch, consistency_validation)
     test_inconsistency(3, nvcv::TYPE_U8, nvcv::TensorLayout("HWC"));
 }
 
+TEST(TensorBatch, rejects_host_tensors)
+{
+    auto              reqs = nvcv::TensorBatch::CalcRequirements(2);
+    nvcv::TensorBatch tb(reqs);
+
+    nvcv::Tensor hostTensor(nvcv::TensorShape{{4, 4, 3}, "HWC"}, nvcv::TYPE_U8, NVCV_RESOURCE_MEM_HOST);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tb.pushBack(hostTensor));
+    EXPECT_EQ(0, tb.numTensors());
+}
+
 TEST(TensorBatch, push_in_parts)
 {
     const int32_t             iters    = 20;
@@ -465,3 +475,35 @@ TEST(TensorBatch, set_tensor)
     EXPECT_EQ(tensorA.refCount(), 4);
     EXPECT_EQ(tensorB.refCount(), 3);
 }
+
+TEST(TensorBatch, set_tensor_sparse)
+{
+    int32_t                   capacity = 1024;
+    std::vector<nvcv::Tensor> tensors(capacity);
+    for (int i = 0; i < capacity; ++i)
+    {
+        tensors[i] = nvcv::Tensor(1, {4 + i % 5, 4}, nvcv::FMT_RGB8);
+    }
+    nvcv::TensorBatch tb(capacity);
+    tb.pushBack(tensors.begin(), tensors.end());
+    auto data = tb.exportData(nullptr);
+    CheckTensorBatchData(data, tensors.begin(), tensors.end(), nullptr);
+
+    // Far apart modifications, copied as separate ranges,
+    // along with close ones, copied together.
+    for (int idx : {3, 900, 905, 1023})
+    {
+        tensors[idx] = nvcv::Tensor(1, {8, 8}, nvcv::FMT_RGB8);
+        tb.setTensor(idx, tensors[idx]);
+    }
+    data = tb.exportData(nullptr);
+    CheckTensorBatchData(data, tensors.begin(), tensors.end(), nullptr);
+
+    // Modifications past the end after a pop aren't copied
+    tensors[1000] = nvcv::Tensor(1, {8, 8}, nvcv::FMT_RGB8);
+    tb.setTensor(1000, tensors[1000]);
+    tb.popTensors(100);
+    tensors.resize(capacity - 100);
+    data = tb.exportData(nullptr);
+    CheckTensorBatchData(data, tensors.begin(), tensors.end(), nullptr);
+}
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv_types/priv/ArenaAllocator.hpp>
+#include <nvcv_types/priv/Requirements.hpp>
+#include <util/Math.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace priv = nvcv::priv;
+
+namespace {
+
+NVCVMemRequirements MakeRequirements(std::initializer_list<std::pair<int64_t, int64_t>> buffers)
+{
+    NVCVMemRequirements reqs = {};
+    for (auto [size, align] : buffers)
+    {
+        priv::AddBuffer(reqs, size, align);
+    }
+    return reqs;
+}
+
+} // namespace
+
+TEST(ArenaLayout, regions_sorted_by_alignment)
+{
+    // 2 blocks of 16 bytes, 1 block of 256 bytes, 3 blocks of 64 bytes
+    priv::ArenaLayout layout(MakeRequirements({{20, 16}, {200, 256}, {150, 64}}));
+
+    EXPECT_EQ(256, layout.alignBytes());
+    EXPECT_EQ(512, layout.sizeBytes());
+
+    EXPECT_EQ(448, layout.place(20, 16));
+    EXPECT_EQ(256, layout.place(150, 64));
+    EXPECT_EQ(0, layout.place(200, 256));
+}
+
+TEST(ArenaLayout, same_buffers_fill_block_in_any_order)
+{
+    std::vector<std::pair<int64_t, int64_t>> buffers = {{100, 1}, {4000, 1024}, {7, 8}, {64, 64}, {1, 256}};
+
+    NVCVMemRequirements reqs = {};
+    for (auto [size, align] : buffers)
+    {
+        priv::AddBuffer(reqs, size, align);
+    }
+    int64_t totalSize = priv::CalcTotalSizeBytes(reqs);
+
+    do
+    {
+        priv::ArenaLayout layout(reqs);
+        EXPECT_EQ(1024, layout.alignBytes());
+        EXPECT_EQ(nvcv::util::RoundUp(totalSize, 1024), layout.sizeBytes());
+
+        std::vector<std::pair<int64_t, int64_t>> placed;
+        for (auto [size, align] : buffers)
+        {
+            int64_t offset = layout.place(size, align);
+            ASSERT_GE(offset, 0);
+            EXPECT_EQ(0, offset % align);
+            EXPECT_LE(offset + size, totalSize);
+            for (auto [begin, end] : placed)
+            {
+                EXPECT_TRUE(offset + size <= begin || end <= offset) << "overlapping buffers";
+            }
+            placed.emplace_back(offset, offset + size);
+        }
+
+        EXPECT_EQ(-1, layout.place(1, 1));
+    }
+    while (std::next_permutation(buffers.begin(), buffers.end()));
+}
+
+TEST(ArenaLayout, full_region_uses_larger_alignment)
+{
+    priv::ArenaLayout layout(MakeRequirements({{32, 32}, {256, 256}}));
+
+    EXPECT_EQ(256, layout.place(32, 32));
+    // The 32-byte region is full, the buffer goes to the 256-byte one, which it fills
+    EXPECT_EQ(0, layout.place(32, 32));
+    EXPECT_EQ(-1, layout.place(32, 32));
+    EXPECT_EQ(-1, layout.place(256, 256));
+}
+
+TEST(ArenaLayout, empty)
+{
+    priv::ArenaLayout layout(NVCVMemRequirements{});
+
+    EXPECT_EQ(0, layout.sizeBytes());
+    EXPECT_EQ(1, layout.alignBytes());
+    EXPECT_EQ(0, layout.place(0, 1));
+    EXPECT_EQ(-1, layout.place(1, 1));
+}
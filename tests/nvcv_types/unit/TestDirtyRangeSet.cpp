@@ -0,0 +1,198 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv_types/priv/DirtyRangeSet.hpp>
+#include <nvcv_types/priv/Exception.hpp>
+
+#include <random>
+
+namespace priv = nvcv::priv;
+
+namespace nvcv::priv {
+
+static bool operator==(const DirtyRangeSet::Range &a, const DirtyRangeSet::Range &b)
+{
+    return a.begin == b.begin && a.end == b.end;
+}
+
+static std::ostream &operator<<(std::ostream &out, const DirtyRangeSet::Range &r)
+{
+    return out << '[' << r.begin << ',' << r.end << ')';
+}
+
+} // namespace nvcv::priv
+
+using Ranges = std::vector<priv::DirtyRangeSet::Range>;
+
+TEST(DirtyRangeSet, empty)
+{
+    priv::DirtyRangeSet dirty(100);
+    EXPECT_TRUE(dirty.empty());
+    EXPECT_EQ(Ranges{}, dirty.ranges());
+
+    dirty.mark(10, 10);
+    EXPECT_TRUE(dirty.empty());
+
+    // Zero-capacity sets are valid too
+    priv::DirtyRangeSet none(0);
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(Ranges{}, none.ranges());
+}
+
+TEST(DirtyRangeSet, sparse_marks_give_separate_ranges)
+{
+    priv::DirtyRangeSet dirty(1024);
+
+    dirty.mark(3, 4);
+    dirty.mark(900, 901);
+    EXPECT_FALSE(dirty.empty());
+    EXPECT_EQ((priv::DirtyRangeSet::Range{3, 901}), dirty.bounds());
+    EXPECT_EQ((Ranges{{3, 4}, {900, 901}}), dirty.ranges());
+
+    dirty.clear();
+    EXPECT_TRUE(dirty.empty());
+    EXPECT_EQ(Ranges{}, dirty.ranges());
+}
+
+TEST(DirtyRangeSet, adjacent_and_overlapping_marks_are_coalesced)
+{
+    priv::DirtyRangeSet dirty(256);
+
+    dirty.mark(10, 20);
+    dirty.mark(20, 30);
+    dirty.mark(25, 70);
+    dirty.mark(5, 12);
+    EXPECT_EQ((Ranges{{5, 70}}), dirty.ranges());
+}
+
+TEST(DirtyRangeSet, ranges_across_word_boundaries)
+{
+    priv::DirtyRangeSet dirty(300);
+
+    dirty.mark(60, 200);
+    dirty.mark(255, 257);
+    dirty.mark(299, 300);
+    EXPECT_EQ((Ranges{{60, 200}, {255, 257}, {299, 300}}), dirty.ranges());
+}
+
+TEST(DirtyRangeSet, small_gaps_are_merged)
+{
+    priv::DirtyRangeSet dirty(100, 3);
+    EXPECT_EQ(3, dirty.maxGap());
+
+    dirty.mark(0, 2);
+    dirty.mark(5, 6);   // gap of 3, merged
+    dirty.mark(10, 12); // gap of 4, not merged
+    dirty.mark(13, 14); // gap of 1, merged
+    EXPECT_EQ((Ranges{{0, 6}, {10, 14}}), dirty.ranges());
+
+    dirty.setMaxGap(0);
+    EXPECT_EQ((Ranges{{0, 2}, {5, 6}, {10, 12}, {13, 14}}), dirty.ranges());
+
+    EXPECT_THROW(dirty.setMaxGap(-1), priv::Exception);
+}
+
+TEST(DirtyRangeSet, truncate_drops_removed_elements)
+{
+    priv::DirtyRangeSet dirty(200);
+
+    dirty.mark(10, 20);
+    dirty.mark(100, 150);
+
+    dirty.truncate(120);
+    EXPECT_EQ((Ranges{{10, 20}, {100, 120}}), dirty.ranges());
+
+    dirty.truncate(50);
+    EXPECT_EQ((Ranges{{10, 20}}), dirty.ranges());
+    EXPECT_EQ(10, dirty.bounds().begin);
+    EXPECT_LE(dirty.bounds().end, 50);
+
+    dirty.truncate(5);
+    EXPECT_TRUE(dirty.empty());
+
+    // Nothing is left behind
+    dirty.mark(150, 151);
+    EXPECT_EQ((Ranges{{150, 151}}), dirty.ranges());
+}
+
+TEST(DirtyRangeSet, randomized_against_reference)
+{
+    constexpr int kCapacity = 1000;
+
+    std::mt19937 rng(7);
+
+    for (int maxGap : {0, 1, 5, 64})
+    {
+        priv::DirtyRangeSet dirty(kCapacity, maxGap);
+        std::vector<bool>   gold(kCapacity, false);
+
+        for (int iter = 0; iter < 2000; ++iter)
+        {
+            switch (rng() % 8)
+            {
+            case 0:
+            {
+                int size = rng() % (kCapacity + 1);
+                dirty.truncate(size);
+                std::fill(gold.begin() + size, gold.end(), false);
+                break;
+            }
+            case 1:
+                dirty.clear();
+                std::fill(gold.begin(), gold.end(), false);
+                break;
+            default:
+            {
+                int begin = rng() % kCapacity;
+                int end   = std::min<int>(kCapacity, begin + rng() % 70);
+                dirty.mark(begin, end);
+                std::fill(gold.begin() + begin, gold.begin() + end, true);
+                break;
+            }
+            }
+
+            // Reference: runs of set elements, merging those with small gaps
+            Ranges goldRanges;
+            for (int i = 0; i < kCapacity; ++i)
+            {
+                if (!gold[i])
+                {
+                    continue;
+                }
+                int end = i;
+                while (end < kCapacity && gold[end])
+                {
+                    ++end;
+                }
+                if (!goldRanges.empty() && i - goldRanges.back().end <= maxGap)
+                {
+                    goldRanges.back().end = end;
+                }
+                else
+                {
+                    goldRanges.push_back({i, end});
+                }
+                i = end;
+            }
+
+            ASSERT_EQ(goldRanges, dirty.ranges()) << "iteration " << iter << ", max gap " << maxGap;
+            ASSERT_EQ(goldRanges.empty(), dirty.empty());
+        }
+    }
+}
@@ -21,6 +21,10 @@
 #include <nvcv_types/priv/HandleManager.hpp>
 #include <nvcv_types/priv/HandleManagerImpl.hpp>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 
 namespace priv = nvcv::priv;
@@ -189,3 +193,323 @@ TEST(HandleManager, smoke_no_handle_leak_if_object_creation_throws)
     ASSERT_NO_THROW(h = mgr.create<Object>(1).first);
     mgr.decRef(h);
 }
+
+TEST(HandleManager, smoke_create_many)
+{
+    priv::HandleManager<IObject> mgr("Object");
+
+    // More than what's allocated initially, and more than a thread cache holds
+    const int N = 3000;
+
+    std::vector<void *> handles(N);
+    int                 numCreated = 0;
+    mgr.createMany<Object>(
+        N, handles.data(), [](int32_t i) { return std::make_tuple(i); },
+        [&](void *h, Object *obj)
+        {
+            EXPECT_EQ(obj, mgr.validate(h));
+            ++numCreated;
+        });
+    EXPECT_EQ(N, numCreated);
+
+    std::unordered_set<void *> uniqueHandles(handles.begin(), handles.end());
+    EXPECT_EQ(N, uniqueHandles.size());
+
+    for (int i = 0; i < N; ++i)
+    {
+        IObject *obj = mgr.validate(handles[i]);
+        ASSERT_NE(nullptr, obj);
+        EXPECT_EQ(i, obj->value());
+    }
+
+    ASSERT_EQ(2, mgr.incRef(handles[1]));
+
+    std::vector<int> refCounts(N);
+    mgr.decRefMany(N, handles.data(), refCounts.data());
+    for (int i = 0; i < N; ++i)
+    {
+        EXPECT_EQ(i == 1 ? 1 : 0, refCounts[i]);
+        EXPECT_EQ(i == 1, mgr.validate(handles[i]) != nullptr);
+    }
+
+    // Already destroyed, nothing after it must be touched
+    void *pair[2] = {handles[0], handles[1]};
+    EXPECT_THROW(mgr.decRefMany(2, pair, nullptr), priv::Exception);
+    ASSERT_NE(nullptr, mgr.validate(handles[1]));
+
+    void *nullAndValid[2] = {nullptr, handles[1]};
+    mgr.decRefMany(2, nullAndValid, nullptr);
+    EXPECT_EQ(nullptr, mgr.validate(handles[1]));
+}
+
+TEST(HandleManager, smoke_create_many_rolls_back_if_object_creation_throws)
+{
+    priv::HandleManager<IObject> mgr("Object");
+    mgr.setFixedSize(4);
+
+    void *handles[4];
+    ASSERT_THROW(mgr.createMany<Object>(
+                     4, handles, [](int32_t i) { return std::make_tuple(i == 2 ? FORCE_FAILURE : i); },
+                     [](void *, Object *) {}),
+                 std::runtime_error);
+
+    // All resources must be available again
+    mgr.createMany<Object>(
+        4, handles, [](int32_t i) { return std::make_tuple(i); }, [](void *, Object *) {});
+    EXPECT_THROW(mgr.create<Object>(4), priv::Exception);
+
+    mgr.decRefMany(4, handles, nullptr);
+}
+
+TEST(HandleManager, smoke_create_many_exhausts_fixed_size_pool)
+{
+    priv::HandleManager<IObject> mgr("Object");
+    mgr.setFixedSize(4);
+
+    void *handles[5];
+    ASSERT_THROW(mgr.createMany<Object>(
+                     5, handles, [](int32_t i) { return std::make_tuple(i); }, [](void *, Object *) {}),
+                 priv::Exception);
+
+    mgr.createMany<Object>(
+        4, handles, [](int32_t i) { return std::make_tuple(i); }, [](void *, Object *) {});
+    mgr.decRefMany(4, handles, nullptr);
+}
+
+TEST(HandleManager, smoke_fixed_size_resources_not_hoarded_by_threads)
+{
+    priv::HandleManager<IObject> mgr("Object");
+    mgr.setFixedSize(4);
+
+    auto createDestroyAll = [&]
+    {
+        std::vector<void *> handles;
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_NO_THROW(handles.push_back(mgr.create<Object>(i).first));
+        }
+        for (void *h : handles)
+        {
+            ASSERT_EQ(0, mgr.decRef(h));
+        }
+    };
+
+    std::thread(createDestroyAll).join();
+    createDestroyAll();
+    std::thread(createDestroyAll).join();
+}
+
+TEST(HandleManager, smoke_resources_migrate_between_threads)
+{
+    priv::HandleManager<IObject> mgr("Object");
+
+    std::vector<void *> handles(1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        handles[i] = mgr.create<Object>(i).first;
+    }
+
+    std::thread(
+        [&]
+        {
+            for (void *h : handles)
+            {
+                ASSERT_EQ(0, mgr.decRef(h));
+            }
+        })
+        .join();
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        void   *h;
+        Object *obj;
+        std::tie(h, obj) = mgr.create<Object>(i);
+        ASSERT_EQ(obj, mgr.validate(h));
+        ASSERT_EQ(i, obj->value());
+        handles[i] = h;
+    }
+    for (void *h : handles)
+    {
+        ASSERT_EQ(0, mgr.decRef(h));
+    }
+}
+
+TEST(HandleManager, smoke_thread_cache_outlives_manager)
+{
+    std::mutex              mtx;
+    std::condition_variable cv;
+    int                     step = 0;
+
+    auto mgr = std::make_unique<priv::HandleManager<IObject>>("Object");
+
+    auto waitStep = [&](int s)
+    {
+        std::unique_lock lk(mtx);
+        cv.wait(lk, [&] { return step == s; });
+    };
+    auto setStep = [&](int s)
+    {
+        {
+            std::unique_lock lk(mtx);
+            step = s;
+        }
+        cv.notify_all();
+    };
+
+    std::thread worker(
+        [&]
+        {
+            // Leave resources in this thread's cache
+            void *h = mgr->create<Object>(0).first;
+            mgr->decRef(h);
+            setStep(1);
+
+            waitStep(2);
+            // Manager was replaced, thread cache must not hand out stale resources
+            h = mgr->create<Object>(1).first;
+            EXPECT_EQ(1, mgr->validate(h)->value());
+            mgr->decRef(h);
+        });
+
+    waitStep(1);
+    mgr = std::make_unique<priv::HandleManager<IObject>>("Object");
+    setStep(2);
+
+    worker.join();
+}
+
+TEST(HandleManager, stats_track_counts_and_pool_growth)
+{
+    priv::HandleManager<IObject> mgr("Object");
+
+    priv::HandleManagerStats stats = mgr.stats();
+    EXPECT_EQ(0, stats.liveCount);
+    EXPECT_EQ(0, stats.peakCount);
+    EXPECT_EQ(0, stats.capacity);
+    EXPECT_EQ(0, stats.poolGrowths);
+
+    // Pools double in size when exhausted
+    const int kCount = 3000;
+
+    std::vector<void *> handles(kCount);
+    mgr.createMany<Object>(
+        kCount, handles.data(), [](int i) { return std::make_tuple(i); }, [](void *, Object *) {});
+
+    stats = mgr.stats();
+    EXPECT_EQ(kCount, stats.liveCount);
+    EXPECT_EQ(kCount, stats.peakCount);
+    EXPECT_EQ(4096, stats.capacity);
+    EXPECT_EQ(3, stats.poolGrowths);
+
+    mgr.decRefMany(kCount - 1, handles.data(), nullptr);
+    void *h = mgr.create<Object>(0).first;
+
+    stats = mgr.stats();
+    EXPECT_EQ(2, stats.liveCount);
+    EXPECT_EQ(kCount, stats.peakCount);
+
+    mgr.decRef(h);
+    mgr.decRef(handles.back());
+    EXPECT_EQ(0, mgr.stats().liveCount);
+
+    mgr.setFixedSize(10);
+    stats = mgr.stats();
+    EXPECT_EQ(10, stats.capacity);
+    EXPECT_EQ(4, stats.poolGrowths);
+}
+
+TEST(HandleManager, smoke_concurrent_create_destroy)
+{
+    priv::HandleManager<IObject> mgr("Object");
+
+    auto worker = [&](int id)
+    {
+        std::vector<std::pair<void *, int>> live;
+        for (int i = 0; i < 10000; ++i)
+        {
+            if (live.size() < 100 && (i % 3) != 2)
+            {
+                int value = id * 100000 + i;
+                live.emplace_back(mgr.create<Object>(value).first, value);
+            }
+            else if (!live.empty())
+            {
+                auto [h, value] = live.back();
+                live.pop_back();
+                IObject *obj = mgr.validate(h);
+                ASSERT_NE(nullptr, obj);
+                ASSERT_EQ(value, obj->value());
+                ASSERT_EQ(0, mgr.decRef(h));
+            }
+        }
+        for (auto [h, value] : live)
+        {
+            ASSERT_EQ(0, mgr.decRef(h));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+}
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(HandleManager, DISABLED_benchmark_create_destroy_scaling)
+{
+    const int kIters = 20000;
+
+    auto run = [&](priv::HandleManager<IObject> &mgr, int numThreads)
+    {
+        auto worker = [&]
+        {
+            void *h[4];
+            for (int i = 0; i < kIters; ++i)
+            {
+                for (int j = 0; j < 4; ++j)
+                {
+                    h[j] = mgr.create<Object>(j).first;
+                }
+                for (int j = 0; j < 4; ++j)
+                {
+                    mgr.decRef(h[j]);
+                }
+            }
+        };
+
+        auto                     start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration<double, std::nano>(end - start).count() / (kIters * 4.0 * numThreads);
+    };
+
+    for (int numThreads : {1, 2, 4, 8, 16, 32})
+    {
+        // Fixed-size pools bypass the thread caches, all threads
+        // go through the shared free resource stack.
+        priv::HandleManager<IObject> sharedMgr("Object");
+        sharedMgr.setFixedSize(numThreads * 4);
+
+        priv::HandleManager<IObject> cachedMgr("Object");
+
+        double sharedTime = run(sharedMgr, numThreads);
+        double cachedTime = run(cachedMgr, numThreads);
+
+        std::cout << numThreads << " threads: shared stack = " << sharedTime
+                  << "ns/handle, thread cache = " << cachedTime << "ns/handle" << std::endl;
+    }
+}
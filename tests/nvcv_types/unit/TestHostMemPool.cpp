@@ -0,0 +1,308 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv_types/priv/DefaultAllocator.hpp>
+#include <nvcv_types/priv/HostMemPool.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+
+namespace priv = nvcv::priv;
+
+TEST(HostMemPool, size_class)
+{
+    EXPECT_EQ(0, priv::HostMemPool::SizeClass(0, 1));
+    EXPECT_EQ(0, priv::HostMemPool::SizeClass(1, 1));
+    EXPECT_EQ(0, priv::HostMemPool::SizeClass(64, 64));
+    EXPECT_EQ(1, priv::HostMemPool::SizeClass(65, 1));
+    EXPECT_EQ(1, priv::HostMemPool::SizeClass(128, 1));
+    EXPECT_EQ(2, priv::HostMemPool::SizeClass(256, 256));
+    EXPECT_EQ(3, priv::HostMemPool::SizeClass(256, 512));
+    EXPECT_EQ(priv::HostMemPool::kNumClasses - 1, priv::HostMemPool::SizeClass(1 << 18, 1));
+    EXPECT_EQ(-1, priv::HostMemPool::SizeClass((1 << 18) + 1, 1));
+    EXPECT_EQ(-1, priv::HostMemPool::SizeClass(8192, 8192));
+}
+
+TEST(HostMemPool, blocks_are_recycled)
+{
+    priv::HostMemPool pool;
+
+    void *p = pool.alloc(256, 256);
+    ASSERT_NE(nullptr, p);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(p) % 256);
+    memset(p, 0xAB, 256);
+    pool.free(p, 256, 256);
+
+    // Same size class, must get the same block back
+    void *q = pool.alloc(200, 8);
+    EXPECT_EQ(p, q);
+    pool.free(q, 200, 8);
+}
+
+TEST(HostMemPool, large_requests_arent_pooled)
+{
+    priv::HostMemPool pool;
+
+    const int64_t size = int64_t(1) << 20;
+
+    void *p = pool.alloc(size, 256);
+    ASSERT_NE(nullptr, p);
+    pool.free(p, size, 256);
+    pool.flushThreadCache();
+    EXPECT_EQ(0, pool.cachedBytes());
+}
+
+TEST(HostMemPool, foreign_blocks_too_small_arent_recycled)
+{
+    priv::HostMemPool pool;
+
+    // Size class is 128 bytes, but the block can only hold 64 bytes
+    void *p = std::aligned_alloc(64, 64);
+    ASSERT_NE(nullptr, p);
+    pool.free(p, 128, 64);
+    pool.flushThreadCache();
+    EXPECT_EQ(0, pool.cachedBytes());
+}
+
+TEST(HostMemPool, flush_moves_blocks_to_depot)
+{
+    priv::HostMemPool pool;
+
+    std::vector<void *> blocks;
+    for (int i = 0; i < 10; ++i)
+    {
+        blocks.push_back(pool.alloc(1024, 64));
+    }
+    for (void *p : blocks)
+    {
+        pool.free(p, 1024, 64);
+    }
+    EXPECT_EQ(0, pool.cachedBytes());
+
+    pool.flushThreadCache();
+    EXPECT_EQ(10 * 1024, pool.cachedBytes());
+
+    pool.trim();
+    EXPECT_EQ(0, pool.cachedBytes());
+}
+
+TEST(HostMemPool, depot_respects_byte_cap)
+{
+    priv::HostMemPool pool(4096);
+
+    std::vector<void *> blocks;
+    for (int i = 0; i < 1000; ++i)
+    {
+        blocks.push_back(pool.alloc(1024, 64));
+    }
+    for (void *p : blocks)
+    {
+        pool.free(p, 1024, 64);
+        EXPECT_LE(pool.cachedBytes(), 4096);
+    }
+    pool.flushThreadCache();
+    EXPECT_LE(pool.cachedBytes(), 4096);
+
+    pool.setMaxCachedBytes(0);
+    pool.trim();
+    for (int i = 0; i < 10; ++i)
+    {
+        blocks[i] = pool.alloc(1024, 64);
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        pool.free(blocks[i], 1024, 64);
+    }
+    pool.flushThreadCache();
+    EXPECT_EQ(0, pool.cachedBytes());
+}
+
+TEST(HostMemPool, blocks_migrate_between_threads)
+{
+    priv::HostMemPool pool;
+
+    std::vector<void *> blocks;
+    for (int i = 0; i < 1000; ++i)
+    {
+        blocks.push_back(pool.alloc(64, 16));
+    }
+
+    // Freed by another thread, whose magazines go to the depot on exit
+    std::thread([&] {
+        for (void *p : blocks)
+        {
+            pool.free(p, 64, 16);
+        }
+    }).join();
+
+    EXPECT_EQ(1000 * 64, pool.cachedBytes());
+
+    std::sort(blocks.begin(), blocks.end());
+    for (int i = 0; i < 1000; ++i)
+    {
+        void *p = pool.alloc(64, 16);
+        EXPECT_TRUE(std::binary_search(blocks.begin(), blocks.end(), p));
+    }
+    EXPECT_EQ(0, pool.cachedBytes());
+
+    for (void *p : blocks)
+    {
+        pool.free(p, 64, 16);
+    }
+}
+
+TEST(HostMemPool, pool_outlives_thread_cache)
+{
+    // Destroyed after the thread's cache, like a global pool during static destruction
+    struct Owner
+    {
+        std::unique_ptr<priv::HostMemPool> pool = std::make_unique<priv::HostMemPool>();
+
+        ~Owner()
+        {
+            void *p = pool->alloc(64, 16);
+            EXPECT_NE(nullptr, p);
+            pool->free(p, 64, 16);
+            pool.reset();
+        }
+    };
+
+    int64_t cachedBytes = -1;
+
+    std::thread(
+        [&]
+        {
+            thread_local Owner owner;
+
+            void *p = owner.pool->alloc(64, 16);
+            owner.pool->free(p, 64, 16);
+            cachedBytes = owner.pool->cachedBytes();
+        })
+        .join();
+
+    // Block was still in the thread's cache
+    EXPECT_EQ(0, cachedBytes);
+}
+
+TEST(HostMemPool, concurrent_alloc_free_keeps_blocks_intact)
+{
+    priv::HostMemPool pool(1 << 20);
+
+    auto worker = [&](int seed)
+    {
+        std::mt19937                       rng(seed);
+        std::uniform_int_distribution<int> sizeDist(1, 8192);
+        std::vector<std::pair<uint8_t *, int>> live;
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            if (live.size() < 64 && (live.empty() || rng() % 2))
+            {
+                int   size = sizeDist(rng);
+                auto *p    = static_cast<uint8_t *>(pool.alloc(size, 1));
+                ASSERT_NE(nullptr, p);
+                memset(p, seed, size);
+                live.emplace_back(p, size);
+            }
+            else
+            {
+                std::swap(live[rng() % live.size()], live.back());
+                auto [p, size] = live.back();
+                live.pop_back();
+                for (int j = 0; j < size; ++j)
+                {
+                    ASSERT_EQ((uint8_t)seed, p[j]);
+                }
+                pool.free(p, size, 1);
+            }
+        }
+        for (auto [p, size] : live)
+        {
+            pool.free(p, size, 1);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back(worker, i + 1);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+}
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(HostMemPool, DISABLED_benchmark_multithreaded_churn)
+{
+    // Mimics the host buffers of ImageBatchVarShape/TensorBatch being created
+    // and destroyed concurrently, through the default allocator.
+    const int64_t kSizes[] = {32 * 64, 32 * 4, 32 * 8};
+    const int     kIters   = 20000;
+
+    auto run = [&](priv::DefaultAllocator &alloc, int numThreads)
+    {
+        auto worker = [&]
+        {
+            void *bufs[3];
+            for (int i = 0; i < kIters; ++i)
+            {
+                for (int b = 0; b < 3; ++b)
+                {
+                    bufs[b] = alloc.allocHostMem(kSizes[b], 64);
+                }
+                for (int b = 0; b < 3; ++b)
+                {
+                    alloc.freeHostMem(bufs[b], kSizes[b], 64);
+                }
+            }
+        };
+
+        auto                     start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back(worker);
+        }
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        return std::chrono::duration<double, std::nano>(end - start).count() / (kIters * 3.0 * numThreads);
+    };
+
+    for (int numThreads : {1, 2, 4, 8, 16})
+    {
+        priv::DefaultAllocator sysAlloc;
+        priv::DefaultAllocator poolAlloc;
+        poolAlloc.setHostMemPoolLimit(16 << 20);
+
+        double sysTime  = run(sysAlloc, numThreads);
+        double poolTime = run(poolAlloc, numThreads);
+
+        std::cout << numThreads << " threads: system = " << sysTime << "ns/alloc, pool = " << poolTime
+                  << "ns/alloc" << std::endl;
+    }
+}
@@ -19,6 +19,12 @@
 
 #include <nvcv_types/priv/LockFreeStack.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
 namespace priv = nvcv::priv;
 
 struct Node
@@ -119,3 +125,188 @@ TEST(LockFreeStack, smoke_release)
     EXPECT_EQ(nn + 2, nn[1].next);
     EXPECT_EQ(nullptr, nn[2].next);
 }
+
+TEST(LockFreeStack, smoke_pop_list)
+{
+    priv::LockFreeStack<Node> stack;
+
+    int count = -1;
+    ASSERT_EQ(nullptr, stack.popList(2, count));
+    ASSERT_EQ(0, count);
+
+    Node n[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        n[i].value = i;
+        stack.push(n + i);
+    }
+
+    Node *h = stack.popList(2, count);
+    ASSERT_EQ(2, count);
+    EXPECT_EQ(n + 4, h);
+    EXPECT_EQ(n + 3, n[4].next);
+    EXPECT_EQ(nullptr, n[3].next);
+    EXPECT_EQ(n + 2, stack.top());
+
+    h = stack.popList(10, count);
+    ASSERT_EQ(3, count);
+    EXPECT_EQ(n + 2, h);
+    EXPECT_EQ(n + 1, n[2].next);
+    EXPECT_EQ(n + 0, n[1].next);
+    EXPECT_EQ(nullptr, n[0].next);
+    EXPECT_TRUE(stack.empty());
+}
+
+namespace {
+
+struct SharedNode
+{
+    std::atomic<int> owners{0};
+
+    SharedNode *next = nullptr;
+};
+
+// Threads pop nodes, check that no one else owns them, and push them back.
+template<priv::LockFreeStackHead Head>
+void StressContention(int numThreads, int numNodes, int numIters)
+{
+    priv::LockFreeStack<SharedNode, Head> stack;
+
+    std::vector<SharedNode> nodes(numNodes);
+    for (SharedNode &n : nodes)
+    {
+        stack.push(&n);
+    }
+
+    std::atomic<int> errors{0};
+
+    auto worker = [&](int id)
+    {
+        for (int i = 0; i < numIters; ++i)
+        {
+            if ((i + id) % 4 == 0)
+            {
+                int         count;
+                SharedNode *first = stack.popList(3, count);
+                SharedNode *last  = nullptr;
+                int         n     = 0;
+                for (SharedNode *p = first; p; p = p->next, ++n)
+                {
+                    if (p->owners.fetch_add(1) != 0)
+                    {
+                        ++errors;
+                    }
+                    last = p;
+                }
+                if (n != count)
+                {
+                    ++errors;
+                }
+                for (SharedNode *p = first; p; p = p->next)
+                {
+                    p->owners.fetch_sub(1);
+                }
+                if (first)
+                {
+                    stack.pushStack(first, last);
+                }
+            }
+            else if (SharedNode *p = stack.pop())
+            {
+                if (p->owners.fetch_add(1) != 0)
+                {
+                    ++errors;
+                }
+                p->owners.fetch_sub(1);
+                stack.push(p);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(0, errors);
+
+    // All nodes must be back in the stack, each one once
+    int count = 0;
+    for (SharedNode *p = stack.release(); p; p = p->next, ++count)
+    {
+        ASSERT_LE(count, numNodes);
+        EXPECT_EQ(1, ++p->owners);
+    }
+    EXPECT_EQ(numNodes, count);
+}
+
+template<priv::LockFreeStackHead Head>
+double BenchmarkPopPush(int numThreads, int numIters)
+{
+    priv::LockFreeStack<Node, Head> stack;
+
+    std::vector<Node> nodes(numThreads * 2);
+    for (Node &n : nodes)
+    {
+        stack.push(&n);
+    }
+
+    auto worker = [&]
+    {
+        for (int i = 0; i < numIters; ++i)
+        {
+            if (Node *n = stack.pop())
+            {
+                stack.push(n);
+            }
+        }
+    };
+
+    auto                     start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double(numIters) * numThreads);
+}
+
+} // namespace
+
+TEST(LockFreeStack, stress_contention_tagged_head)
+{
+    StressContention<priv::LockFreeStackHead::TAGGED>(8, 4, 20000);
+    StressContention<priv::LockFreeStackHead::TAGGED>(16, 64, 10000);
+}
+
+TEST(LockFreeStack, stress_contention_locked_head)
+{
+    StressContention<priv::LockFreeStackHead::LOCKED>(8, 4, 20000);
+    StressContention<priv::LockFreeStackHead::LOCKED>(16, 64, 10000);
+}
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(LockFreeStack, DISABLED_benchmark_pop_push_scaling)
+{
+    const int kIters = 100000;
+
+    for (int numThreads : {1, 2, 4, 8, 16, 32, 64})
+    {
+        double taggedTime = BenchmarkPopPush<priv::LockFreeStackHead::TAGGED>(numThreads, kIters);
+        double lockedTime = BenchmarkPopPush<priv::LockFreeStackHead::LOCKED>(numThreads, kIters);
+
+        std::cout << numThreads << " threads: tagged head = " << taggedTime
+                  << "ns/pop+push, locked head = " << lockedTime << "ns/pop+push" << std::endl;
+    }
+}
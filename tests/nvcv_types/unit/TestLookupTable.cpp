@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv_types/priv/LookupTable.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace priv = nvcv::priv;
+
+namespace {
+
+struct Item
+{
+    int         key;
+    const char *name;
+};
+
+constexpr Item g_Items[] = {
+    {7, "seven"},
+    {3, "three"},
+    {9, "nine" },
+    {3, "other"},
+    {1, "one"  },
+};
+
+constexpr auto g_ByKey = priv::MakeLookupTable(g_Items, &Item::key, &Item::name);
+
+static_assert(g_ByKey.size() == 5);
+static_assert(g_ByKey.begin()->key == 1);
+static_assert((*g_ByKey.find(9))[0] == 'n');
+static_assert(g_ByKey.find(4) == nullptr);
+static_assert(g_ByKey.find(0) == nullptr);
+static_assert(g_ByKey.find(10) == nullptr);
+
+} // namespace
+
+TEST(LookupTable, entries_are_sorted)
+{
+    std::vector<int> keys;
+    for (auto &e : g_ByKey)
+    {
+        keys.push_back(e.key);
+    }
+    EXPECT_EQ((std::vector<int>{1, 3, 3, 7, 9}), keys);
+}
+
+TEST(LookupTable, equivalent_keys_keep_their_order)
+{
+    ASSERT_NE(nullptr, g_ByKey.find(3));
+    EXPECT_STREQ("three", *g_ByKey.find(3));
+}
+
+TEST(LookupTable, find_matches_linear_search)
+{
+    std::mt19937_64 rng(123);
+
+    int keys[200];
+    for (int &k : keys)
+    {
+        k = std::uniform_int_distribution<int>(0, 300)(rng);
+    }
+
+    struct Entry
+    {
+        int key, index;
+    };
+
+    Entry entries[std::size(keys)];
+    for (size_t i = 0; i < std::size(keys); ++i)
+    {
+        entries[i] = {keys[i], (int)i};
+    }
+
+    auto table = priv::MakeLookupTable(entries, &Entry::key, &Entry::index);
+
+    for (int key = -1; key <= 301; ++key)
+    {
+        auto it = std::find(std::begin(keys), std::end(keys), key);
+        if (it == std::end(keys))
+        {
+            EXPECT_EQ(nullptr, table.find(key)) << key;
+        }
+        else
+        {
+            ASSERT_NE(nullptr, table.find(key)) << key;
+            EXPECT_EQ(it - std::begin(keys), *table.find(key)) << key;
+        }
+    }
+}
@@ -21,6 +21,8 @@
 #include <util/PerStreamCache.hpp>
 #include <util/Stream.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <random>
 
 namespace {
@@ -393,4 +395,223 @@ TEST(PerStreamCacheTest, TwoStream)
     GTEST_SKIP() << "Test unreliable - cannot make the CPU wait for the GPU";
 }
 
+TEST(BinnedSizeIndexTest, BinOf)
+{
+    using Index = detail::BinnedSizeIndex<detail::StreamCacheItem<DummyPayload>>;
+    EXPECT_EQ(Index::BinOf(0), 0);
+    EXPECT_EQ(Index::BinOf(1), 0);
+    EXPECT_EQ(Index::BinOf(2), 1);
+    EXPECT_EQ(Index::BinOf(3), 1);
+    EXPECT_EQ(Index::BinOf(4), 2);
+    EXPECT_EQ(Index::BinOf(1000), 9);
+    EXPECT_EQ(Index::BinOf(1024), 10);
+    EXPECT_EQ(Index::BinOf(~size_t(0)), 63);
+}
+
+TEST(BinnedSizeIndexTest, RandomizedAgainstReference)
+{
+    using Item = detail::StreamCacheItem<DummyPayload>;
+
+    ItemAlloc                          alloc;
+    detail::BinnedSizeIndex<Item>      binned;
+    std::vector<Item *>                items;
+    std::mt19937_64                    rng(42);
+    std::uniform_int_distribution<int> logSize(0, 20);
+    std::uniform_int_distribution<int> logAlign(0, 8);
+
+    auto randomSize = [&]() { return size_t(1) << logSize(rng) | (rng() & 0xff); };
+
+    for (int iter = 0; iter < 20000; iter++)
+    {
+        if (rng() % 3 != 0 || items.empty())
+        {
+            Item *item              = alloc.allocate();
+            item->payload.size      = randomSize();
+            item->payload.alignment = size_t(1) << logAlign(rng);
+            binned.insert(item);
+            items.push_back(item);
+        }
+        else
+        {
+            size_t minSize  = randomSize();
+            size_t minAlign = size_t(1) << logAlign(rng);
+            auto   pred     = [&](const DummyPayload &p) { return p.size >= minSize && p.alignment >= minAlign; };
+
+            Item *found = binned.find(minSize, pred);
+
+            bool anyFits = std::any_of(items.begin(), items.end(), [&](Item *i) { return pred(i->payload); });
+            ASSERT_EQ(found != nullptr, anyFits) << "iteration " << iter;
+            if (!found)
+                continue;
+
+            ASSERT_TRUE(pred(found->payload));
+            // Any item in a larger size class is a worse fit than one in the requested size class
+            if (detail::BinnedSizeIndex<Item>::BinOf(found->payload.size)
+                > detail::BinnedSizeIndex<Item>::BinOf(minSize))
+            {
+                for (Item *i : items)
+                {
+                    ASSERT_FALSE(pred(i->payload) && detail::BinnedSizeIndex<Item>::BinOf(i->payload.size)
+                                                         == detail::BinnedSizeIndex<Item>::BinOf(minSize));
+                }
+            }
+
+            binned.remove(found->payload.size, found);
+            items.erase(std::find(items.begin(), items.end(), found));
+            alloc.deallocate(found);
+        }
+        ASSERT_EQ(binned.size(), items.size());
+    }
+
+    size_t cleared = 0;
+    binned.clear(
+        [&](Item *item)
+        {
+            alloc.deallocate(item);
+            cleared++;
+        });
+    EXPECT_EQ(cleared, items.size());
+    EXPECT_TRUE(binned.empty());
+}
+
+TEST(PerStreamCacheTest, BinnedNoStream)
+{
+    PerStreamCache<DummyPayload, detail::StreamCacheItem<DummyPayload>, detail::BinnedSizeIndex> cache;
+
+    cache.put(DummyPayload{1000, 1, nullptr}, std::nullopt);
+    cache.put(DummyPayload{2000, 1, nullptr}, std::nullopt);
+    cache.put(DummyPayload{3000, 256, nullptr}, std::nullopt);
+
+    auto v1 = cache.get(1001, 0, std::nullopt);
+    ASSERT_TRUE(v1.has_value());
+    EXPECT_EQ(v1->size, 2000);
+    auto v2 = cache.get(900, 64, std::nullopt);
+    ASSERT_TRUE(v2.has_value());
+    EXPECT_EQ(v2->size, 3000);
+    EXPECT_FALSE(cache.get(1001, 0, std::nullopt).has_value());
+    auto v3 = cache.get(900, 0, std::nullopt);
+    ASSERT_TRUE(v3.has_value());
+    EXPECT_EQ(v3->size, 1000);
+
+    // Leave something in the cache, it must be released with the cache
+    cache.put(DummyPayload{5000, 1, nullptr}, std::nullopt);
+}
+
+template<template<typename> class SizeIndex>
+void TestByteBudget()
+{
+    PerStreamCache<DummyPayload, detail::StreamCacheItem<DummyPayload>, SizeIndex> cache;
+    EXPECT_EQ(cache.byteBudget(), cache.kUnlimited);
+
+    cache.setByteBudget(5000);
+    cache.put(DummyPayload{1000, 1, nullptr}, std::nullopt);
+    cache.put(DummyPayload{2000, 1, nullptr}, std::nullopt);
+    cache.put(DummyPayload{3000, 1, nullptr}, std::nullopt);
+
+    // The oldest payload was evicted
+    PerStreamCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.evictions, 1);
+    EXPECT_EQ(stats.evictedBytes, 1000);
+    EXPECT_EQ(stats.itemsCached, 2);
+    EXPECT_EQ(stats.bytesCached, 5000);
+    EXPECT_EQ(stats.peakBytesCached, 6000);
+    auto v = cache.get(2500, 1, std::nullopt);
+    ASSERT_TRUE(v.has_value());
+    EXPECT_EQ(v->size, 3000);
+
+    stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 0);
+    EXPECT_EQ(stats.itemsCached, 1);
+
+    EXPECT_FALSE(cache.get(4000, 1, std::nullopt).has_value());
+    EXPECT_EQ(cache.stats().misses, 1);
+
+    // Getting a payload and putting it back makes it the most recently used
+    cache.put(DummyPayload{1500, 1, nullptr}, std::nullopt);
+    auto p = cache.get(1500, 1, std::nullopt);
+    ASSERT_TRUE(p.has_value());
+    EXPECT_EQ(p->size, 1500);
+    cache.put(std::move(*p), std::nullopt);
+    cache.put(DummyPayload{2000, 1, nullptr}, std::nullopt);
+
+    // The 2000-byte payload that wasn't used was evicted
+    stats = cache.stats();
+    EXPECT_EQ(stats.evictions, 2);
+    EXPECT_EQ(stats.evictedBytes, 3000);
+    EXPECT_EQ(stats.bytesCached, 3500);
+
+    // Lowering the budget evicts right away
+    cache.setByteBudget(0);
+    stats = cache.stats();
+    EXPECT_EQ(stats.itemsCached, 0);
+    EXPECT_EQ(stats.bytesCached, 0);
+
+    cache.put(DummyPayload{100, 1, nullptr}, std::nullopt);
+    EXPECT_FALSE(cache.get(1, 1, std::nullopt).has_value()) << "Nothing fits in a zero budget";
+
+    cache.setByteBudget(cache.kUnlimited);
+    cache.put(DummyPayload{100, 1, nullptr}, std::nullopt);
+    cache.purge();
+    EXPECT_EQ(cache.stats().bytesCached, 0);
+    EXPECT_EQ(cache.stats().peakBytesCached, 6000);
+}
+
+TEST(PerStreamCacheTest, ByteBudget)
+{
+    TestByteBudget<detail::OrderedSizeIndex>();
+}
+
+TEST(PerStreamCacheTest, BinnedByteBudget)
+{
+    TestByteBudget<detail::BinnedSizeIndex>();
+}
+
+namespace {
+
+template<template<typename> class SizeIndex>
+double BenchmarkPerStreamCache(int iters, int numSizes)
+{
+    PerStreamCache<DummyPayload, detail::StreamCacheItem<DummyPayload>, SizeIndex> cache;
+
+    std::mt19937_64                       rng(1);
+    std::uniform_int_distribution<size_t> sizeDist(256, 64 << 20);
+    std::vector<size_t>                   sizes(numSizes);
+    for (auto &s : sizes) s = sizeDist(rng);
+
+    // Keep a number of payloads in the cache, so that the lookups don't trivially succeed
+    for (size_t s : sizes) cache.put(DummyPayload{s, 256, nullptr}, std::nullopt);
+
+    size_t total = 0;
+    auto   start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iters; i++)
+    {
+        size_t size = sizes[i % numSizes];
+        auto   p    = cache.get(size, 256, std::nullopt);
+        if (p)
+        {
+            total += p->size;
+            cache.put(std::move(*p), std::nullopt);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_LT(0, total);
+    return std::chrono::duration<double, std::nano>(end - start).count() / iters;
+}
+
+} // namespace
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(PerStreamCacheTest, DISABLED_benchmark_size_index)
+{
+    const int kIters = 200000;
+    for (int numSizes : {8, 64, 1024})
+    {
+        double ordered = BenchmarkPerStreamCache<detail::OrderedSizeIndex>(kIters, numSizes);
+        double binned  = BenchmarkPerStreamCache<detail::BinnedSizeIndex>(kIters, numSizes);
+        std::cout << "PerStreamCache get+put with " << numSizes << " cached payloads: ordered = " << ordered
+                  << "ns, binned = " << binned << "ns" << std::endl;
+    }
+}
+
 } // namespace nvcv::util
@@ -17,8 +17,15 @@
 
 #include "Definitions.hpp"
 
+#include <util/LockFreeCache.hpp>
 #include <util/SimpleCache.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
 namespace {
 struct Payload
 {
@@ -53,11 +60,48 @@ struct Payload
     }
 };
 
+template<class Cache>
+class SimpleCacheTypedTest : public ::testing::Test
+{
+};
+
+using CacheTypes = ::testing::Types<nvcv::util::SimpleCache<Payload>, nvcv::util::LockFreeCache<Payload>>;
+
+// Time in ns of a get+put pair, with numThreads threads sharing the cache
+template<class Cache>
+double BenchmarkGetPut(Cache &cache, int numThreads, int iters)
+{
+    auto worker = [&]
+    {
+        for (int i = 0; i < iters; ++i)
+        {
+            int v = cache.getOrCreate([] { return 0; });
+            cache.put(std::move(v));
+        }
+    };
+
+    auto                     start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / (iters * (double)numThreads);
+}
+
 } // namespace
 
-TEST(SimpleCacheTest, PutGet)
+TYPED_TEST_SUITE(SimpleCacheTypedTest, CacheTypes);
+
+TYPED_TEST(SimpleCacheTypedTest, PutGet)
 {
-    nvcv::util::SimpleCache<Payload> cache;
+    TypeParam cache;
     EXPECT_FALSE(cache.get().has_value());
     Payload p = cache.getOrCreate([]() { return Payload(42); });
     EXPECT_EQ(p.data, 42);
@@ -90,3 +134,93 @@ TEST(SimpleCacheTest, PutGet)
     o = cache.get();
     EXPECT_FALSE(o.has_value());
 }
+
+TYPED_TEST(SimpleCacheTypedTest, Purge)
+{
+    TypeParam cache;
+    cache.emplace(1);
+    cache.emplace(2);
+    cache.purge();
+    EXPECT_FALSE(cache.get().has_value());
+
+    // The cache is still usable after purging
+    cache.emplace(3);
+    std::optional<Payload> o = cache.get();
+    ASSERT_TRUE(o.has_value());
+    EXPECT_EQ(o->data, 3);
+}
+
+TEST(LockFreeCacheTest, concurrent_get_put)
+{
+    // Each thread cycles its own values through the shared cache, no value is lost
+    // or duplicated.
+    constexpr int kThreads = 8, kValuesPerThread = 100, kIters = 20000;
+
+    nvcv::util::LockFreeCache<int> cache;
+    for (int i = 0; i < kThreads * kValuesPerThread; ++i)
+    {
+        cache.emplace(i);
+    }
+
+    std::atomic<int> misses = 0;
+
+    auto worker = [&]
+    {
+        for (int i = 0; i < kIters; ++i)
+        {
+            std::optional<int> v = cache.get();
+            if (v)
+            {
+                cache.put(std::move(*v));
+            }
+            else
+            {
+                ++misses;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    // There are more values than threads, so a get never finds the cache empty
+    EXPECT_EQ(0, misses);
+
+    std::vector<bool> seen(kThreads * kValuesPerThread, false);
+    while (std::optional<int> v = cache.get())
+    {
+        ASSERT_GE(*v, 0);
+        ASSERT_LT(*v, (int)seen.size());
+        ASSERT_FALSE(seen[*v]) << "Value " << *v << " is duplicated";
+        seen[*v] = true;
+    }
+    for (size_t i = 0; i < seen.size(); ++i)
+    {
+        EXPECT_TRUE(seen[i]) << "Value " << i << " is lost";
+    }
+}
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(LockFreeCacheTest, DISABLED_benchmark_thread_scaling)
+{
+    const int kIters = 200000;
+
+    for (int numThreads : {1, 2, 4, 8, 16})
+    {
+        nvcv::util::SimpleCache<int>   locked;
+        nvcv::util::LockFreeCache<int> lockFree;
+
+        double lockedTime   = BenchmarkGetPut(locked, numThreads, kIters / numThreads);
+        double lockFreeTime = BenchmarkGetPut(lockFree, numThreads, kIters / numThreads);
+
+        std::cout << "Cache get+put with " << numThreads << " threads: SimpleCache = " << lockedTime
+                  << "ns, LockFreeCache = " << lockFreeTime << "ns" << std::endl;
+    }
+}
@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv_types/priv/DataType.hpp>
+#include <nvcv_types/priv/Tensor.hpp>
+#include <nvcv_types/priv/TensorRequirementsCache.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace priv = nvcv::priv;
+
+namespace {
+
+NVCVTensorRequirements MakeReqs(int64_t seed)
+{
+    NVCVTensorRequirements reqs = {};
+    reqs.dtype                  = NVCV_DATA_TYPE_U8;
+    reqs.layout                 = NVCV_TENSOR_NHWC;
+    reqs.rank                   = 4;
+    for (int i = 0; i < 4; ++i)
+    {
+        reqs.shape[i]   = seed + i;
+        reqs.strides[i] = seed * 10 + i;
+    }
+    reqs.alignBytes              = 256;
+    reqs.mem.cudaMem.numBlocks[8] = seed;
+    return reqs;
+}
+
+priv::TensorRequirementsCache::Key MakeKey(const NVCVTensorRequirements &reqs)
+{
+    return priv::TensorRequirementsCache::MakeKey(reqs.rank, reqs.shape, reqs.dtype, reqs.layout, 0, 0, 0);
+}
+
+void ExpectEqual(const NVCVTensorRequirements &a, const NVCVTensorRequirements &b)
+{
+    EXPECT_EQ(a.dtype, b.dtype);
+    EXPECT_EQ(a.rank, b.rank);
+    EXPECT_EQ(0, memcmp(&a.layout, &b.layout, sizeof(a.layout)));
+    EXPECT_EQ(a.alignBytes, b.alignBytes);
+    for (int i = 0; i < a.rank; ++i)
+    {
+        EXPECT_EQ(a.shape[i], b.shape[i]);
+        EXPECT_EQ(a.strides[i], b.strides[i]);
+    }
+    EXPECT_EQ(0, memcmp(&a.mem, &b.mem, sizeof(a.mem)));
+}
+
+} // namespace
+
+TEST(TensorRequirementsCache, lookup_after_insert)
+{
+    priv::TensorRequirementsCache cache;
+
+    NVCVTensorRequirements reqs = MakeReqs(7), out;
+
+    EXPECT_FALSE(cache.lookup(MakeKey(reqs), out));
+    EXPECT_EQ(0, cache.hits());
+    EXPECT_EQ(1, cache.misses());
+
+    cache.insert(MakeKey(reqs), reqs);
+
+    ASSERT_TRUE(cache.lookup(MakeKey(reqs), out));
+    ExpectEqual(reqs, out);
+    EXPECT_EQ(1, cache.hits());
+    EXPECT_EQ(1, cache.misses());
+
+    // Any difference in the key is a miss
+    auto key  = MakeKey(reqs);
+    key.shape[3]++;
+    EXPECT_FALSE(cache.lookup(key, out));
+
+    key          = MakeKey(reqs);
+    key.rowAlign = 64;
+    EXPECT_FALSE(cache.lookup(key, out));
+
+    key        = MakeKey(reqs);
+    key.device = 1;
+    EXPECT_FALSE(cache.lookup(key, out));
+
+    cache.clear();
+    EXPECT_FALSE(cache.lookup(MakeKey(reqs), out));
+}
+
+TEST(TensorRequirementsCache, disabled_cache_never_hits)
+{
+    priv::TensorRequirementsCache cache;
+    cache.setEnabled(false);
+
+    NVCVTensorRequirements reqs = MakeReqs(3), out;
+    cache.insert(MakeKey(reqs), reqs);
+    EXPECT_FALSE(cache.lookup(MakeKey(reqs), out));
+
+    cache.setEnabled(true);
+    cache.insert(MakeKey(reqs), reqs);
+    EXPECT_TRUE(cache.lookup(MakeKey(reqs), out));
+}
+
+TEST(TensorRequirementsCache, concurrent_readers_never_see_torn_entries)
+{
+    priv::TensorRequirementsCache cache;
+
+    // Many more keys than slots, so that slots are constantly overwritten
+    constexpr int kNumKeys = priv::TensorRequirementsCache::kNumSlots * 8;
+
+    auto worker = [&](int seed)
+    {
+        for (int i = 0; i < 20000; ++i)
+        {
+            int64_t                k    = (seed * 7919 + i) % kNumKeys + 1;
+            NVCVTensorRequirements reqs = MakeReqs(k), out;
+
+            if (cache.lookup(MakeKey(reqs), out))
+            {
+                ASSERT_EQ(reqs.strides[3], out.strides[3]);
+                ASSERT_EQ(reqs.mem.cudaMem.numBlocks[8], out.mem.cudaMem.numBlocks[8]);
+            }
+            else
+            {
+                cache.insert(MakeKey(reqs), reqs);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(8 * 20000, cache.hits() + cache.misses());
+}
+
+TEST(TensorRequirementsCache, calc_requirements_is_memoized)
+{
+    priv::TensorRequirementsCache &cache = priv::Tensor::RequirementsCache();
+
+    int64_t shape[4] = {3, 480, 640, 3};
+
+    NVCVTensorRequirements gold;
+    cache.setEnabled(false);
+    gold = priv::Tensor::CalcRequirements(4, shape, priv::DataType{NVCV_DATA_TYPE_U8}, NVCV_TENSOR_NHWC, 0, 0);
+    cache.setEnabled(true);
+
+    int64_t hits = cache.hits();
+
+    NVCVTensorRequirements reqs;
+    for (int i = 0; i < 3; ++i)
+    {
+        reqs = priv::Tensor::CalcRequirements(4, shape, priv::DataType{NVCV_DATA_TYPE_U8}, NVCV_TENSOR_NHWC, 0, 0);
+        ExpectEqual(gold, reqs);
+    }
+    EXPECT_LE(hits + 2, cache.hits());
+
+    // Errors are reported even if a similar request is cached
+    EXPECT_THROW(priv::Tensor::CalcRequirements(4, shape, priv::DataType{NVCV_DATA_TYPE_U8}, NVCV_TENSOR_NHWC, 0, 3),
+                 priv::Exception);
+    EXPECT_THROW(priv::Tensor::CalcRequirements(3, shape, priv::DataType{NVCV_DATA_TYPE_U8}, NVCV_TENSOR_NHWC, 0, 0),
+                 priv::Exception);
+}
+
+// Prints timings only, run with --gtest_also_run_disabled_tests
+TEST(TensorRequirementsCache, DISABLED_benchmark_calc_requirements)
+{
+    priv::TensorRequirementsCache &cache = priv::Tensor::RequirementsCache();
+
+    // A handful of shapes, as in a typical inference loop
+    int64_t shapes[][4] = {
+        {1, 224, 224, 3},
+        {1, 720, 1280, 3},
+        {8, 224, 224, 3},
+        {1, 1080, 1920, 3}
+    };
+    const int kIters = 200000;
+
+    auto run = [&]
+    {
+        int64_t total = 0;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < kIters; ++i)
+        {
+            NVCVTensorRequirements reqs = priv::Tensor::CalcRequirements(
+                4, shapes[i % 4], priv::DataType{NVCV_DATA_TYPE_U8}, NVCV_TENSOR_NHWC, 0, 0);
+            total += reqs.strides[0];
+        }
+        EXPECT_LT(0, total);
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / kIters;
+    };
+
+    cache.setEnabled(false);
+    double uncachedTime = run();
+    cache.setEnabled(true);
+
+    int64_t hits     = cache.hits();
+    double  cachedTime = run();
+
+    std::cout << "CalcRequirements: uncached = " << uncachedTime << "ns, cached = " << cachedTime
+              << "ns, hit rate = " << (cache.hits() - hits) * 100.0 / kIters << "%" << std::endl;
+}
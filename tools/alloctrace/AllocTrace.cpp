@@ -0,0 +1,590 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AllocTrace.hpp"
+
+#include <util/Math.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace nvcv::alloctrace {
+
+using util::IsPowerOfTwo;
+using util::RoundUp;
+using util::RoundUpNextPowerOfTwo;
+
+std::vector<AllocTraceRecord> ReadAllocTrace(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "Can't open allocation trace '%s'", path.c_str());
+    }
+
+    AllocTraceHeader hdr;
+    if (!in.read(reinterpret_cast<char *>(&hdr), sizeof(hdr))
+        || memcmp(hdr.magic, AllocTraceHeader::MAGIC, sizeof(hdr.magic)) != 0)
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT, "File '%s' isn't an allocation trace", path.c_str());
+    }
+
+    if (hdr.version != AllocTraceHeader::VERSION || hdr.recordSize != sizeof(AllocTraceRecord))
+    {
+        throw Exception(Status::ERROR_INVALID_ARGUMENT,
+                        "Allocation trace '%s' has version %u and %u-byte records, expected version %u and %zu-byte "
+                        "records",
+                        path.c_str(), hdr.version, hdr.recordSize, AllocTraceHeader::VERSION,
+                        sizeof(AllocTraceRecord));
+    }
+
+    std::vector<AllocTraceRecord> records;
+    AllocTraceRecord              rec;
+    while (in.read(reinterpret_cast<char *>(&rec), sizeof(rec)))
+    {
+        // The analysis and the replay rely on these, reject corrupted records
+        if ((rec.op != AllocTraceOp::ALLOC && rec.op != AllocTraceOp::FREE) || rec.resType >= NVCV_NUM_RESOURCE_TYPES
+            || rec.size < 0 || rec.align <= 0 || !IsPowerOfTwo(rec.align))
+        {
+            throw Exception(Status::ERROR_INVALID_ARGUMENT,
+                            "Allocation trace '%s' has an invalid record #%zu: op %d, resource type %d, size %ld, "
+                            "alignment %d",
+                            path.c_str(), records.size(), static_cast<int>(rec.op), static_cast<int>(rec.resType),
+                            rec.size, rec.align);
+        }
+        records.push_back(rec);
+    }
+    return records;
+}
+
+namespace {
+
+// Best-fit allocator of offsets in an address range that grows on demand.
+// Free blocks are coalesced, and the range shrinks when its last block is freed.
+class SimulatedArena
+{
+public:
+    int64_t alloc(int64_t size, int32_t align)
+    {
+        // Zero-sized buffers still get a distinct address
+        size = std::max<int64_t>(size, 1);
+
+        for (auto it = m_freeBySize.lower_bound({size, 0}); it != m_freeBySize.end(); ++it)
+        {
+            auto [blockSize, blockOffset] = *it;
+
+            int64_t offset = RoundUp(blockOffset, align);
+            if (offset + size <= blockOffset + blockSize)
+            {
+                removeFree(blockOffset, blockSize);
+                addFree(blockOffset, offset - blockOffset);
+                addFree(offset + size, blockOffset + blockSize - offset - size);
+                return offset;
+            }
+        }
+
+        int64_t offset = RoundUp(m_top, align);
+        addFree(m_top, offset - m_top);
+        m_top  = offset + size;
+        m_peak = std::max(m_peak, m_top);
+        return offset;
+    }
+
+    void free(int64_t offset, int64_t size)
+    {
+        size = std::max<int64_t>(size, 1);
+
+        auto next = m_freeByOffset.lower_bound(offset);
+        if (next != m_freeByOffset.end() && next->first == offset + size)
+        {
+            size += next->second;
+            removeFree(next->first, next->second);
+        }
+
+        auto prev = m_freeByOffset.lower_bound(offset);
+        if (prev != m_freeByOffset.begin())
+        {
+            --prev;
+            if (prev->first + prev->second == offset)
+            {
+                offset = prev->first;
+                size += prev->second;
+                removeFree(prev->first, prev->second);
+            }
+        }
+
+        if (offset + size == m_top)
+        {
+            m_top = offset;
+        }
+        else
+        {
+            addFree(offset, size);
+        }
+    }
+
+    int64_t peak() const
+    {
+        return m_peak;
+    }
+
+private:
+    std::map<int64_t, int64_t>            m_freeByOffset; // offset -> size
+    std::set<std::pair<int64_t, int64_t>> m_freeBySize;   // (size, offset)
+
+    int64_t m_top  = 0;
+    int64_t m_peak = 0;
+
+    void addFree(int64_t offset, int64_t size)
+    {
+        if (size > 0)
+        {
+            m_freeByOffset.emplace(offset, size);
+            m_freeBySize.emplace(size, offset);
+        }
+    }
+
+    void removeFree(int64_t offset, int64_t size)
+    {
+        m_freeByOffset.erase(offset);
+        m_freeBySize.erase({size, offset});
+    }
+};
+
+// Number of size-class candidates per power of two when there are too many distinct sizes.
+constexpr int kCandidatesPerOctave = 16;
+constexpr int kMaxCandidates       = 512;
+
+// Smallest value >= size of the form m*2^e, with m < 2*kCandidatesPerOctave.
+int64_t RoundToCandidate(int64_t size)
+{
+    int64_t step = 1;
+    while (size > 2 * kCandidatesPerOctave * step)
+    {
+        step *= 2;
+    }
+    return RoundUp(size, step);
+}
+
+// Chooses at most maxClasses sizes so that rounding each allocation up to the
+// smallest class that fits wastes the fewest bytes. Returns the wasted bytes.
+int64_t ChooseSizeClasses(const std::map<int64_t, int64_t> &sizeCounts, int maxClasses,
+                          std::vector<AllocTraceSizeClass> &classes)
+{
+    // Candidate class sizes, with the number and total size of the allocations they'd serve.
+    // The largest one is always the largest size.
+    std::map<int64_t, std::pair<int64_t, int64_t>> buckets;
+    bool    quantize = sizeCounts.size() > kMaxCandidates;
+    int64_t maxSize  = sizeCounts.empty() ? 0 : sizeCounts.rbegin()->first;
+    for (auto [size, count] : sizeCounts)
+    {
+        auto &b = buckets[quantize ? std::min(RoundToCandidate(size), maxSize) : size];
+        b.first += count;
+        b.second += size * count;
+    }
+
+    const int m = buckets.size();
+    const int k = std::min(maxClasses, m);
+    if (k <= 0)
+    {
+        return 0;
+    }
+
+    std::vector<int64_t> value(m + 1), prefCount(m + 1, 0), prefBytes(m + 1, 0);
+    int                  i = 1;
+    for (auto &[v, b] : buckets)
+    {
+        value[i]     = v;
+        prefCount[i] = prefCount[i - 1] + b.first;
+        prefBytes[i] = prefBytes[i - 1] + b.second;
+        ++i;
+    }
+
+    // Waste of serving candidates a..b with class value[b]
+    auto cost = [&](int a, int b)
+    {
+        return value[b] * (prefCount[b] - prefCount[a - 1]) - (prefBytes[b] - prefBytes[a - 1]);
+    };
+
+    constexpr int64_t INF = std::numeric_limits<int64_t>::max();
+
+    // best[c][j]: minimum waste of serving candidates 1..j with c classes, the largest being value[j].
+    std::vector<std::vector<int64_t>> best(k + 1, std::vector<int64_t>(m + 1, INF));
+    std::vector<std::vector<int>>     from(k + 1, std::vector<int>(m + 1, 0));
+    best[0][0] = 0;
+    for (int c = 1; c <= k; ++c)
+    {
+        for (int j = c; j <= m; ++j)
+        {
+            for (int p = c - 1; p < j; ++p)
+            {
+                if (best[c - 1][p] != INF && best[c - 1][p] + cost(p + 1, j) < best[c][j])
+                {
+                    best[c][j] = best[c - 1][p] + cost(p + 1, j);
+                    from[c][j] = p;
+                }
+            }
+        }
+    }
+
+    classes.resize(k);
+    for (int c = k, j = m; c > 0; j = from[c][j], --c)
+    {
+        classes[c - 1].size      = value[j];
+        classes[c - 1].numAllocs = prefCount[j] - prefCount[from[c][j]];
+    }
+    return best[k][m];
+}
+
+struct LiveBuffer
+{
+    int64_t  size;
+    uint64_t time;
+    int64_t  offset;
+};
+
+void AnalyzeResource(const std::vector<AllocTraceRecord> &records, NVCVResourceType resType, int maxSizeClasses,
+                     AllocTraceStats &stats)
+{
+    std::unordered_map<uint64_t, LiveBuffer> live;
+    std::map<int64_t, int64_t>               sizeCounts;
+    SimulatedArena                           arena;
+
+    int64_t liveBytes   = 0;
+    double  lifetimeSum = 0;
+    int64_t pow2Bytes   = 0;
+
+    auto release = [&](const LiveBuffer &buf)
+    {
+        arena.free(buf.offset, buf.size);
+        liveBytes -= buf.size;
+    };
+
+    for (const AllocTraceRecord &rec : records)
+    {
+        if (rec.resType != resType)
+        {
+            continue;
+        }
+
+        if (rec.op == AllocTraceOp::ALLOC)
+        {
+            LiveBuffer buf{rec.size, rec.time, arena.alloc(rec.size, rec.align)};
+
+            auto [it, inserted] = live.emplace(rec.ptr, buf);
+            if (!inserted)
+            {
+                // The free of the previous buffer at this address wasn't traced
+                release(it->second);
+                it->second = buf;
+            }
+
+            ++stats.numAllocs;
+            stats.totalBytes += rec.size;
+            pow2Bytes += RoundUpNextPowerOfTwo(rec.size);
+            ++sizeCounts[rec.size];
+
+            liveBytes += rec.size;
+            stats.peakBytes  = std::max(stats.peakBytes, liveBytes);
+            stats.peakAllocs = std::max<int64_t>(stats.peakAllocs, live.size());
+        }
+        else
+        {
+            auto it = live.find(rec.ptr);
+            if (it == live.end())
+            {
+                ++stats.unmatchedFrees;
+                continue;
+            }
+
+            ++stats.numFrees;
+            lifetimeSum += rec.time - it->second.time;
+            release(it->second);
+            live.erase(it);
+        }
+    }
+
+    stats.leakedAllocs  = live.size();
+    stats.leakedBytes   = liveBytes;
+    stats.peakFootprint = arena.peak();
+    if (stats.peakFootprint > 0)
+    {
+        stats.fragmentation = 1 - static_cast<double>(stats.peakBytes) / stats.peakFootprint;
+    }
+    if (stats.numFrees > 0)
+    {
+        stats.meanLifetime = lifetimeSum / stats.numFrees * 1e-9;
+    }
+
+    int64_t waste = ChooseSizeClasses(sizeCounts, maxSizeClasses, stats.sizeClasses);
+    if (stats.totalBytes > 0)
+    {
+        stats.sizeClassWaste = static_cast<double>(waste) / stats.totalBytes;
+        stats.pow2Waste      = static_cast<double>(pow2Bytes - stats.totalBytes) / stats.totalBytes;
+    }
+
+    // Second pass to get how many buffers of each class are alive at the same time,
+    // which is how many a pool would need to hold.
+    std::vector<int64_t>                  classLive(stats.sizeClasses.size(), 0);
+    std::unordered_map<uint64_t, size_t> liveClass;
+
+    auto classOf = [&](int64_t size)
+    {
+        auto it = std::lower_bound(stats.sizeClasses.begin(), stats.sizeClasses.end(), size,
+                                   [](const AllocTraceSizeClass &c, int64_t s) { return c.size < s; });
+        return it - stats.sizeClasses.begin();
+    };
+
+    for (const AllocTraceRecord &rec : records)
+    {
+        if (rec.resType != resType)
+        {
+            continue;
+        }
+
+        if (rec.op == AllocTraceOp::ALLOC)
+        {
+            size_t cls = classOf(rec.size);
+
+            auto [it, inserted] = liveClass.emplace(rec.ptr, cls);
+            if (!inserted)
+            {
+                --classLive[it->second];
+                it->second = cls;
+            }
+
+            AllocTraceSizeClass &c = stats.sizeClasses[cls];
+            c.peakLive             = std::max(c.peakLive, ++classLive[cls]);
+        }
+        else if (auto it = liveClass.find(rec.ptr); it != liveClass.end())
+        {
+            --classLive[it->second];
+            liveClass.erase(it);
+        }
+    }
+}
+
+const char *ResourceName(int resType)
+{
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        return "Host memory";
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        return "Host-pinned memory";
+    case NVCV_RESOURCE_MEM_CUDA:
+        return "CUDA memory";
+    }
+    return "Unknown memory";
+}
+
+using AllocFn = NVCVStatus (*)(NVCVAllocatorHandle, void **, int64_t, int32_t);
+using FreeFn  = NVCVStatus (*)(NVCVAllocatorHandle, void *, int64_t, int32_t);
+
+AllocFn AllocFunction(int resType)
+{
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        return nvcvAllocatorAllocHostMemory;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        return nvcvAllocatorAllocHostPinnedMemory;
+    case NVCV_RESOURCE_MEM_CUDA:
+        return nvcvAllocatorAllocCudaMemory;
+    }
+    throw Exception(Status::ERROR_INVALID_ARGUMENT, "Invalid resource type %d in allocation trace", resType);
+}
+
+FreeFn FreeFunction(int resType)
+{
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        return nvcvAllocatorFreeHostMemory;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        return nvcvAllocatorFreeHostPinnedMemory;
+    case NVCV_RESOURCE_MEM_CUDA:
+        return nvcvAllocatorFreeCudaMemory;
+    }
+    throw Exception(Status::ERROR_INVALID_ARGUMENT, "Invalid resource type %d in allocation trace", resType);
+}
+
+void *HostAlloc(int64_t size, int32_t align)
+{
+    return std::aligned_alloc(align, size);
+}
+
+void HostFree(void *ptr, int64_t, int32_t)
+{
+    std::free(ptr);
+}
+
+} // namespace
+
+AllocTraceReport AnalyzeAllocTrace(const std::vector<AllocTraceRecord> &records, int maxSizeClasses)
+{
+    AllocTraceReport report;
+
+    if (!records.empty())
+    {
+        report.duration = records.back().time - records.front().time;
+    }
+
+    std::unordered_set<uint16_t> threads;
+    for (const AllocTraceRecord &rec : records)
+    {
+        threads.insert(rec.thread);
+    }
+    report.numThreads = threads.size();
+
+    for (int i = 0; i < NVCV_NUM_RESOURCE_TYPES; ++i)
+    {
+        AnalyzeResource(records, static_cast<NVCVResourceType>(i), maxSizeClasses, report.resources[i]);
+    }
+
+    return report;
+}
+
+void PrintAllocTraceReport(std::ostream &out, const AllocTraceReport &report)
+{
+    std::ios_base::fmtflags flags     = out.flags();
+    std::streamsize         precision = out.precision();
+
+    out << "Duration: " << report.duration * 1e-9 << " s, " << report.numThreads << " thread(s)\n";
+
+    for (int i = 0; i < NVCV_NUM_RESOURCE_TYPES; ++i)
+    {
+        const AllocTraceStats &s = report.resources[i];
+        if (s.numAllocs == 0 && s.unmatchedFrees == 0)
+        {
+            continue;
+        }
+
+        out << '\n' << ResourceName(i) << ":\n";
+        out << "  allocations: " << s.numAllocs << " (" << s.totalBytes << " bytes), frees: " << s.numFrees
+            << ", unmatched frees: " << s.unmatchedFrees << ", leaked: " << s.leakedAllocs << " (" << s.leakedBytes
+            << " bytes)\n";
+        out << "  peak: " << s.peakBytes << " bytes in " << s.peakAllocs << " buffers, footprint: " << s.peakFootprint
+            << " bytes, fragmentation: " << std::fixed << std::setprecision(1) << s.fragmentation * 100 << "%\n";
+        out << "  mean lifetime: " << std::setprecision(3) << s.meanLifetime * 1e3 << " ms\n";
+        out << "  suggested size classes (waste " << std::setprecision(1) << s.sizeClassWaste * 100
+            << "%, power-of-two classes waste " << s.pow2Waste * 100 << "%):\n";
+
+        out << "    " << std::setw(14) << "size" << std::setw(12) << "allocs" << std::setw(12) << "peak live" << '\n';
+        for (const AllocTraceSizeClass &c : s.sizeClasses)
+        {
+            out << "    " << std::setw(14) << c.size << std::setw(12) << c.numAllocs << std::setw(12) << c.peakLive
+                << '\n';
+        }
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+AllocTraceReplay ReplayAllocTrace(const std::vector<AllocTraceRecord> &records, const nvcv::Allocator &alloc)
+{
+    struct Buffer
+    {
+        void   *ptr;
+        int64_t size;
+        int32_t align;
+    };
+
+    std::unordered_map<uint64_t, Buffer> live[NVCV_NUM_RESOURCE_TYPES];
+
+    AllocTraceReplay result;
+
+    using Clock = std::chrono::steady_clock;
+    Clock::duration elapsed{0};
+
+    auto doFree = [&](int resType, const Buffer &buf)
+    {
+        auto start = Clock::now();
+        detail::CheckThrow(FreeFunction(resType)(alloc.handle(), buf.ptr, buf.size, buf.align));
+        elapsed += Clock::now() - start;
+    };
+
+    for (const AllocTraceRecord &rec : records)
+    {
+        if (rec.resType >= NVCV_NUM_RESOURCE_TYPES)
+        {
+            throw Exception(Status::ERROR_INVALID_ARGUMENT, "Invalid resource type %d in allocation trace",
+                            static_cast<int>(rec.resType));
+        }
+
+        auto &bufs = live[rec.resType];
+
+        if (rec.op == AllocTraceOp::ALLOC)
+        {
+            Buffer buf{nullptr, rec.size, rec.align};
+
+            auto start = Clock::now();
+            detail::CheckThrow(AllocFunction(rec.resType)(alloc.handle(), &buf.ptr, buf.size, buf.align));
+            elapsed += Clock::now() - start;
+            ++result.numAllocs;
+
+            auto [it, inserted] = bufs.emplace(rec.ptr, buf);
+            if (!inserted)
+            {
+                doFree(rec.resType, it->second);
+                it->second = buf;
+            }
+        }
+        else if (auto it = bufs.find(rec.ptr); it != bufs.end())
+        {
+            doFree(rec.resType, it->second);
+            bufs.erase(it);
+            ++result.numFrees;
+        }
+        else
+        {
+            ++result.skippedFrees;
+        }
+    }
+
+    for (int resType = 0; resType < NVCV_NUM_RESOURCE_TYPES; ++resType)
+    {
+        for (auto &[tracePtr, buf] : live[resType])
+        {
+            doFree(resType, buf);
+            ++result.leakedAllocs;
+        }
+    }
+
+    result.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    return result;
+}
+
+nvcv::Allocator CreateHostOnlyAllocator()
+{
+    return nvcv::CreateCustomAllocator(nvcv::CustomHostMemAllocator(&HostAlloc, &HostFree),
+                                       nvcv::CustomHostPinnedMemAllocator(&HostAlloc, &HostFree),
+                                       nvcv::CustomCudaMemAllocator(&HostAlloc, &HostFree));
+}
+
+} // namespace nvcv::alloctrace
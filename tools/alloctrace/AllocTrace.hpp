@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_TOOLS_ALLOC_TRACE_HPP
+#define NVCV_TOOLS_ALLOC_TRACE_HPP
+
+#include <nvcv/alloc/Allocator.hpp>
+#include <util/AllocTraceFormat.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace nvcv::alloctrace {
+
+using util::AllocTraceHeader;
+using util::AllocTraceOp;
+using util::AllocTraceRecord;
+
+/** Reads all the records of an allocation trace file.
+ *
+ * An incomplete record at the end of the file, left by a process that didn't finish
+ * writing it, is ignored.
+ *
+ * @throw nvcv::Exception if the file can't be read, isn't an allocation trace or has
+ *        invalid records, e.g. with a non-power-of-two alignment.
+ */
+std::vector<AllocTraceRecord> ReadAllocTrace(const std::string &path);
+
+/** A size class suggested for pooling the allocations of one resource type. */
+struct AllocTraceSizeClass
+{
+    int64_t size;      // in bytes
+    int64_t numAllocs; // number of allocations served by this class
+    int64_t peakLive;  // maximum number of buffers of this class alive at the same time
+};
+
+/** Statistics of the allocations of one resource type. */
+struct AllocTraceStats
+{
+    int64_t numAllocs      = 0;
+    int64_t numFrees       = 0;
+    int64_t unmatchedFrees = 0; // frees of buffers that weren't allocated in the trace
+    int64_t leakedAllocs   = 0; // buffers still alive at the end of the trace
+    int64_t leakedBytes    = 0;
+
+    int64_t totalBytes = 0; // sum of the sizes of all allocations
+    int64_t peakBytes  = 0; // maximum number of bytes alive at the same time
+    int64_t peakAllocs = 0; // maximum number of buffers alive at the same time
+
+    // Peak footprint of the trace when replayed in a single address range by a
+    // best-fit allocator that coalesces free blocks.
+    int64_t peakFootprint = 0;
+    // Part of the peak footprint that isn't used by live buffers at the peak: 1 - peakBytes/peakFootprint
+    double  fragmentation = 0;
+
+    double meanLifetime = 0; // mean time between allocation and free, in seconds
+
+    // Suggested size classes, in increasing size. Each allocation is served by the
+    // smallest class that fits it. They minimize the bytes lost by rounding up.
+    std::vector<AllocTraceSizeClass> sizeClasses;
+    // Fraction of the allocated bytes lost by rounding up to the suggested classes.
+    double                           sizeClassWaste = 0;
+    // Same as above, but with power-of-two classes.
+    double                           pow2Waste = 0;
+};
+
+struct AllocTraceReport
+{
+    int64_t duration   = 0; // ns between first and last event
+    int     numThreads = 0;
+
+    AllocTraceStats resources[NVCV_NUM_RESOURCE_TYPES];
+};
+
+/** Analyzes the allocation pattern of a trace.
+ *
+ * It doesn't allocate any of the traced buffers, all memory types are simulated
+ * on the host.
+ *
+ * @param records        Events of the trace, as returned by @ref ReadAllocTrace.
+ * @param maxSizeClasses Maximum number of size classes to suggest per resource type.
+ */
+AllocTraceReport AnalyzeAllocTrace(const std::vector<AllocTraceRecord> &records, int maxSizeClasses = 16);
+
+void PrintAllocTraceReport(std::ostream &out, const AllocTraceReport &report);
+
+/** Result of @ref ReplayAllocTrace. */
+struct AllocTraceReplay
+{
+    int64_t numAllocs    = 0;
+    int64_t numFrees     = 0;
+    int64_t skippedFrees = 0; // frees of buffers that weren't allocated in the trace
+    int64_t leakedAllocs = 0; // buffers still alive at the end, freed by the replay
+    int64_t elapsed      = 0; // time spent in allocation and free calls, in ns
+};
+
+/** Replays the allocations and frees of a trace with the given allocator.
+ *
+ * Events are replayed in order, from the calling thread. Buffers not freed by the
+ * trace are freed at the end.
+ *
+ * @throw nvcv::Exception if an allocation fails.
+ */
+AllocTraceReplay ReplayAllocTrace(const std::vector<AllocTraceRecord> &records, const nvcv::Allocator &alloc);
+
+/** Creates an allocator that serves all memory types with host memory.
+ *
+ * Used to replay traces of CUDA and pinned memory allocations on machines without a GPU.
+ */
+nvcv::Allocator CreateHostOnlyAllocator();
+
+} // namespace nvcv::alloctrace
+
+#endif // NVCV_TOOLS_ALLOC_TRACE_HPP
@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Analyzes allocation traces recorded with NVCV_ALLOC_TRACE or nvcvAllocatorSetTraceFile.
+
+#include <alloctrace/AllocTrace.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace trace = nvcv::alloctrace;
+
+namespace {
+
+void PrintUsage(const char *prog)
+{
+    std::cerr << "Usage: " << prog << " [--classes N] [--replay] <trace file>\n"
+              << "  --classes N  Maximum number of size classes to suggest per memory type (default: 16)\n"
+              << "  --replay     Also replay the trace with host memory standing in for all memory types,\n"
+              << "               and report the time spent in allocation calls\n";
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int         maxSizeClasses = 16;
+    bool        replay         = false;
+    const char *path           = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--classes") == 0 && i + 1 < argc)
+        {
+            maxSizeClasses = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--replay") == 0)
+        {
+            replay = true;
+        }
+        else if (argv[i][0] != '-' && path == nullptr)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (path == nullptr || maxSizeClasses <= 0)
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        std::vector<trace::AllocTraceRecord> records = trace::ReadAllocTrace(path);
+        std::cout << path << ": " << records.size() << " events\n";
+
+        trace::PrintAllocTraceReport(std::cout, trace::AnalyzeAllocTrace(records, maxSizeClasses));
+
+        if (replay)
+        {
+            // Replaying with tracing enabled would overwrite the trace being replayed
+            unsetenv("NVCV_ALLOC_TRACE");
+
+            trace::AllocTraceReplay result = trace::ReplayAllocTrace(records, trace::CreateHostOnlyAllocator());
+
+            int64_t numCalls = result.numAllocs + result.numFrees + result.leakedAllocs;
+            std::cout << "\nReplay with host memory: " << result.numAllocs << " allocations, " << result.numFrees
+                      << " frees, " << result.skippedFrees << " skipped frees, " << result.leakedAllocs
+                      << " leaked buffers freed at the end\n"
+                      << "  " << result.elapsed * 1e-6 << " ms in allocator calls";
+            if (numCalls > 0)
+            {
+                std::cout << ", " << static_cast<double>(result.elapsed) / numCalls << " ns/call";
+            }
+            std::cout << std::endl;
+        }
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}